@@ -1,8474 +1,10604 @@
-﻿#include <utility>
-#ifdef _MSC_VER
-    #define _CRT_SECURE_NO_WARNINGS
-#endif
-
-#define YAN_C_API_START extern "C" {
-#define YAN_C_API_END }
-#define YAN_CONTEXT_DECORATION(current) ctx->ctxLabel = std::format("@{}." #current " (aka '{}')", moduleName, ctx->ctxLabel)
-#define YAN_METHOD_CONTEXT_DECORATION(name) ctx->ctxLabel = std::format("{}.{}", this->className, name)
-// deprecated macro
-#define YAN_INITIALIZE_CALL_STACK_INFO() 
-// deprecated 
-
-#define RESET "\033[0m"
-#define BLACK "\033[30m"  /* Black */
-#define RED "\033[31m"    /* Red */
-#define GREEN "\033[32m"  /* Green */
-#define YELLOW "\033[33m" /* Yellow */
-#define BLUE "\033[34m"   /* Blue */
-#define PURPLE "\033[35m" /* Purple */
-#define CYAN "\033[36m"   /* Cyan */
-#define WHITE "\033[37m"  /* White */
-#define BOLD_WHITE "\033[1;37m"
-
-#define NORMAL() (std::cout << RESET)
-#define INFO() (std::cout << GREEN)
-#define WARN() (std::cout << YELLOW)
-#define ERROR() (std::cout << RED)
-#define DEBUG() (std::cout << CYAN)
-
-
-#include <cstring>
-#include <iostream>
-#include <string>
-#include <format>
-#include <vector>
-#include <sstream>
-#include <fstream>
-#include <cassert>
-#include <functional>
-#include <variant>
-#include <cmath>
-#include <map>
-#include <memory>
-#include <chrono>
-#include <algorithm>
-#include <cstdio>
-#include <locale>
-#include <codecvt>
-#include <iomanip>
-#include <cstring>
-#include <cstdint>
-
-
-const char *YAN_LANG_VERSION = "2.0";
-const char *TOKEN_TYPE_TAGS[] {"Int", "Float", "OP_Plus", "OP_Minus", "OP_Mul", "OP_Div", "OP_Pow", 
-                            "Lparen", "Rparen", "LSquare", "RSquare", "Identifier", "Keyword", 
-                            "OP_Eq", "OP_Equal", "OP_Nequal", "OP_Lt", "OP_Gt", "OP_Lte", "OP_Gte", "Comma", "Arrow", "String", "Newline", "Dot", "Colon", "LStart", "RStart",
-                             "Invilid", "EOF"};
-const std::string EOF_ = "EOF";
-const std::wstring EOFW_ = L"EOF";
-const std::vector<std::string> SPACES { " ", "\t" };
-const std::vector<std::string> DIGITS { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9" };
-const std::vector<std::string> LETTERS {
-    "a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o", "p", "q", "r", "s", "t", "u", "v", "w", "x", "y", "z",
-    "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M", "N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z"
-};
-
-const std::vector<std::string> LETTERS_WITH_DIGITS {
-    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9",
-    "a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o", "p", "q", "r", "s", "t", "u", "v", "w", "x", "y", "z",
-    "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M", "N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z"
-};
-
-const std::vector<std::string> KEYWORDS {
-    "var", "and", "or", "not", "if", "elif", "then", "else", "for", "while", "step", "to", "function", "end", "return", "continue", "break", "in", "new", "nonlocal",
-    "defer", "struct"
-};
-
-const std::vector<std::string> STATEMENT_SEPERATORS {
-    "\n", ";"
-};
-
-const std::map<std::string, std::string> ESCAPED_CHARACTERS {
-    { "n", "\n" }, { "t", "\t" }, { "b", "\b" }, { "r", "\r" },
-    { "'", "\'" }
-};
-
-const std::map<std::string, std::string> REVERSED_ESCAPE_CHARACTERS {
-    { "\n", "n" }, { "\t", "t" }, { "\b", "b" }, { "\r", "r" },
-    { "\'", "'" }
-};
-
-#if defined(__LP64__) || defined(_WIN64)
-    const char *platformInfo = "AMD64";
-#else
-    const char *platformInfo = "i386";
-#endif
-
-#ifdef __clang__
-    const std::string compilerInfo =  std::format("[Clang {}.{}.{} ({})]", __clang_major__, __clang_minor__, __clang_patchlevel__, platformInfo);
-#endif
-
-#ifdef __GNUC__
-    #ifndef __clang__
-    const std::string compilerInfo = std::format("[GCC {}.{} ({})]", __GNUC__, __GNUC_PATCHLEVEL__, platformInfo);
-    #endif
-#endif
-
-#ifdef _MSC_VER
-    const std::string compilerInfo = std::format("[MSC v.{} ({})]", _MSC_VER, platformInfo);
-#endif
-
-#ifdef _WIN32
-    namespace win32 {
-        #include <windows.h>
-        #include <dbghelp.h>
-    }
-    const char *platform = "win32";
-#elif defined(__linux__)
-    #include <dlfcn.h>
-    #include <execinfo.h>
-    #include <cxxabi.h> 
-    const char *platform = "linux";
-#elif defined(__APPLE__)
-    const char *platform = "darwin"
-#else
-    const char *platform = "unknown";
-#endif
-
-const std::string compilationTimeStamp = std::format("({}, {})", __DATE__, __TIME__);
-bool debug = false;
-const long MAX_CALLSTACK_DEPTH = 50;
-static long currentCallStackDepth = 0;
-unsigned overflowCount = 0;
-const unsigned INVILID_OVERFLOW_TOLERANCE = 10;
-
-
-class BigInteger {
-    using size_t = std::size_t;
-
-public:
-    std::vector<int> GetInternalValue() {
-        return num;
-    }
-
-private:
-    static const int BASE = 100000000;
-    static const int WIDTH = 8;
-    bool sign;
-    size_t length;
-    std::vector<int> num;
-
-    void CutLeadingZero() {
-        while (num.back() == 0 && num.size() != 1) {
-            num.pop_back();
-        }
-    }
-
-    void SetLength() {
-        this->CutLeadingZero();
-        int tmp = num.back();
-        if (tmp == 0) {
-            length = 1;
-        } else {
-            length = (num.size() - 1) * 8;
-            while (tmp > 0) {
-                ++length;
-                tmp /= 10;
-            }
-        }
-    }
-
-public:
-    BigInteger(int n = 0) { *this = n; }
-    BigInteger(long long n) { *this = n; }
-    BigInteger(const char *n) { *this = n; }
-    BigInteger(const BigInteger &n) { *this = n; }
-    BigInteger(const std::string &n) { *this = n; }
-
-    const BigInteger& operator=(int n) {
-         *this = (long long)n;
-        return *this;
-    }
-
-    const BigInteger& operator=(long long n) {
-        num.clear();
-        if (n == 0) {
-            num.push_back(0);
-        }
-        if (n >= 0) {
-            sign = true;
-        } else if (n == LONG_LONG_MIN) {
-            *this = "-9223372036854775808";
-            return *this;
-        } else if (n < 0) {
-            sign = false;
-            n = -n;
-        }
-
-        while (n != 0) {
-            num.push_back(n % BASE);
-            n /= BASE;
-        }
-        this->SetLength();
-        return *this;
-    }
-
-    const BigInteger& operator=(const char *n) {
-        int len = strlen(n);
-        int tmp = 0;
-        int ten = 1;
-        int stop = 0;
-        num.clear();
-        sign = (n[0] != '-');
-        if (!sign) {
-            stop = 1;
-        }
-        for (int i = len; i > stop; --i) {
-            tmp += (n[i - 1] - '0') * ten;
-            ten *= 10;
-            if ((len - i) % 8 == 7) {
-                num.push_back(tmp);
-                tmp = 0;
-                ten = 1;
-            }
-        }
-        if ((len - stop) % WIDTH != 0) {
-            num.push_back(tmp);
-        }
-        SetLength();
-        return *this;
-    }
-
-    const BigInteger &operator=(const std::string &n) {
-        *this = n.c_str();
-        return *this;
-    }
-
-    const BigInteger& operator=(const BigInteger &n) {
-        num = n.num;
-        sign = n.sign;
-        length = n.length;
-        return *this;
-    }
-
-    size_t size() const { return this->length; }
-    BigInteger e(size_t n) const {
-        int tmp = n % 8;
-        BigInteger ans;
-        ans.length = n + 1;
-        n /= 8;
-
-        while (ans.num.size() <= n) {
-            ans.num.push_back(0);
-        }
-        ans.num[n] = 1;
-        while (tmp--) {
-            ans.num[n] *= 10;
-        }
-        return ans * (*this);
-    }
-
-    BigInteger abs() const {
-        BigInteger ans(*this);
-        ans.sign = true;
-        return ans;
-    }
-
-    const BigInteger& operator+() const {
-        return *this;
-    }
-
-    friend BigInteger operator+(const BigInteger &a, const BigInteger &b) {
-        if (!b.sign) {
-            return a - (-b);
-        }
-        if (!a.sign) {
-            return b - (-a);
-        }
-        BigInteger ans;
-        int carry = 0;
-        int aa, bb;
-        size_t lena = a.num.size();
-        size_t lenb = b.num.size();
-        size_t len = std::max(lena, lenb);
-        ans.num.clear();
-
-        for (size_t i = 0; i < len; ++i) {
-            if (lena <= i) {
-                aa = 0;
-            } else {
-                aa = a.num[i];
-            }
-            if (lenb <= i) {
-                bb = 0;
-            } else {
-                bb = b.num[i];
-            }
-            ans.num.push_back((aa + bb + carry) % BigInteger::BASE);
-            carry = (aa + bb + carry) / BigInteger::BASE;
-        }
-        if (carry > 0) {
-            ans.num.push_back(carry);
-        }
-        ans.SetLength();
-        return ans;
-    }
-
-    const BigInteger& operator+=(const BigInteger &n) {
-        *this = *this + n;
-        return *this;
-    }
-
-    const BigInteger& operator++() {
-        *this = *this + 1;
-        return *this;
-    }
-
-    BigInteger operator++(int) {
-        BigInteger ans(*this);
-        *this = *this + 1;
-        return ans;
-    }
-
-    BigInteger operator-() const {
-        BigInteger ans(*this);
-        if(ans != 0) {
-            ans.sign = !ans.sign;
-        }
-        return ans;
-    }
-
-    friend BigInteger operator-(const BigInteger &a, const BigInteger &b) {
-        if(!b.sign) {
-            return a + (-b);
-        }
-        if(!a.sign) {
-            return -((-a) + b);
-        }
-        if(a < b) {
-            return -(b - a);
-        }
-
-        BigInteger ans;
-        int carry = 0;
-        int aa, bb;
-        size_t lena = a.num.size();
-        size_t lenb = b.num.size();
-        size_t len = std::max(lena, lenb);
-        ans.num.clear();
-
-        for (size_t i = 0; i < len; ++i) {
-            aa = a.num[i];
-            if (i >= lenb) {
-                bb = 0;
-            } else {
-                bb = b.num[i];
-            }
-            ans.num.push_back((aa - bb - carry + BigInteger::BASE) % BigInteger::BASE);
-            if (aa < bb + carry) {
-                carry = 1;
-            } else {
-                carry = 0;
-            }
-        }
-     
-        ans.SetLength();
-        return ans;
-    }
-
-    const BigInteger& operator-=(const BigInteger &n) {
-        *this = *this - n;
-        return *this;
-    }
-
-    const BigInteger& operator--() {
-        *this = *this - 1;
-        return *this;
-    }
-
-    BigInteger operator--(int) {
-        BigInteger ans(*this);
-        *this = *this - 1;
-        return ans;
-    }
-
-    friend BigInteger operator*(const BigInteger &a, const BigInteger &b) {
-        size_t lena = a.num.size();
-        size_t lenb = b.num.size();
-        std::vector<long long> ansLL;
-        for (size_t i = 0; i < lena; ++i) {
-            for (size_t j = 0; j < lenb; ++j) {
-                if (i + j >= ansLL.size()) {
-                    ansLL.push_back((long long)a.num[i] * (long long)b.num[j]);
-                } else {
-                    ansLL[i + j] += (long long)a.num[i] * (long long)b.num[j];
-                }
-            }
-        }
-
-        while (ansLL.back() == 0 && ansLL.size() != 1) {
-            ansLL.pop_back();
-        }
-        size_t len = ansLL.size();
-        long long carry = 0;
-        long long tmp;
-        BigInteger ans;
-        ans.sign = (ansLL.size() == 1 && ansLL[0] == 0) || (a.sign == b.sign);
-        ans.num.clear();
-        for (size_t i = 0; i < len; ++i) {
-            tmp = ansLL[i];
-            ans.num.push_back((tmp + carry) % BigInteger::BASE);
-            carry = (tmp + carry) / BigInteger::BASE;
-        }
-        if (carry > 0) {
-            ans.num.push_back(carry);
-        }
-        ans.SetLength();
-        return ans;
-    }
-
-    const BigInteger& operator*=(const BigInteger &n) {
-        *this = *this * n;
-        return *this;
-    }
-
-    friend BigInteger operator/(const BigInteger &a, const BigInteger &b) {
-        BigInteger aa(a.abs());
-        BigInteger bb(b.abs());
-        if (aa < bb) {
-            return 0;
-        }
-        char *str = new char[aa.size() + 1];
-        memset(str, 0, sizeof(char) * (aa.size() + 1));
-        BigInteger tmp;
-        int lena = aa.length;
-        int lenb = bb.length;
-        for (int i = 0; i <= lena - lenb; ++i) {
-            tmp = bb.e(lena - lenb - i);
-            while(aa >= tmp) {
-                ++str[i];
-                aa = aa - tmp;
-            }
-            str[i] += '0';
-        }
-
-        BigInteger ans(str);
-        delete[] str;
-        ans.sign = (ans == 0 || a.sign == b.sign);
-        return ans;
-    }
-
-    const BigInteger& operator/=(const BigInteger &n) {
-        *this = *this / n;
-        return *this;
-    }
-
-    friend BigInteger operator%(const BigInteger &a, const BigInteger &b) {
-        return a - a / b * b;
-    }
-
-    const BigInteger& operator%=(const BigInteger &n) {
-        *this = *this - *this / n * n;
-        return *this;
-    }
-
-    friend bool operator<(const BigInteger &a, const BigInteger &b) {
-        if (a.sign && !b.sign) {
-            return false;
-        } else if (!a.sign && b.sign) {
-            return true;
-        } else if (a.sign && b.sign) {
-            if (a.length < b.length) {
-                return true;
-            } else if (a.length > b.length) {
-                return false;
-            } else {
-                size_t lena = a.num.size();
-                for (int i = lena - 1; i >= 0; --i) {
-                    if (a.num[i] < b.num[i]) {
-                        return true;
-                    } else if (a.num[i] > b.num[i]) {
-                        return false;
-                    }
-                }
-                return false;
-            }
-        } else {
-            return -b < -a;
-        }
-    }
-    
-    friend bool operator<=(const BigInteger &a, const BigInteger &b) {
-        return !(b < a);
-    }
-
-    friend bool operator>(const BigInteger &a, const BigInteger &b) {
-        return b < a;
-    }
-
-    friend bool operator>=(const BigInteger &a, const BigInteger &b) {
-        return !(a < b);
-    }
-
-    friend bool operator==(const BigInteger &a, const BigInteger &b) {
-        return !(a < b) && !(b < a);
-    }
-
-    friend bool operator!=(const BigInteger &a, const BigInteger &b) {
-        return (a < b) || (b < a);
-    }
-
-    friend bool operator||(const BigInteger &a, const BigInteger &b) {
-        return a != 0 || b != 0;
-    }
-
-    friend bool operator&&(const BigInteger &a, const BigInteger &b) {
-        return a != 0 && b != 0;
-    }
-
-    bool operator!() {
-        return *this == 0;
-    }
-
-    friend std::ostream& operator<<(std::ostream &out, const BigInteger &n) {
-         size_t len = n.num.size();
-        if(!n.sign) {
-            out << '-';
-        }
-        out << n.num.back();
-        for(int i = len - 2; i >= 0; --i) {
-            out << std::setw(BigInteger::WIDTH) << std::setfill('0') << n.num[i];
-        }
-        return out;
-    }
-
-    friend std::istream& operator>>(std::istream &in, BigInteger &n) {
-        std::string str;
-        in >> str;
-        size_t len = str.length();
-        size_t i, start = 0;
-        if(str[0] == '-') {
-            start = 1;
-        }
-        if(str[start] == '\0') {
-            return in;
-        }
-        for(i = start; i < len; ++i) {
-            if(str[i] < '0' || str[i] > '9') {
-                return in;
-            }
-        }
-        n = str.c_str();
-        return in;
-    }
-};
-
-
-enum class TokenType {
-    Int,
-    Float, 
-    OP_Plus,
-    OP_Minus,
-    OP_Mul,
-    OP_Div,
-    OP_Pow,
-    Lparen,
-    Rparen,
-    LSquare,
-    RSquare,
-    Identifier,
-    Keyword,
-    OP_Eq,
-    OP_Equal,
-    OP_Nequal,
-    OP_Lt,
-    OP_Gt,
-    OP_Lte,
-    OP_Gte,
-    Comma,
-    Arrow,
-    String,
-    NewLine,
-    Dot,
-    Colon,
-    LStart,
-    RStart,
-    Invilid,
-    __EOF__
-};
-
-const std::vector<TokenType> NUMERIC_TOKEN_TYPES { TokenType::Int, TokenType::Float };
-const std::vector<TokenType> FIRST_LEVEL_OPERANDS { TokenType::OP_Plus, TokenType::OP_Minus };
-const std::vector<TokenType> SECOND_LEVEL_OPERANDS { TokenType::OP_Mul, TokenType::OP_Div };
-const std::vector<TokenType> OPERANDS { TokenType::OP_Mul, TokenType::OP_Div, TokenType::OP_Plus, TokenType::OP_Minus };
-const std::vector<TokenType> THIRD_LEVEL_OPERAND { TokenType::OP_Pow };
-const std::vector<std::pair<TokenType, std::string>> LOGIC_OPERANDS { { TokenType::Keyword, "and" }, { TokenType::Keyword, "or" }, { TokenType::Keyword, "not" } };
-const std::vector<TokenType> COMPARE_OPERANDS { TokenType::OP_Equal, TokenType::OP_Nequal, TokenType::OP_Gt, TokenType::OP_Lt, TokenType::OP_Gte, TokenType::OP_Lte };
-
-
-inline std::wstring ToWideString(const std::string& input) {
-    try {
-        std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
-        return converter.from_bytes(input);
-    } catch (std::range_error &re) {
-        std::cerr << "Fatal: Input string '" << input << "' contains invilid character(s)" << std::endl;
-        return L"0";
-    }
-}
-
-inline std::string ToByteString(const std::wstring& input) {
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
-    return converter.to_bytes(input);
-}
-
-
-std::string DemangleSymbol(const char *symbol) {
-    #ifdef __linux__
-    const std::unique_ptr<char, decltype(&free)> demangled(abi::__cxa_demangle(symbol, 0, 0, 0), &free);
-    if (demangled) {
-        return demangled.get();
-    }
-    else {
-        return symbol;
-	}
-    #else
-        return std::string(symbol);
-    #endif
-}
-
-
-template<typename T>
-concept StringAble = requires(T t) {
-    t.ToString();
-};
-
-
-template<StringAble T>
-inline void PrintSequence(const std::vector<T> &seq) {
-    std::cout << "[";
-    for (int i = 0; i < seq.size(); i++) {
-        std::cout << seq[i].ToString();
-        if (i + 1 != seq.size()) {
-            std::cout << ", ";
-        }
-    }
-    std::cout << "]";
-}
-
-template<StringAble T>
-inline void PrintSequence(const std::vector<T *> &seq) {
-    std::cout << "[";
-    for (int i = 0; i < seq.size(); i++) {
-        std::cout << seq[i]->ToString();
-        if (i + 1 != seq.size()) {
-            std::cout << ", ";
-        }
-    }
-    std::cout << "]";
-}
-
-template<typename T>
-inline std::string StringifySequence(const std::vector<T *> &seq) {
-    std::string result = "[";
-    for (int i = 0; i < seq.size(); i++) {
-        result += seq[i]->ToString();
-        if (i + 1 != seq.size()) {
-            result += ", ";
-        }
-    }
-    result += "]";
-    return result;
-}
-
-inline std::string StringifyStringSequence(const std::vector<std::string> &seq) {
-    std::string result = "[";
-    for (int i = 0; i < seq.size(); i++) {
-        result += seq[i];
-        if (i + 1 != seq.size()) {
-            result += ", ";
-        }
-    }
-    result += "]";
-    return result;
-}
-
-
-struct Position {
-    int index, line, column;
-    std::string filename, fileContent;
-    Position(int idx, int ln, int col, const std::string &fn, const std::string &text) :
-    index(idx), line(ln), column(col), filename(fn), fileContent(text) {}
-    
-    inline Position *Advance(const std::wstring &ch = L"") {
-        this->index++;
-        this->column++;
-        if (ch == L"\n") {
-            this->line++;
-            this->column = 0;
-        }
-        return this;
-    }
-
-    inline Position *Copy() {
-        return new Position(this->index, this->line, this->column, this->filename, this->fileContent);
-    }
-
-    inline std::string ToString() {
-        return std::format("Position(line:{}, col:{}) [{}:{}]", this->line + 1, this->column, this->filename, this->index);
-    }
-};
-
-
-struct SymbolTable;
-struct NodeBase;
-class Interpreter;
-SymbolTable *globalSymbolTable;
-
-struct Context final {
-    std::string ctxLabel;
-    Context *parent;
-    Position *parentEntry;
-    SymbolTable *symbols;
-    SymbolTable *global;
-    SymbolTable *nonlocals;
-    std::vector<NodeBase *> deferNodes;
-    Interpreter *interpreter;
-    bool external;
-    Context *exFrame;
-
-    explicit Context(const std::string &ctxName, Context *parent = nullptr, Position *parentEntry = nullptr) : ctxLabel(ctxName),
-        parent(parent), parentEntry(parentEntry)
-    {
-        if (this->parent && this->parent->interpreter) {
-            this->interpreter = this->parent->interpreter;
-        }
-        this->SetGlobalSymbolTable(globalSymbolTable);
-    }
-
-    void SetGlobalSymbolTable(SymbolTable *st) {
-        this->global = st;
-    }
-    
-    inline void SetExternal(bool e) {
-        this->external = e;
-    }
-};
-
-struct Token {
-    void *value;
-    TokenType type;
-    Position *st;
-    Position *et;
-
-    Token() : value(nullptr), type(TokenType::Invilid) {}
-    explicit Token(TokenType t, void *v = nullptr, Position *st = nullptr, Position *et = nullptr) : 
-        type(t), value(v), st(st), et(et) {
-            if (st != nullptr) {
-                this->st = st->Copy();
-                this->et = st->Copy();
-                this->et->Advance();
-            }
-            if (et != nullptr) {
-                this->et = et->Copy();
-            }
-        }
-
-    inline std::string ToString() const {
-        auto tokenTypeName = TOKEN_TYPE_TAGS[static_cast<int>(this->type)];
-        if (this->value != nullptr) {
-            if (this->type == TokenType::Int) {
-                return std::format("{}: {} ({})", tokenTypeName, this->value, *(long *) this->value);
-            } else if (this->type == TokenType::Float) {
-                return std::format("{}: {} ({})", tokenTypeName, this->value, *(double *) this->value);
-            } else if (this->type == TokenType::Identifier || this->type == TokenType::Keyword) {
-                return std::format("{}: {} ('{}')", tokenTypeName, this->value, *(std::string *) this->value);
-            } else if (this->type == TokenType::String) {
-                return std::format("{}: {} ('{}')", tokenTypeName, this->value, *(std::string *) this->value);
-            }
-        }
-        return std::string(tokenTypeName);
-    }
-
-    template<typename VT>
-    bool Matches(TokenType tt, const VT &value) {
-        return this->type == tt && (*(VT *) this->value) == value;
-    }
-
-    bool Matches(TokenType tt) {
-        return this->type == tt;
-    }
-};
-
-using Tokens = std::vector<Token>;
-
-std::string SubReplace(const std::string &resource_str, const std::string &sub_str, const std::string &new_str) {
-    std::string dst_str = resource_str;
-    std::string::size_type pos = 0;
-
-    while((pos = dst_str.find(sub_str)) != std::string::npos) {
-        dst_str.replace(pos, sub_str.length(), new_str);
-    }
-    return dst_str;
-}
-
-static inline std::vector<std::string> Split(const std::string &str, const std::string &splitter) {
-    std::vector<std::string> tokens;
-    // if (str != splitter && str.length() >= splitter.length()) {
-    //     char *src = new char[str.length() + 1];
-    //     strcpy(src, str.c_str());
-
-    //     char *token = strtok(src, splitter.c_str());
-    //     tokens.push_back(std::string(token));
-    //     while (true) {
-    //         token = strtok(nullptr, splitter.c_str());
-    //         if (token == nullptr) {
-    //             break;
-    //         }
-    //         tokens.push_back(std::string(token));
-    //     }
-    //     return tokens;
-    // } else {
-    //     tokens.push_back(str);
-    //     return tokens;
-    // }
-    if (str != splitter && str.length() >= splitter.length()) {
-        std::wstring wsplitter = ToWideString(splitter);        
-        std::wstring wstr = ToWideString(str);
-        wstr += wsplitter;
-
-        std::size_t pos = wstr.find(wsplitter);
-        int step = wsplitter.length();
-
-        while (pos != wstr.npos) {
-            std::wstring temp = wstr.substr(0, pos);
-            tokens.emplace_back(ToByteString(temp));
-            wstr = wstr.substr(pos + step, wstr.length());
-            pos = wstr.find(wsplitter);
-        
-        }
-        return tokens;
-    } else {
-        tokens.push_back(str);
-        return tokens;
-    }
-}
-
-std::string Join(const std::vector<std::string> &tokens, const std::string &splitter) {
-    std::stringstream ss;
-    int index = 1;
-    for (const auto &token : tokens) {
-        ss << token;
-        if (index != tokens.size()) {
-            ss << splitter;
-        }
-        index++;
-    }
-    return ss.str();
-}
-
-
-
-class Error {
-public:
-    Error(const std::string &name, const std::string &details, Position *st = nullptr, Position *et = nullptr) 
-    : name(name), details(details), st(st), et(et) {}
- 
-    #define deprecated 
-    [[deprecated]] static std::string StringWithArrow(const std::string &s, Position *st, Position *et, int offset = 2, char ch = '^') {
-        if (st == nullptr || et == nullptr) {
-            return std::format("\n  {} (internal)", s);
-        }
-        std::string result;
-        int indexStart = std::max((int) s.rfind("\n", 0, st->index), 0);
-        int indexEnd = s.find("\n", indexStart + 1);
-        indexEnd = indexEnd < 0 ? s.length() : indexEnd;
-        int lineCount = et->line - st->line + 1;
-        
-        for (int line = 0; line < lineCount; line++) {
-            auto ln = s.substr(indexStart, indexEnd - indexStart);
-            auto columnStart = line == 0 ? st->column : 0;
-            auto columnEnd = line == lineCount - 1 ? et->column : ln.length() - 1;
-
-            result += ln + '\n';
-            result += std::string(columnStart + offset, ' ') + std::string(columnEnd - columnStart, ch);
-
-            indexStart = indexEnd;
-            indexEnd = s.find("\n", indexStart + 1);
-            indexEnd = indexEnd < 0 ? s.length() : indexEnd;
-        }
-        return SubReplace(result, "\t", "");
-    }
-
-    virtual std::string ToString() {
-        // Fix code line display
-        // auto content = Error::StringWithArrow(Split(this->st->fileContent, "\n")[this->st->line], this->st, this->et);
-        return std::format("File \"{}\", line {}\n  {}: {}", this->st->filename, this->st->line + 1, this->name, this->details);
-    }
-
-public:
-    std::string name;
-    std::string details;
-    Position *st;
-    Position *et;
-};
-
-struct Context;
-
-class IllegalCharacterError final : public Error {
-public:
-    IllegalCharacterError(const std::string &details, Position *st, Position *et) : 
-        Error("IllegalCharacterError", details, st, et) {}
-};
-
-class SyntaxError final : public Error {
-public:
-    SyntaxError(const std::string &details, Position *st, Position *et) : 
-        Error("SyntaxError", details, st, et) {}
-};
-
-class RuntimeError : public Error {
-public:
-    RuntimeError(const std::string &details, Position *st, Position *et, Context *ctx = nullptr) : 
-        Error("RuntimeError", details, st, et) {
-            this->ctx = ctx;
-        }
-    
-    RuntimeError(const std::string& errName, const std::string& details, Position *st, Position *et, Context *ctx = nullptr) :
-        Error(errName, details, st, et) {
-        this->ctx = ctx;
-    }
-
-    virtual std::string GenerateTraceBack() {
-        std::string result = "Stack Traceback:\n";
-        auto pos = this->st;
-        auto rt = this->ctx;
-        if (rt == nullptr || pos == nullptr) {
-            return "Stack Traceback:\n  [U] ?? (not avalible)";
-        }
-        while (rt != nullptr) {
-            // result += std::format("  at {}  [{}:{}] <+{}>\n", rt->ctxLabel, pos->filename, pos->line + 1, (void *) pos);
-            result += std::format("  at {}{}{} [{}{}{}:{}:{}]\n", CYAN, rt->ctxLabel, RESET, YELLOW, pos->filename, RESET, pos->line + 1, pos->column + 1);
-            pos = rt->parentEntry;
-            rt = rt->parent;
-        }
-        result = result.substr(0, result.length() - 1);
-
-        return result;
-    }
-
-    virtual std::string ToString() override {
-        // auto content = Error::StringWithArrow(Split(this->st->fileContent, "\n")[this->st->line], this->st, this->et);        
-        // Fix me: Error content display
-        auto basicErrorInfo = std::format("{}: {}", this->name, this->details);
-        auto traceback = this->GenerateTraceBack();
-        if (!this->st || !this->et) {
-            return std::format("{}{}{}\n {}", RED, basicErrorInfo, RESET, traceback);
-        }
-        try {
-            auto possibleSource = ToWideString(Split(this->st->fileContent, "\n")[this->st->line]);
-            std::wstringstream wss;
-            const auto red = ToWideString(RED);
-            const auto reset = ToWideString(RESET);
-            int col = 0;
-
-            for (auto c : possibleSource) {
-                if (col == this->st->column - 1) {
-                    wss << ToWideString(RED);
-                }
-
-                if (this->et->line == this->st->line && col == this->et->column) {
-                    wss << ToWideString(RESET);
-                }
-                wss << c;
-                col++;
-            }
-            possibleSource = wss.str() + reset;
-            return std::format("{}{}{}\n  (Possibly related source: `{}{}{}`)\n{}", RED, basicErrorInfo, RESET, BOLD_WHITE, ToByteString(possibleSource), RESET, traceback);    
-        } catch (std::exception &e) {
-            return std::format("{}{}{}\n  {}{}{}\n{}", RED, basicErrorInfo, RESET, BOLD_WHITE, "(Source is not avaliable)", RESET, traceback);
-        }
-    }
-
-    static std::string GetNativeCallStackInfo(bool demangle = true, bool colored = true) {
-    #ifdef __linux__
-        std::stringstream ss;
-        void* addresses[256];
-        const int n = backtrace(addresses, std::extent<decltype(addresses)>::value);
-        const std::unique_ptr<char*, decltype(&free)> symbols(backtrace_symbols(addresses, n), &free);
-        for (int i = 0; i < n; i++) {
-            char *symbol = symbols.get()[i];
-            char *end = symbol;
-
-            // demangle 
-            if (demangle) {
-                int p = 0;
-                int q = 0;
-                while (*end) {
-                    ++end;
-                }
-                while (end != symbol && *end != '+') {
-                    --end;
-                }
-                char *begin = end;
-                while (begin != symbol && *begin != '(') {
-                    --begin;
-                }
-
-                if (begin != symbol) {
-                    auto str1 = std::string(symbol, ++begin - symbol);
-                    *end++ = '\0';
-                    std::string result = str1 + DemangleSymbol(begin) + '+' + end;
-                    ss << "#" << i + 1 << ": " << result << std::endl;
-                }
-                else {
-                    ss << "#" << i + 1 << ": " << symbol << std::endl;
-                }
-            } else {
-                ss << "#" << i + 1 << ": " << symbol << std::endl;
-            }
-        }
-        
-        auto r = ss.str();
-        std::stringstream rs;
-        for (auto &&c : std::move(r)) {
-            rs << c;            
-            if (colored) {
-                if (c == '(') {
-                    rs << CYAN;
-                } else if (c == ')') {
-                    rs << RESET;
-                } else if (c == '[') {
-                    rs << GREEN;
-                } else if(c == ']') {
-                    rs << RESET;
-                }
-            } 
-        }
-        return rs.str();
-    #else 
-        return "[Platform not supported]";
-    #endif
-    }
-
-    inline Context *GetContext() {
-        return this->ctx;
-    }
-
-    inline void SetContext(Context *ctx) {
-        this->ctx = ctx;
-    }
-
-private:
-    Context *ctx;
-};
-
-class TypeError : public RuntimeError {
-public:
-    explicit TypeError(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) :
-        RuntimeError("TypeError", details, st, et, ctx) {}
-};
-
-class ValueError : public RuntimeError {
-public:
-    explicit ValueError(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) :
-        RuntimeError("ValueError", details, st, et, ctx) {}
-};
-
-class OSError : public RuntimeError {
-public:
-    explicit OSError(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) : 
-        RuntimeError("OSError", details, st, et, ctx) {}
-};
-
-class Panic : public RuntimeError {
-public:
-    explicit Panic(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) :
-        RuntimeError("Panic", details, st, et, ctx) {}
-};
-
-class AttributeError : public RuntimeError {
-public:
-    explicit AttributeError(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) :
-        RuntimeError("AttributeError", details, st, et, ctx) {}
-};
-
-class StopIteration : public RuntimeError {
-public:
-    explicit StopIteration() : StopIteration(nullptr, nullptr, nullptr) {}
-    explicit StopIteration(Position *st, Position *et, Context *ctx) :
-        RuntimeError("StopIteration", "",  st, et, ctx) {}
-};
-
-
-class Lexer final {
-public:
-    explicit Lexer(const std::string &filename, const std::wstring &t) : 
-    text(t), filename(filename), pos(new Position(-1, 0, -1, filename, ToByteString(text))) {
-        this->Advance();
-    }
-
-    static inline std::wstring CharAt(const std::wstring &s, unsigned index) {
-        return s.substr(index, 1);
-    }
-
-    template<typename T>    
-    static inline bool Contains(const std::vector<T> &c, const T &v) {
-        for (auto e : c) {
-            if (v == e) {
-                return true;
-            }
-        }
-        return false;
-    }
-
-    static inline long ParseInt(const std::string &numStr) {
-        std::istringstream is(numStr);
-        long num;
-        is >> num;
-        return num;
-    }
-
-    static inline std::pair<long, Error *> ParseIntWithError(const std::string &numStr, Position *st, Position *et) {
-        for (auto c : numStr) {
-            if (!isdigit(c)) {
-                return std::make_pair((long) 0, new Error(
-                    "ParseError",
-                    "Invilid characters in integer",
-                    st, et
-                ));
-            }
-        }
-        return std::make_pair(ParseInt(numStr), nullptr);
-    }
-
-    static inline std::pair<long, Error *> ParseFloatWithError(const std::string &numStr, Position *st, Position *et) {
-        for (auto c : numStr) {
-            if (!isdigit(c)) {
-                return std::make_pair((long) 0, new Error(
-                    "ParseError",
-                    "Invilid characters in a floating point number",
-                    st, et
-                ));
-            }
-        }
-        return std::make_pair(ParseFloat(numStr), nullptr);
-    }
-
-    static inline double ParseFloat(const std::string &numStr) {
-        std::istringstream is(numStr);
-        double num;
-        is >> num;
-        return num;
-    }
-
-    void Advance() {
-        this->pos->Advance(this->currentChar);
-        this->currentChar = this->pos->index < (int) this->text.length() ? Lexer::CharAt(this->text, this->pos->index) : ToWideString(EOF_);
-    }
-
-    Token MakeNumber() {
-        std::string numberString;
-        int dots = 0; // floating or integer
-        auto posStart = this->pos->Copy();
-
-
-        while (this->currentChar != ToWideString(EOF_) && (Lexer::Contains(DIGITS, ToByteString(this->currentChar)) || this->currentChar == L".")) {
-            if (this->currentChar == L".") {
-                if (dots == 1) {
-                    break;
-                }
-                dots++;
-                numberString += ".";
-            } else {
-                numberString += ToByteString(this->currentChar);
-            }
-            this->Advance();
-        }
-
-        if (dots == 0) {
-            auto v = new long;
-            *v = Lexer::ParseInt(numberString);
-            this->tokenValueRefs.push_back(v);
-            return Token(TokenType::Int, (void *) v, posStart, this->pos);
-        } else {
-            auto v = new double;
-            *v = Lexer::ParseFloat(numberString);
-            this->tokenValueRefs.push_back(v);
-            return Token(TokenType::Float, (void *) v, posStart, this->pos);
-        }
-    }
-
-    Token MakeIdentifier() {
-        std::wstring identifier;
-        auto posStart = this->pos->Copy();
-
-        // while (this->currentChar != EOFW_ && ((Lexer::Contains(LETTERS_WITH_DIGITS, ToByteString(this->currentChar))) || this->currentChar == L"_")) {
-        while (this->currentChar != EOFW_ && this->currentChar != L"\n" && !Lexer::Contains(Lexer::OP, ToByteString(this->currentChar)) && !Lexer::Contains(SPACES, ToByteString(this->currentChar))) {
-            identifier += this->currentChar;
-            this->Advance();
-        }
-
-        auto bs = ToByteString(identifier);
-        auto isKeyword = Lexer::Contains(KEYWORDS, bs);
-        auto identifierLabel = new std::string(bs);
-        return Token(isKeyword ? TokenType::Keyword : TokenType::Identifier, (void *) identifierLabel, posStart, this->pos);
-    }
-
-    std::pair<Token, Error *> MakeNeqToken() {
-        auto posStart = this->pos->Copy();
-        this->Advance();
-        if (this->currentChar == L"=") {
-            this->Advance();
-            return std::make_pair(Token(TokenType::OP_Nequal, nullptr, posStart, this->pos), nullptr);
-        }
-        this->Advance();
-        return std::make_pair(Token(TokenType::Invilid, nullptr, nullptr, nullptr), new SyntaxError("Expected '=' (after '!' as '!=')", posStart, this->pos));
-    }
-
-    Token MakeEquals() {
-        auto posStart = this->pos->Copy();
-        TokenType tt = TokenType::OP_Eq;
-        this->Advance();
-        if (this->currentChar == L"=") {
-            this->Advance();
-            tt = TokenType::OP_Equal;
-        }
-        return Token(tt, nullptr, posStart, this->pos);
-    }
-
-    Token MakeLtToken() {
-        auto posStart = this->pos->Copy();
-        TokenType tt = TokenType::OP_Lt;
-        this->Advance();
-        if (this->currentChar == L"=") {
-            this->Advance();
-            tt = TokenType::OP_Lte;
-        }
-        return Token(tt, nullptr, posStart, this->pos);
-    }
-
-    Token MakeGtToken() {
-        auto posStart = this->pos->Copy();
-        TokenType tt = TokenType::OP_Gt;
-        this->Advance();
-        if (this->currentChar == L"=") {
-            this->Advance();
-            tt = TokenType::OP_Gte;
-        }
-        return Token(tt, nullptr, posStart, this->pos);
-    }
-
-    Token MakeMinusOrArrowToken() {
-        auto ttype = TokenType::OP_Minus;
-        auto posStart = this->pos->Copy();
-        this->Advance();
-
-        if (this->currentChar == L">") {
-            this->Advance();
-            ttype = TokenType::Arrow;
-        }
-        return Token(ttype, nullptr, posStart, this->pos);
-    }
-
-    Token MakeString() {
-        std::string content;
-        auto posStart = this->pos->Copy();
-        bool escaped = false;
-        this->Advance();
-        /**/
-        if (this->currentChar == EOFW_) {
-              return Token(TokenType::Invilid);
-        }
-
-        while (this->currentChar != EOFW_ && (this->currentChar != L"'" || escaped)) {
-            auto wchar = ToByteString(this->currentChar);
-            if (escaped) {
-                if (ESCAPED_CHARACTERS.find(wchar) != ESCAPED_CHARACTERS.end()) {
-                    content += ESCAPED_CHARACTERS.at(wchar);
-                } else {
-                    content += wchar;
-                }
-            } else {
-                if (this->currentChar == L"\\") {
-                    escaped = true;
-                    this->Advance();
-                    continue;
-                } else {
-                    content += wchar;
-                }
-            }
-            this->Advance();
-            escaped = false;
-        }
-
-        if (escaped && content.size() == 0 || this->currentChar == EOFW_) {
-            return Token(TokenType::Invilid);
-        }
-        this->Advance();
-        auto str = new std::string(content);
-        return Token(TokenType::String, (void *) str, posStart, this->pos);
-    }
-
-    const std::vector<std::string> OP = {
-        " ", "%", "&", "|", "\\", "+", "-", "*", "/", "^", ":", "[", "]", "{", "}", "(", ")", "'", "=", ">", "<", "!", ",", ";", ".", "?", "#", "@", "\"", "~", "`"
-    };
-
-    std::pair<Tokens, Error*> MakeTokens() {
-        Tokens tokens;
-        while (this->currentChar != ToWideString(EOF_)) {
-            if (Lexer::Contains(SPACES, ToByteString(this->currentChar))) {
-                this->Advance();
-            } else if (Lexer::Contains(STATEMENT_SEPERATORS, ToByteString(this->currentChar))) {
-                tokens.push_back(Token(TokenType::NewLine, nullptr, this->pos));
-                this->Advance();
-            } else if (Lexer::Contains(DIGITS, ToByteString(this->currentChar))) {
-                tokens.push_back(this->MakeNumber());
-            // } else if (Lexer::Contains(LETTERS, ToByteString(this->currentChar)) || this->currentChar == L"_") {
-            } else if (!Lexer::Contains(DIGITS, ToByteString(this->currentChar)) && !Lexer::Contains(Lexer::OP, ToByteString(this->currentChar))) {
-                tokens.push_back(this->MakeIdentifier());
-            } else if (this->currentChar == L"+") {
-                tokens.push_back(Token(TokenType::OP_Plus, nullptr, this->pos));
-                this->Advance();
-            } else if (this->currentChar == L"-") {
-                tokens.push_back(this->MakeMinusOrArrowToken());
-            } else if (this->currentChar == L"*") {
-                tokens.push_back(Token(TokenType::OP_Mul, nullptr, this->pos));
-                this->Advance();            
-            } else if (this->currentChar == L"/") {
-                tokens.push_back(Token(TokenType::OP_Div, nullptr, this->pos));
-                this->Advance();        
-            } else if (this->currentChar == L"(") {
-                tokens.push_back(Token(TokenType::Lparen, nullptr, this->pos));
-                this->Advance();  
-            } else if (this->currentChar == L")") {
-                tokens.push_back(Token(TokenType::Rparen, nullptr, this->pos));
-                this->Advance();  
-            } else if (this->currentChar == L"[") {
-                tokens.push_back(Token(TokenType::LSquare, nullptr, this->pos));
-                this->Advance();  
-            }  else if (this->currentChar == L"]") {
-                tokens.push_back(Token(TokenType::RSquare, nullptr, this->pos));
-                this->Advance();  
-            } else if (this->currentChar == L"'") {
-                auto errorPos = this->pos->Copy();
-                auto tk = this->MakeString();
-                if (tk.type == TokenType::Invilid) {
-                    Tokens emptyTokens;
-                    return std::make_pair(emptyTokens, new SyntaxError("Mismatched `'` in string literal", errorPos, this->pos));
-                }
-                tokens.push_back(tk);
-            } else if (this->currentChar == L"=") {
-                // tokens.push_back(Token(TokenType::OP_Eq, nullptr, this->pos));
-                // this->Advance();
-                tokens.push_back(this->MakeEquals());
-            } else if (this->currentChar == L"<") {
-                tokens.push_back(this->MakeLtToken());
-            } else if (this->currentChar == L">") {
-                tokens.push_back(this->MakeGtToken());
-            } else if (this->currentChar == L"^") {
-                tokens.push_back(Token(TokenType::OP_Pow, nullptr, this->pos));
-                this->Advance();
-            } else if (this->currentChar == L"!") {
-                auto [token, error] = this->MakeNeqToken();
-                if (error != nullptr) {
-                    return std::make_pair(std::vector<Token>(), error);
-                }
-                tokens.push_back(token);
-            } else if (this->currentChar == L",") {
-                tokens.push_back(Token(TokenType::Comma, nullptr, this->pos));
-                this->Advance();
-            } else if (this->currentChar == L".") {
-                tokens.push_back(Token(TokenType::Dot, nullptr, this->pos));
-                this->Advance();
-            } else if (this->currentChar == L":") {
-                tokens.push_back(Token(TokenType::Colon, nullptr, this->pos));
-                this->Advance();
-            } else if (this->currentChar == L"{") {
-                tokens.push_back(Token(TokenType::LStart, nullptr, this->pos));
-                this->Advance();
-            } else if (this->currentChar == L"}") {
-                tokens.push_back(Token(TokenType::RStart, nullptr, this->pos));
-                this->Advance();
-            } else if (this->currentChar == L"\\") {
-                if (Lexer::CharAt(this->text, this->pos->index + 1) != L"\n") {
-                    return std::make_pair(Tokens(), new IllegalCharacterError(
-                        "Trailing characters after line continuation character",
-                        this->pos, this->pos
-                    ));
-                }
-                this->Advance();
-                this->Advance();
-            } else {
-                auto errorChar = this->currentChar;
-                auto errorPos = this->pos->Copy();
-                this->Advance();
-                Tokens emptyTokens;
-                return std::make_pair(emptyTokens, new IllegalCharacterError(std::format("Found unexpected \'{}\'", ToByteString(errorChar)), errorPos, this->pos));
-            }
-        }
-
-        tokens.push_back(Token(TokenType::__EOF__, nullptr, this->pos));
-        return std::make_pair(tokens, nullptr);
-    }
-
-    ~Lexer() {
-        // for (void *p : this->tokenValueRefs) {
-        //     delete p;
-        //     // free(p);
-        // }
-    }
-
-private:
-    std::wstring text;
-    std::wstring currentChar;
-    std::string filename;
-    Position *pos;
-    std::vector<void *> tokenValueRefs;
-};
-
-
-enum class NodeType {
-    Number,
-    Expression,
-    SingleExpression,
-    VarAccess,
-    VarAssign,
-    IfExpression,
-    ForExpression,
-    WhileExpression,
-    FunctionDefinition,
-    FunctionCall,
-    String,
-    List,
-    Return,
-    Break,
-    Continue,
-    Subscription,
-    Dictionary,
-    Attribution,
-    AdvancedVarAccess,
-    NewExpression,
-    AttributionCall,
-    SubscriptionCall,
-    NonlocalStatement,
-    Defer,
-    StructDefStmt,
-    Invilid
-};
-
-const std::vector<std::string> NODE_TYPE_TAGS { 
-    "Number", "Expression", "SingleExpression", 
-    "VarAccess", "VarAssign", "IfExpression", "ForExpression", "WhileExpression",
-    "FunctionDefinition", "FunctionCall",
-    "String", "List",
-    "Return", "Break", "Continue",
-    "Subscription",
-    "Dictionary", "Attribution", "AdvancedVarAccess", 
-    "NewExpression",
-    "AttributionCall", "SubscriptionCall",
-    "NonlocalStatement",
-    "Invilid" 
-};
-
-
-struct NodeBase {
-    NodeType nodeType;
-    NodeBase *left, *right;
-    Position *st, *et;
-
-    explicit NodeBase(NodeType tp, NodeBase *l, NodeBase *r) :
-        nodeType(tp), left(l), right(r), st(nullptr), et(nullptr) {}
-    explicit NodeBase(NodeType tp) : 
-        NodeBase(tp, nullptr, nullptr) {}    
-    explicit NodeBase() : 
-        NodeBase(NodeType::Invilid) {}
-    
-    virtual ~NodeBase() = default;
-
-    virtual inline std::string ToString() {
-        return std::format("<Node {} at {}>", NODE_TYPE_TAGS[static_cast<int>(this->nodeType)], static_cast<void *>(this));
-    }
-
-};
-
-struct NumberNode : public NodeBase {
-    Token numberToken;
-    explicit NumberNode(Token nt) : NodeBase(NodeType::Number), numberToken(nt) {
-        this->st = this->numberToken.st;
-        this->et = this->numberToken.et;
-    }
-
-    inline std::string ToString() override {
-        return std::format("Number({})", this->numberToken.ToString());
-    }
-};
-
-std::pair<Position *, Position *> GetPosition(NodeBase *node);
-struct BinaryOperationNode : public NodeBase {
-    Token binaryOperator;
-    
-    explicit BinaryOperationNode(NodeBase *lt, Token op, NodeBase *rt) : 
-        NodeBase(NodeType::Expression, lt, rt), binaryOperator(op) {
-            this->st = GetPosition(lt).first;
-            this->et = GetPosition(rt).second;
-        }
-    explicit BinaryOperationNode() = default;
-
-
-    inline std::string ToString() override {
-        auto ls = this->left == nullptr ? "null" : this->left->ToString();
-        auto rs = this->right == nullptr ? "null" : this->right->ToString();
-        return std::format("BinOp({}, {}, {})", ls, this->binaryOperator.ToString(), rs);
-    } 
-
-    inline std::string Representation() {
-        return "";
-    }
-
-    ~BinaryOperationNode() = default;
-};
-
-
-struct UnaryOperationNode : public NodeBase {
-    Token unaryOperator;
-    NodeBase *node;
-    explicit UnaryOperationNode(Token op, NodeBase *node) : unaryOperator(op), node(node), NodeBase(NodeType::SingleExpression) {
-        assert(node != nullptr);
-        this->st = this->unaryOperator.st;
-        this->et = GetPosition(node).second;
-    }
-
-    inline std::string ToString() override {
-        return std::format("UnaOp({}, {})", this->unaryOperator.ToString(), this->node->ToString());
-    }
-
-    inline std::string Representation() {
-        return "<UnaryOperation>";
-    }
-
-    ~UnaryOperationNode() = default;
-};
-
-
-struct VariableAssignNode : public NodeBase {
-    NodeBase *valueNode;
-    Token variableNameToken;
-    explicit VariableAssignNode(Token var, NodeBase *value) : variableNameToken(var), valueNode(value), NodeBase(NodeType::VarAssign) {
-        this->st = this->variableNameToken.st;
-        this->et = this->variableNameToken.et;
-    }
-};
-
-struct VariableAccessNode : public NodeBase {
-    Token variableNameToken;
-    explicit VariableAccessNode(Token var) : variableNameToken(var), NodeBase(NodeType::VarAccess) {
-        this->st = this->variableNameToken.st;
-        this->et = this->variableNameToken.et;
-    }
-};
-
-struct ListNode : public NodeBase {
-    bool isStatements;
-    
-    std::vector<NodeBase *> elements;
-    NodeBase *subscripting;
-    NodeBase *newVal;
-    explicit ListNode(const std::vector<NodeBase *> &elements, Position *st, Position *et) : elements(elements), NodeBase(NodeType::List) {
-        this->st = st;
-        this->et = et;
-        this->subscripting = nullptr;
-        this->newVal = nullptr;
-    }
-
-    explicit ListNode(const std::vector<NodeBase *> &elements, Position *st, Position *et, NodeBase *sub, NodeBase *newVal = nullptr) :
-        elements(elements), NodeBase(NodeType::List) {
-            this->st = st;
-            this->et = et;
-            this->subscripting = sub;
-            this->newVal = newVal;
-        }
-};
-
-struct StructDefStmtNode : public NodeBase {
-    Token structName;
-    std::vector<Token> args;
-
-    explicit StructDefStmtNode(Token sn, const std::vector<Token> &args = {}) : structName(sn), NodeBase(NodeType::StructDefStmt) {
-        this->st = sn.st;
-        this->et = sn.et;
-        this->args = args;
-    }
-};
-
-struct ParseResult final {
-    Error *err;
-    NodeBase *ast;
-    std::size_t advancedCount;
-    unsigned reverseCount;
-
-    explicit ParseResult() : err(nullptr), ast(nullptr), advancedCount(0), reverseCount(0) {}
-    NodeBase *Register(ParseResult *pr) {
-        this->advancedCount += pr->advancedCount;
-        if (pr->err != nullptr) {
-            this->err = pr->err;
-        }
-        return pr->ast;
-    }
-
-    void RegisterAdvance() {
-        this->advancedCount++;
-    }
-
-    NodeBase *Register(NodeBase *node) {
-        this->RegisterAdvance();
-        return node;
-    }
-
-    Token Register(Token tk) {
-        this->RegisterAdvance();
-        return tk;
-    }
-
-    NodeBase *TryRegister(ParseResult *res) {
-        if (res->err != nullptr) {
-            this->reverseCount = res->reverseCount;
-            this->advancedCount += res->advancedCount;
-            return nullptr;
-        }
-        return this->Register(res);
-    }
-
-    ParseResult *Success(NodeBase *node) {
-        this->ast = node;
-        return this;
-    }
-
-    ParseResult *Failure(Error *err) {
-        if (this->err == nullptr || this->advancedCount == 0) {
-            this->err = err;
-        }
-        return this;
-    }
-};
-
-
-struct IfExpressionNode final : public NodeBase {
-    std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>> cases;
-    std::pair<NodeBase *, bool> elseCase;
-    Position *st, *et;
-
-    explicit IfExpressionNode(std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>> &&cases, std::pair<NodeBase *, bool> elseCase)
-        : cases(cases), elseCase(elseCase), NodeBase(NodeType::IfExpression)
-    {
-        this->st = this->cases[0].first.first->st;
-        if (this->elseCase.first != nullptr) {
-            this->et = this->elseCase.first->et;
-        } else {
-            this->et = this->cases[this->cases.size() - 1].first.first->et;
-        }
-    }
-};
-
-struct WhileExpressionNode final : public NodeBase {
-    NodeBase *conditionNode, *body;
-    bool shouldReturnNull;
-    explicit WhileExpressionNode(NodeBase *cond, NodeBase *body, bool shouldReturnNull) 
-        : conditionNode(cond), body(body),shouldReturnNull(shouldReturnNull), NodeBase(NodeType::WhileExpression)
-    {
-        this->st = this->conditionNode->st;
-        this->et = this->body->et;
-    }
-};
-
-struct ForExpressionNode final : public NodeBase {
-    bool rangeBasedLoop;
-    NodeBase *stvNode, *etvNode, *stepvNode, *body;
-    NodeBase *range;
-    Token var;
-    bool shouldReturnNull;   
-    explicit ForExpressionNode(Token var, NodeBase *stvNode, NodeBase *etvNode, NodeBase *stepvNode, NodeBase *body, bool shouldReturnNull) 
-        : var(var), stvNode(stvNode), etvNode(etvNode), stepvNode(stepvNode), body(body), shouldReturnNull(shouldReturnNull), NodeBase(NodeType::ForExpression)
-    {
-        this->st = this->var.st;
-        this->et = this->body->et;
-        this->rangeBasedLoop = false;
-    }
-
-    explicit ForExpressionNode(Token var, NodeBase *range, NodeBase *body, bool shouldReturnNull)
-        : var(var), range(range), body(body), shouldReturnNull(shouldReturnNull), NodeBase(NodeType::ForExpression)
-    {
-        this->st = this->var.st;
-        this->et = this->body->et;
-        this->rangeBasedLoop = true;
-    }
-};
-
-struct NonlocalStatementNode : public NodeBase {
-    Token freeVar;
-
-    explicit NonlocalStatementNode(Token freeVar) : freeVar(freeVar), NodeBase(NodeType::NonlocalStatement) {
-        this->st = freeVar.st;
-        this->et = freeVar.et;
-    }
-};
-
-struct FunctionDefinitionNode final : public NodeBase {
-    Token fun;
-    Tokens parameters;
-    NodeBase *body;
-    std::vector<NonlocalStatementNode *> freeVars;
-    std::vector<NonlocalStatementNode *> cellVars;
-    bool shouldAutoReturn;
-    std::vector<NodeBase *> defers;
-
-    explicit FunctionDefinitionNode(Token fun, Tokens parameters, NodeBase *body, bool shouldAutoReturn) :
-        fun(fun), parameters(parameters), body(body), shouldAutoReturn(shouldAutoReturn),  NodeBase(NodeType::FunctionDefinition)
-    {
-        if (this->fun.type != TokenType::Invilid) {
-            this->st = this->fun.st;
-        } else if (this->parameters.size() > 0) {
-            this->st = this->parameters[0].st;
-        } else {
-            this->st = this->body->st;
-        }
-        this->et = this->body->et;
-    }
-
-    void SetClosure(const std::vector<NonlocalStatementNode *> &f) {
-        this->freeVars = f;
-    }
-
-    void SetCell(const std::vector<NonlocalStatementNode *> &c) {
-        this->cellVars = c;
-    }
-
-    explicit FunctionDefinitionNode(Tokens parameters, NodeBase *body) : FunctionDefinitionNode(Token(TokenType::Invilid), parameters, body, true)
-    {}
-};
-
-struct FunctionCallNode final : public NodeBase {
-    std::vector<NodeBase *> arguments;
-    NodeBase *target;
-    
-    explicit FunctionCallNode(NodeBase *target, std::vector<NodeBase *> arguments) :
-        arguments(arguments), target(target), NodeBase(NodeType::FunctionCall)
-    {
-        this->st = this->target->st;
-        if (this->arguments.size() > 0) {
-            this->et = this->arguments[this->arguments.size() - 1]->et;
-        } else {
-            this->et = this->target->et;
-        }
-    }
-};
-
-
-struct StringNode final : public NodeBase {
-    Token stringToken;
-    explicit StringNode(Token st) : NodeBase(NodeType::String), stringToken(st) {
-        this->st = this->stringToken.st;
-        this->et = this->stringToken.et;
-    }
-    
-    inline std::string ToString() override {
-        return std::format("String({})", this->stringToken.ToString());
-    }
-};
-
-struct ReturnStatementNode final : public NodeBase {
-    NodeBase *nodeToReturn;
-    explicit ReturnStatementNode(NodeBase *nodeToReturn, Position *st, Position *et) :
-        nodeToReturn(nodeToReturn), NodeBase(NodeType::Return) {
-        this->st = st;
-        this->et = et;
-    }
-};
-
-struct BreakStatementNode final : public NodeBase {
-    explicit BreakStatementNode(Position *st, Position *et) : NodeBase(NodeType::Break) {
-        this->st = st;
-        this->et = et;
-    }
-};
-
-struct ContinueStatementNode final : public NodeBase {
-    explicit ContinueStatementNode(Position *st, Position *et) : NodeBase(NodeType::Continue) {
-        this->st = st;
-        this->et = et;
-    }
-};
-
-struct SubscriptionNode final : public NodeBase {
-    NodeBase *index;
-    std::vector<NodeBase *> subIndexes;
-    std::map<int, std::vector<NodeBase *>> calls;
-    NodeBase *assignment;
-    NodeBase *target;
-    explicit SubscriptionNode(NodeBase *t, NodeBase *idxExpr, NodeBase *assignment = nullptr) :
-        target(t), index(idxExpr), assignment(assignment), NodeBase(NodeType::Subscription)
-    {
-        this->st = this->index->st;
-        if (this->assignment != nullptr) {
-            this->et = this->assignment->et;
-        } else {
-            this->et = this->index->et;
-        }
-    }
-
-    void AddSubIndex(NodeBase *nd) {
-        this->subIndexes.push_back(nd);
-    }
-
-    void SetCalls(const std::map<int, std::vector<NodeBase *>> &calls) {
-        this->calls = calls;
-    }
-};
-
-
-struct AttributionNode final : public NodeBase {
-    Token attr;
-    std::vector<Token> subAttrs;
-    std::map<int, NodeBase *> calls;
-    NodeBase *assignment;
-    NodeBase *target;
-
-    explicit AttributionNode(NodeBase *t, Token a, NodeBase *ass = nullptr) :
-        target(t), attr(a), assignment(ass), NodeBase(NodeType::Attribution) 
-    {
-        this->st = this->attr.st;
-        if (this->assignment != nullptr) {
-            this->et = this->assignment->et;
-        } else {
-            this->et = this->attr.et;
-        }
-    }
-
-    inline void SetCalls(const std::map<int, NodeBase *> &calls) {
-        this->calls = calls;
-    }
-
-    inline void SetSubAttrs(const std::vector<Token> &attrs) {
-        this->subAttrs = attrs;
-    }
-};
-
-struct AttributionCallNode final : public NodeBase {
-    FunctionCallNode *call;
-    explicit AttributionCallNode(FunctionCallNode *call) : call(call), NodeBase(NodeType::AttributionCall) {
-        this->st = this->call->st;
-        this->et = this->call->et;
-    }
-};
-
-struct SubscriptionCallNode final : public NodeBase {
-    std::vector<NodeBase *> arguments;
-    explicit SubscriptionCallNode(std::vector<NodeBase *> arguments, Position *st, Position *et) : arguments(arguments), NodeBase(NodeType::SubscriptionCall) {
-        this->st = st;
-        this->et = et;
-    }
-};
-
-struct AdvancedVarAccessNode : public NodeBase {
-    std::vector<NodeBase *> advancedAccess;
-
-    explicit AdvancedVarAccessNode(const std::vector<NodeBase *> &aa) :
-        advancedAccess(aa), NodeBase(NodeType::AdvancedVarAccess) 
-    {
-        this->st = this->advancedAccess[0]->st;
-        this->et = this->advancedAccess[this->advancedAccess.size() - 1]->et;
-    }
- };
-
-struct DictionaryNode : public NodeBase {
-    std::map<NodeBase *, NodeBase *> elements;
-    
-    explicit DictionaryNode(const std::map<NodeBase *, NodeBase *> &elements, Position *st, Position *et) 
-        : NodeBase(NodeType::Dictionary), elements(elements)
-    {
-        this->st = st;
-        this->et = et;
-    }
-};
-
-struct NewExprNode : public NodeBase {
-    NodeBase *newExpr;
-
-    explicit NewExprNode(NodeBase *newE) : newExpr(newE), NodeBase(NodeType::NewExpression) {
-        this->st = newE->st;
-        this->et = newE->et;
-    }
-};
-
-struct DeferNode : public NodeBase {
-    NodeBase *deferExpr;
-
-    explicit DeferNode(NodeBase *de, Position *st, Position *et) : NodeBase(NodeType::Defer) {
-        this->deferExpr = de;
-        this->st = st;
-        this->et = et;
-    }
-};
-
-
-std::pair<Position *, Position *> GetPosition(NodeBase *node) {
-    if (node->nodeType == NodeType::Number) {
-        return std::make_pair(dynamic_cast<NumberNode *>(node)->st, dynamic_cast<NumberNode *>(node)->et);
-    } else if (node->nodeType == NodeType::Expression) {
-        return std::make_pair(dynamic_cast<BinaryOperationNode *>(node)->st, dynamic_cast<BinaryOperationNode *>(node)->et);
-    } else if (node->nodeType == NodeType::SingleExpression) {
-        return std::make_pair(dynamic_cast<UnaryOperationNode *>(node)->st, dynamic_cast<UnaryOperationNode *>(node)->et);
-    } else if (node->nodeType == NodeType::VarAccess) {
-        return std::make_pair(dynamic_cast<VariableAccessNode *>(node)->st, dynamic_cast<VariableAccessNode *>(node)->et);
-    } else if (node->nodeType == NodeType::VarAssign) {
-        return std::make_pair(dynamic_cast<VariableAssignNode *>(node)->st, dynamic_cast<VariableAssignNode *>(node)->et);        
-    } else if (node->nodeType == NodeType::ForExpression) {
-        return std::make_pair(dynamic_cast<ForExpressionNode *>(node)->st, dynamic_cast<ForExpressionNode *>(node)->et);        
-    } else if (node->nodeType == NodeType::WhileExpression) {
-        return std::make_pair(dynamic_cast<WhileExpressionNode *>(node)->st, dynamic_cast<WhileExpressionNode *>(node)->et);        
-    } else if (node->nodeType == NodeType::IfExpression) {
-        return std::make_pair(dynamic_cast<IfExpressionNode *>(node)->st, dynamic_cast<IfExpressionNode *>(node)->et);        
-    } else if (node->nodeType == NodeType::FunctionCall) {
-        return std::make_pair(dynamic_cast<FunctionCallNode *>(node)->st, dynamic_cast<FunctionCallNode *>(node)->et);        
-    } else if (node->nodeType == NodeType::FunctionDefinition) {
-        return std::make_pair(dynamic_cast<FunctionDefinitionNode *>(node)->st, dynamic_cast<FunctionDefinitionNode *>(node)->et);        
-    } else if (node->nodeType == NodeType::String) {
-        return std::make_pair(dynamic_cast<StringNode *>(node)->st, dynamic_cast<StringNode *>(node)->et);        
-    } else if (node->nodeType == NodeType::Return) {
-        return std::make_pair(dynamic_cast<ReturnStatementNode *>(node)->st, dynamic_cast<ReturnStatementNode *>(node)->et);                
-    } else if (node->nodeType == NodeType::Break) {
-        return std::make_pair(dynamic_cast<BreakStatementNode *>(node)->st, dynamic_cast<BreakStatementNode *>(node)->et);                        
-    } else if (node->nodeType == NodeType::Continue) {
-        return std::make_pair(dynamic_cast<ContinueStatementNode *>(node)->st, dynamic_cast<ContinueStatementNode *>(node)->et);                                
-    } else if (node->nodeType == NodeType::Subscription) {
-        return std::make_pair(dynamic_cast<SubscriptionNode *>(node)->st, dynamic_cast<SubscriptionNode *>(node)->et);                                
-    } else if (node->nodeType == NodeType::Dictionary) {
-        return std::make_pair(dynamic_cast<DictionaryNode *>(node)->st, dynamic_cast<DictionaryNode *>(node)->et);                                        
-    } else if (node->nodeType == NodeType::Attribution) {
-        return std::make_pair(dynamic_cast<AttributionNode *>(node)->st, dynamic_cast<AttributionNode *>(node)->et);
-    } else if (node->nodeType == NodeType::AdvancedVarAccess) {
-        return std::make_pair(dynamic_cast<AdvancedVarAccessNode *>(node)->st, dynamic_cast<AdvancedVarAccessNode *>(node)->et);
-    } else if (node->nodeType == NodeType::NewExpression) {
-        return std::make_pair(dynamic_cast<NewExprNode *>(node)->st, dynamic_cast<NewExprNode *>(node)->et);
-    }
-    return std::make_pair(nullptr, nullptr);
-}
-
-
-class Parser final {
-public:
-    explicit Parser(Tokens tks) : tokenIndex(-1) {        
-        this->tokens = tks;
-        this->Advance();
-        this->functionLayers = 0;
-    }
-
-    Token Reverse(unsigned amount = 1) {
-        this->tokenIndex -= amount;
-        this->UpdateCurrentToken();
-        return this->currentToken;
-    }
-
-    Token Advance() {
-        this->tokenIndex++;
-        this->UpdateCurrentToken();
-        return this->currentToken;
-    }
-
-    void UpdateCurrentToken() {
-        if (this->tokenIndex < (int) this->tokens.size()) {
-            this->currentToken = this->tokens[this->tokenIndex];
-        }
-    }
-
-    ParseResult *Statement() {
-        auto result = new ParseResult;
-        auto posStart = this->currentToken.st->Copy();
-
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "return")) {
-            if (this->functionLayers == 0) {
-                return result->Failure(new SyntaxError(
-                    "'return' outside a user-defined function",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-            result->RegisterAdvance();
-            this->Advance();
-            auto returnExpression = result->TryRegister(this->Expr());
-            if (returnExpression == nullptr) {
-                this->Reverse(result->reverseCount);
-            }
-            return result->Success(new ReturnStatementNode(returnExpression, posStart, this->currentToken.et->Copy()));
-        }
-
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "nonlocal")) {
-            if (this->functionLayers < 2) {
-                return result->Failure(new SyntaxError(
-                    "'nonlocal' outside a closure function",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-
-            this->clousureLayer = this->functionLayers;
-            result->RegisterAdvance();
-            this->Advance();
-            if (this->currentToken.type != TokenType::Identifier) {
-                return result->Failure(new SyntaxError(
-                    "Nonlocal name must be a identifier",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-            auto nd = new NonlocalStatementNode(this->currentToken);
-            this->closureNodes[this->functionLayers].push_back(nd);
-            result->RegisterAdvance();
-            this->Advance();
-            return result->Success(nd);
-        } else if (this->currentToken.Matches<std::string>(TokenType::Keyword, "defer")) {
-            if (this->functionLayers == 0) {
-                return result->Failure(new SyntaxError(
-                    "'defer' outside a user-defined function",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-            result->RegisterAdvance();
-            this->Advance();
-
-            auto deferExpr = result->Register(this->Expr());
-            return result->Success(new DeferNode(deferExpr, posStart, this->currentToken.st));
-        } else if (this->currentToken.Matches<std::string>(TokenType::Keyword, "struct")) {
-            result->RegisterAdvance();
-            this->Advance();
-
-            auto sn = this->currentToken;
-            if (sn.type != TokenType::Identifier) {
-                return result->Failure(new SyntaxError(
-                    "`struct` requires an identifier",
-                    sn.st, sn.et
-                ));
-            }
-            result->RegisterAdvance();
-            this->Advance();
-            if (this->currentToken.type == TokenType::LSquare) {
-                result->RegisterAdvance();
-                this->Advance();
-                Tokens ctorParams;
-                if (this->currentToken.type == TokenType::RSquare) {
-                    return result->Failure(new SyntaxError(
-                        "Empty and explicitly constructor parameters list",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                if (this->currentToken.type != TokenType::Identifier) {
-                    return result->Failure(new SyntaxError(
-                        "Constructor parameters invalid",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                ctorParams.push_back(this->currentToken);
-                result->RegisterAdvance();
-                this->Advance();
-
-                while (this->currentToken.type == TokenType::Comma) {
-                    result->RegisterAdvance();
-                    this->Advance();
-                    if (this->currentToken.type != TokenType::Identifier) {
-                     return result->Failure(new SyntaxError(
-                        "Constructor parameters invalid",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                    }
-                    ctorParams.push_back(this->currentToken);
-                    result->RegisterAdvance();
-                    this->Advance();
-                }
-
-                if (this->currentToken.type != TokenType::RSquare) {
-                    return result->Failure(new SyntaxError(
-                        "'[' mismatched",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                result->RegisterAdvance();
-                this->Advance();
-                return result->Success(new StructDefStmtNode(sn, ctorParams));
-            } else {
-                return result->Success(new StructDefStmtNode(sn));
-            }
-        }
-
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "continue")) {
-            result->RegisterAdvance();
-            this->Advance();
-            return result->Success(new ContinueStatementNode(posStart, this->currentToken.et->Copy()));
-        }
-    
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "break")) {
-            result->RegisterAdvance();
-            this->Advance();
-            return result->Success(new BreakStatementNode(posStart, this->currentToken.et->Copy()));
-        }
-
-        auto expr = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            // return result->Failure(new SyntaxError(
-            //     "Invilid statement", this->currentToken.st, this->currentToken.et
-            // ));
-            return result;
-        }
-        return result->Success(expr);
-    }
-
-    ParseResult *Statements() {
-        auto result = new ParseResult;
-        std::vector<NodeBase *> statements;
-        auto posStart = this->currentToken.st->Copy();
-
-        while (this->currentToken.type == TokenType::NewLine) {
-            result->RegisterAdvance();
-            this->Advance();
-        }
-
-        auto statement = result->Register(this->Statement());
-        if (result->err != nullptr) {
-            return result;
-        }
-        statements.push_back(statement);
-        unsigned newLineCount = 0;
-        bool multiStatements = true;
-
-        while (true) {
-            newLineCount = 0;
-            while (this->currentToken.type == TokenType::NewLine) {
-                result->RegisterAdvance();
-                this->Advance();
-                newLineCount++;
-            }
-            if (newLineCount == 0) {
-                multiStatements = false;
-            }
-            if (!multiStatements) {
-                break;
-            }
-
-            auto statementNode = result->TryRegister(this->Statement());
-            if (statementNode == nullptr) {
-                this->Reverse(result->reverseCount);
-                multiStatements = false;
-                continue;
-            }
-            statements.push_back(statementNode);        
-        }
-
-        auto n = new ListNode(statements, posStart, this->currentToken.et->Copy());
-        n->isStatements = true;
-        return result->Success(n);
-    }
-
-    ParseResult *Factor() {
-        auto result = new ParseResult;
-        auto token = this->currentToken;
-
-        if (Lexer::Contains(FIRST_LEVEL_OPERANDS, token.type)) {
-            result->Register(this->Advance());
-            auto fac = result->Register(this->Factor());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(new UnaryOperationNode(token, fac));
-        }
-
-        return this->Power();
-    }
-
-    ParseResult *Power() {
-        return this->BinaryOperation(&Parser::FunctionCall, THIRD_LEVEL_OPERAND, &Parser::Factor);
-    }
-
-    ParseResult *FunctionCall() {
-        auto result = new ParseResult;
-        auto atomNode = result->Register(this->Atom());
-        if (result->err != nullptr) {
-            return result;
-        }
-        std::vector<NodeBase *> args;
-        if (this->currentToken.type == TokenType::Lparen) {
-            result->RegisterAdvance();
-            this->Advance();
-
-            if (this->currentToken.type == TokenType::Rparen) {
-                result->RegisterAdvance();
-                this->Advance();
-            } else {
-                args.push_back(result->Register(this->Expr()));
-                if (result->err != nullptr) {
-                    // return result->Failure(new SyntaxError(
-                    //     "Invilid function call",
-                    //     this->currentToken.st, this->currentToken.et
-                    // ));
-                    return result;
-                }
-
-                while (this->currentToken.type == TokenType::Comma) {
-                    result->RegisterAdvance();
-                    this->Advance();
-                    args.push_back(result->Register(this->Expr()));
-                    if (result->err != nullptr) {
-                        return result;
-                    }
-                }
-
-                if (this->currentToken.type != TokenType::Rparen) {
-                    return result->Failure(new SyntaxError(
-                        "Mismatched '(' while calling function (unfinished)",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-
-                result->RegisterAdvance();
-                this->Advance();
-            }
-
-            auto nd = new FunctionCallNode(atomNode, args);
-            NodeBase *_node;
-            if (this->currentToken.type == TokenType::Dot) {
-                _node = result->Register(this->Attribution(nd));
-                if (result->err != nullptr) {
-                    return result;
-                }
-            } else {
-                _node = nd;
-            }
-            return result->Success(_node);
-        }
-        return result->Success(atomNode);
-    }
-
-    // TODO: Attribute access after function call is invaild? f().a -> error [Temp solved]
-
-    ParseResult *Term() {
-        return this->BinaryOperation(&Parser::Factor, SECOND_LEVEL_OPERANDS);
-    }
-
-    ParseResult *ListSetItem() {
-        auto result = new ParseResult;
-        if (this->currentToken.type != TokenType::OP_Eq) {
-            return result->Failure(new SyntaxError(
-                "Expected '=' in list-setitem", 
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-         
-        result->RegisterAdvance();
-        this->Advance();
-        auto valueExpr = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            return result;
-        }
-        return result->Success(valueExpr);
-    }
-
-    std::pair<ParseResult *, NodeBase *> ListSubscription() {
-        auto result = new ParseResult;
-        if (this->currentToken.type != TokenType::LSquare) {
-            return std::make_pair(result->Failure(new SyntaxError(
-                "Expected '['", this->currentToken.st, this->currentToken.et
-            )), nullptr);
-        }
-
-        result->RegisterAdvance();
-        this->Advance();
-        auto subscriptionExpr = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            return std::make_pair(result, nullptr);
-        }
-    
-        if (this->currentToken.type != TokenType::RSquare) {
-            return std::make_pair(result->Failure(new SyntaxError(
-                "'[' mismatched in list-subsciption",
-                this->currentToken.st, this->currentToken.et
-            )), nullptr);
-        }
-        result->RegisterAdvance();
-        this->Advance();
-
-        if (this->currentToken.type == TokenType::OP_Eq) {
-            auto valueExpr = result->Register(this->ListSetItem());
-            if (result->err != nullptr) {
-                return std::make_pair(result, nullptr);
-            }
-            return std::make_pair(result->Success(subscriptionExpr), valueExpr);
-        } else {
-            return std::make_pair(result->Success(subscriptionExpr), nullptr);
-        }
-    }
-
-    ParseResult *List() {
-        auto result = new ParseResult;
-        std::vector<NodeBase *> elementNodes;
-        auto posStart = this->currentToken.st->Copy();
-        if (this->currentToken.type != TokenType::LSquare) {
-            return result->Failure(new SyntaxError(
-                "Expected '[' when declaring a list",
-                posStart, this->currentToken.et
-            ));
-        }
-
-        result->RegisterAdvance();
-        this->Advance();
-
-        if (this->currentToken.type == TokenType::RSquare) {
-            result->RegisterAdvance();
-            this->Advance();
-        } else {
-            elementNodes.push_back(result->Register(this->Expr()));
-            if (result->err != nullptr) {
-                return result->Failure(new SyntaxError(
-                    "Invilid list definition",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-
-            while (this->currentToken.type == TokenType::Comma) {
-                result->RegisterAdvance();
-                this->Advance();
-                elementNodes.push_back(result->Register(this->Expr()));
-                if (result->err != nullptr) {
-                    return result;
-                }
-            }
-
-            if (this->currentToken.type != TokenType::RSquare) {
-                return result->Failure(new SyntaxError(
-                    "Mismatched ']' while giving initalizations to a list (unfinished)",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-
-            result->RegisterAdvance();
-            this->Advance();
-        }
-
-        if (this->currentToken.type == TokenType::LSquare) {
-            auto [subsciptionExprWrapper, newValue] = this->ListSubscription();
-            if (subsciptionExprWrapper->err != nullptr) {
-                return result->Failure(subsciptionExprWrapper->err);
-            }
-            auto n = new ListNode(elementNodes, posStart, this->currentToken.et->Copy(), subsciptionExprWrapper->ast, newValue);
-            n->isStatements = false;
-            return result->Success(n);
-        } else {
-            auto n = new ListNode(elementNodes, posStart, this->currentToken.et->Copy());
-            n->isStatements = false;
-            return result->Success(n);
-        }
-    }
-
-    ParseResult *Dictionary() {
-        auto result = new ParseResult;
-        std::map<NodeBase *, NodeBase *> elementNodes;
-        NodeBase *currentKey = nullptr, *currentValue = nullptr;
-        auto posStart = this->currentToken.st->Copy();
-        if (this->currentToken.type != TokenType::LStart) {
-            return result->Failure(new SyntaxError(
-                "Expected '{' when declaring a dictionary",
-                posStart, this->currentToken.et
-            ));
-        }
-        result->RegisterAdvance();
-        this->Advance();
-    
-        if (this->currentToken.type == TokenType::RStart) {
-            result->RegisterAdvance();
-            this->Advance();
-        } else {
-            currentKey = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                // return result->Failure(new SyntaxError(
-                //     "Invilid dictionary definition",
-                //     this->currentToken.st, this->currentToken.et
-                // ));
-                return result;
-            }
-            if (this->currentToken.type != TokenType::Colon) {
-                return result->Failure(new SyntaxError(
-                    "Expected ':' to seperate key and value",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-            result->RegisterAdvance();
-            this->Advance();
-            currentValue = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            elementNodes.insert(std::make_pair(currentKey, currentValue));
-
-            while (this->currentToken.type == TokenType::Comma) {
-                result->RegisterAdvance();
-                this->Advance();
-                currentKey = result->Register(this->Expr());
-                if (result->err != nullptr) {
-                    return result;
-                }
-                if (this->currentToken.type != TokenType::Colon) {
-                    return result->Failure(new SyntaxError(
-                        "Expected ':' to seperate key and value",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                result->RegisterAdvance();
-                this->Advance();
-                currentValue = result->Register(this->Expr());
-                if (result->err != nullptr) {
-                    return result;
-                }
-                elementNodes.insert(std::make_pair(currentKey, currentValue));            
-            }
-
-            if (this->currentToken.type != TokenType::RStart) {
-                return result->Failure(new SyntaxError(
-                    "Mismatched '}' while initalizing a dictionary (unfinished)",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-
-            result->RegisterAdvance();
-            this->Advance();
-        }            
-        return result->Success(new DictionaryNode(elementNodes, posStart, this->currentToken.et->Copy()));
-    }
-
-    std::pair<std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>>, std::pair<ParseResult *, bool>> IfExprCases(const std::string &type) {
-        auto result = new ParseResult;
-        using CaseInfo = std::pair<std::pair<NodeBase *, NodeBase *>, bool>;
-        std::vector<CaseInfo> cases;
-        std::pair<ParseResult *, bool> elseCase;
-
-        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, type)) {
-            return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(new SyntaxError(
-                std::format("Expected '{}'", type), this->currentToken.st, this->currentToken.et
-            )), false));
-        }
-        result->RegisterAdvance();
-        this->Advance();
-
-        auto condition = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            return std::make_pair(decltype(cases)(), std::make_pair(result, false));
-        }
-
-        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "then")) {
-            return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(new SyntaxError(
-                "Expected 'then' in if-statement",
-                this->currentToken.st, this->currentToken.et
-            )), false));
-        }
-        result->RegisterAdvance();
-        this->Advance();
-
-        if (this->currentToken.type == TokenType::NewLine) {
-            result->RegisterAdvance();
-            auto statements = result->Register(this->Statements());
-            if (result->err != nullptr) {
-                return std::make_pair(decltype(cases)(), std::make_pair(result, false));
-            }
-
-            cases.push_back(std::make_pair(std::make_pair(condition, statements), true));
-
-            if (this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
-                result->RegisterAdvance();
-                this->Advance();
-            } else {
-                auto allCases = this->IfExprBOrC();
-                if (result->err != nullptr) {
-                    return std::make_pair(decltype(cases)(), std::make_pair(result, false));
-                }
-                auto newCases = allCases.first;
-                elseCase = allCases.second;
-                for (auto &&otherCases : newCases) {
-                    cases.push_back(otherCases);
-                }
-            }
-        } else {
-            auto statement = result->Register(this->Statement());
-            if (result->err != nullptr) {
-                return std::make_pair(decltype(cases)(), std::make_pair(result, false));
-            }
-            cases.push_back(std::make_pair(std::make_pair(condition, statement), false));
-
-            auto allCases = this->IfExprBOrC();
-            if (allCases.second.first != nullptr && allCases.second.first->err != nullptr) {
-                return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(allCases.second.first->err), false));
-            }
-            auto newCases = allCases.first;
-            elseCase = allCases.second;
-            for (auto &&otherCases : newCases) {
-                cases.push_back(otherCases);
-            }
-        }
-
-        return std::make_pair(cases, elseCase);
-    } 
-
-    std::pair<std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>>, std::pair<ParseResult *, bool>> IfExprB() {
-        return this->IfExprCases("elif"); 
-    }
-
-    std::pair<ParseResult *, bool> *IfExprC() {
-        auto result = new ParseResult;
-        std::pair<ParseResult *, bool> *elseCase = nullptr;
-
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "else")) {
-            result->RegisterAdvance();
-            this->Advance();
-
-            if (this->currentToken.type == TokenType::NewLine) {
-                result->RegisterAdvance();
-                this->Advance();
-
-                elseCase = new std::pair<ParseResult *, bool>;                
-                auto statements = result->Register(this->Statements());
-                if (result->err != nullptr) {
-                    *elseCase = std::make_pair(nullptr, false);
-                    return elseCase;
-                }
-                *elseCase = std::make_pair(result->Success(statements), true);
-
-                if (this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
-                    result->RegisterAdvance();
-                    this->Advance();
-                } else {
-                    elseCase = new std::pair<ParseResult *, bool>;               
-                    *elseCase = std::make_pair(result->Failure(new SyntaxError(
-                        "Expected 'end' after multi-line statement",
-                        this->currentToken.st, this->currentToken.et
-                    )), false);
-                    return elseCase;
-                }
-            } else {
-                auto statement = result->Register(this->Statement());
-                if (result->err != nullptr) {
-                    elseCase = new std::pair<ParseResult *, bool>;
-                    *elseCase = std::make_pair(result, false);
-                    return elseCase;
-                }
-                elseCase = new std::pair<ParseResult *, bool>;
-                *elseCase = std::make_pair(result->Success(statement), false);
-                return elseCase;
-            }
-        }
-        return elseCase;
-    }
-
-    std::pair<std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>>, std::pair<ParseResult *, bool>> IfExprBOrC() {
-        auto result = new ParseResult;
-        std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>> cases;
-        std::pair<ParseResult *, bool> elseCase;
-
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "elif")) {
-            auto allCases = this->IfExprB();
-            if (allCases.second.first) {
-                if (allCases.second.first->err != nullptr) {
-                    return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(allCases.second.first->err), false));
-                }
-            }
-            cases = allCases.first;
-            elseCase = allCases.second;
-        } else {
-            auto elseCase_ = this->IfExprC();
-            if (elseCase_ == nullptr) {
-                 return std::make_pair(cases, std::make_pair(result->Success(nullptr), false));
-            } else {
-                elseCase = *elseCase_;
-            }
-            if (elseCase.first != nullptr && elseCase.first->err != nullptr) {
-                return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(elseCase.first->err), false));
-            }
-        }
-        return std::make_pair(cases, elseCase);
-    }
-
-    ParseResult *IfExpr() {
-        auto result = new ParseResult;
-        auto ifExprSub = this->IfExprCases("if");
-        if (ifExprSub.second.first != nullptr && ifExprSub.second.first->err != nullptr) {
-            return result->Failure(ifExprSub.second.first->err);
-        }
-        // if (result->err != nullptr) {
-        //     return result;
-        // }
-        auto [cases, elseCase] = ifExprSub;
-        if (elseCase.first == nullptr) {
-            return result->Success(new IfExpressionNode(std::move(cases), std::make_pair(nullptr, false)));
-        }
-        return result->Success(new IfExpressionNode(std::move(cases), std::make_pair(elseCase.first->ast, elseCase.second)));
-    }
-
-    ParseResult *SubsciptiveAssignment() {
-        auto result = new ParseResult;
-        auto valueExpr = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            return result;
-        }
-        return result->Success(valueExpr);
-    }
-
-    ParseResult *Subscription(NodeBase *target) {
-        auto result = new ParseResult;
-        result->RegisterAdvance();
-        this->Advance();
-        
-        auto indexExpr = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            return result;
-        }
-
-        if (this->currentToken.type != TokenType::RSquare) {
-            return result->Failure(new SyntaxError(
-                "'[' mismatched",
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-        result->RegisterAdvance();
-        this->Advance();
-        std::map<int, std::vector<NodeBase *>> calls;
-        if (currentToken.type == TokenType::Lparen) {
-            result->RegisterAdvance();
-            this->Advance();
-            std::vector<NodeBase *> args;
-
-            if (this->currentToken.type == TokenType::Rparen) {
-                calls.insert(std::make_pair(0, args));
-                result->RegisterAdvance();
-                this->Advance();
-            } else {
-                auto arg = result->Register(this->Expr());
-                if (result->err != nullptr) {
-                    return result;
-                }
-                args.push_back(arg);
-
-                while (this->currentToken.type == TokenType::Comma) {
-                    result->RegisterAdvance();
-                    this->Advance();
-                    auto arg = result->Register(this->Expr());
-                    if (result->err != nullptr) {
-                        return result;
-                    }
-                    args.push_back(arg);
-                }
-
-                if (this->currentToken.type != TokenType::Rparen) {
-                    return result->Failure(new SyntaxError(
-                        "Mismatched ')' in function call",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                calls.insert(std::make_pair(0, args));
-                result->RegisterAdvance();
-                this->Advance();
-            }
-        }
-
-        std::vector<NodeBase *> subNodes;
-        int index = 1;
-        while (this->currentToken.type == TokenType::LSquare) {
-            result->RegisterAdvance();
-            this->Advance();
-            auto subNode = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            subNodes.push_back(subNode);
-            if (this->currentToken.type != TokenType::RSquare) {
-                return result->Failure(new SyntaxError(
-                    "'[' mismatched",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-            result->RegisterAdvance();
-            this->Advance();
-
-            if (currentToken.type == TokenType::Lparen) {
-                result->RegisterAdvance();
-                this->Advance();
-                std::vector<NodeBase *> args;
-
-                if (this->currentToken.type == TokenType::Rparen) {
-                    calls.insert(std::make_pair(index, args));
-                } else {
-                    auto arg = result->Register(this->Expr());
-                    if (result->err != nullptr) {
-                        return result;
-                    }
-                    args.push_back(arg);
-
-                    while (this->currentToken.type == TokenType::Comma) {
-                        result->RegisterAdvance();
-                        this->Advance();
-                        auto arg = result->Register(this->Expr());
-                        if (result->err != nullptr) {
-                            return result;
-                        }
-                        args.push_back(arg);
-                    }
-
-                    if (this->currentToken.type != TokenType::Rparen) {
-                        return result->Failure(new SyntaxError(
-                            "Mismatched ')' in function call",
-                            this->currentToken.st, this->currentToken.et
-                        ));
-                    }
-                    calls.insert(std::make_pair(index, args));
-                }
-                result->RegisterAdvance();
-                this->Advance();
-            }
-            index++;
-        }
-
-        // result->RegisterAdvance();
-        // this->Advance();
-
-        if (this->currentToken.type == TokenType::OP_Eq) {
-            result->RegisterAdvance();
-            this->Advance();
-            auto valueExpr = result->Register(this->SubsciptiveAssignment());
-            if (result->err != nullptr) {
-                return result;
-            }
-            auto sn = new SubscriptionNode(target, indexExpr, valueExpr);
-            for (auto node : subNodes) {
-                sn->AddSubIndex(node);
-            }
-            sn->SetCalls(calls);
-            return result->Success(sn);
-        }
-        auto sn = new SubscriptionNode(target, indexExpr);
-        for (auto node : subNodes) {
-            sn->AddSubIndex(node);
-        }
-        sn->SetCalls(calls);
-        return result->Success(sn);
-    }
-
-    ParseResult *Attribution(NodeBase *varAccess) {
-        auto result = new ParseResult;
-        result->RegisterAdvance();
-        this->Advance();
-        if (this->currentToken.type != TokenType::Identifier) {
-            return result->Failure(new SyntaxError(
-                "Expected an identifier", 
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-        auto attr = this->currentToken;
-        result->RegisterAdvance();
-        this->Advance();
-        std::vector<Token> attrs;
-        std::map<int, NodeBase *> calls;
-
-        int attributionIndex = 0;
-        while (this->currentToken.type == TokenType::Dot || this->currentToken.type == TokenType::Lparen) {
-
-            if (this->currentToken.type == TokenType::Lparen) {
-                this->Reverse();
-                auto token = this->currentToken;
-                result->RegisterAdvance();
-                this->Advance();
-                result->RegisterAdvance();
-                this->Advance();
-                std::vector<NodeBase *> args;
-
-                if (this->currentToken.type == TokenType::Rparen) {
-                    result->RegisterAdvance();
-                    this->Advance();
-                } else {
-                    args.push_back(result->Register(this->Expr()));
-                    if (result->err != nullptr) {
-                        // return result->Failure(new SyntaxError(
-                        //     "Invilid function call",
-                        //     this->currentToken.st, this->currentToken.et
-                        // ));
-                        return result;
-                    }
-    
-                    while (this->currentToken.type == TokenType::Comma) {
-                        result->RegisterAdvance();
-                        this->Advance();
-                        args.push_back(result->Register(this->Expr()));
-                        if (result->err != nullptr) {
-                            return result;
-                        }
-                    }
-    
-                    if (this->currentToken.type != TokenType::Rparen) {
-                        return result->Failure(new SyntaxError(
-                            "Mismatched '(' while calling function (unfinished)",
-                            this->currentToken.st, this->currentToken.et
-                        ));
-                    }
-    
-                    result->RegisterAdvance();
-                    this->Advance();
-                }
-                calls.insert(std::make_pair(
-                    attributionIndex,
-                    new AttributionCallNode(new FunctionCallNode(new VariableAccessNode(token), args))
-                ));
-            } else {
-                result->RegisterAdvance();
-                this->Advance();
-
-                if (this->currentToken.type == TokenType::Identifier) {
-                    attrs.push_back(this->currentToken);
-                } else {
-                    return result->Failure(new SyntaxError(
-                        "Invilid attribute access", 
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                result->RegisterAdvance();
-                this->Advance();
-                attributionIndex++;            
-            }
-        }
-
-        if (this->currentToken.type == TokenType::OP_Eq) {
-            result->RegisterAdvance();
-            this->Advance();
-            auto assExpr = result->Register(this->AttributionAssignment());
-            if (result->err != nullptr) {
-                return result;
-            } 
-            auto an = new AttributionNode(varAccess, attr, assExpr);
-            an->SetCalls(calls);
-            if (attrs.size() > 0) {
-                an->SetSubAttrs(attrs);
-            }
-            return result->Success(an);
-        }
-        auto an = new AttributionNode(varAccess, attr);
-        an->SetCalls(calls);
-        if (attrs.size() > 0) {
-            an->SetSubAttrs(attrs);
-        }
-        return result->Success(an);
-    }
-
-    ParseResult *AttributionAssignment() {
-        auto result = new ParseResult;
-        auto valueExpr = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            return result;
-        }
-        return result->Success(valueExpr);
-    }
-
-    ParseResult *Atom() {
-        auto result = new ParseResult;
-        auto token = this->currentToken;
-
-        if (Lexer::Contains(NUMERIC_TOKEN_TYPES, token.type)) {
-            result->Register(this->Advance());
-            return result->Success(dynamic_cast<NodeBase *>(new NumberNode(token)));
-        } else if (token.type == TokenType::String) {
-            result->RegisterAdvance();
-            this->Advance();
-            return result->Success(new StringNode(token));
-        } else if (token.type == TokenType::Identifier) {
-            result->Register(this->Advance());
-            std::vector<NodeBase *> varSubAccess;
-            NodeBase *prev = new VariableAccessNode(token);
-            while (this->currentToken.type == TokenType::LSquare || this->currentToken.type == TokenType::Dot) {
-                if (this->currentToken.type == TokenType::LSquare) {
-                    auto subNode = result->Register(this->Subscription(prev));
-                    if (result->err != nullptr) {
-                        return result;
-                    } 
-                    prev = subNode;
-                    varSubAccess.push_back(subNode);
-                } else if (this->currentToken.type == TokenType::Dot) {
-                    auto subNode = result->Register(this->Attribution(prev));
-                    if (result->err != nullptr) {
-                        return result;
-                    }
-                    prev = subNode;
-                    varSubAccess.push_back(subNode);
-                }
-            }
-            if (varSubAccess.size() > 0) {
-                return result->Success(new AdvancedVarAccessNode(varSubAccess));
-            }
-            
-            return result->Success(new VariableAccessNode(token));
-        } else if (token.type == TokenType::Lparen) {
-            result->Register(this->Advance());
-            auto expr = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            if (this->currentToken.type == TokenType::Rparen) {
-                result->Register(this->Advance());
-                return result->Success(expr);
-            } else {
-                return result->Failure(new SyntaxError(
-                    "Expected ')'",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-        } else if (token.type == TokenType::LSquare) {
-            auto list = result->Register(this->List());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(list);
-        } else if (token.type == TokenType::LStart) {
-            auto dict = result->Register(this->Dictionary());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(dict);
-        } else if (token.Matches<std::string>(TokenType::Keyword, "if")) {
-            auto ifExpression = result->Register(this->IfExpr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(ifExpression);
-        } else if (token.Matches<std::string>(TokenType::Keyword, "for")) {
-            auto forExpression = result->Register(this->ForExpr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(forExpression);
-        } else if (token.Matches<std::string>(TokenType::Keyword, "while")) {
-            auto whileExpression = result->Register(this->WhileExpr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(whileExpression);
-        } else if (token.Matches<std::string>(TokenType::Keyword, "function")) {
-            auto functionDefinition = result->Register(this->FunctionDefinition());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(functionDefinition);
-        } else if (token.Matches<std::string>(TokenType::Keyword, "new")) {
-            auto newExpr = result->Register(this->NewExpr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(newExpr);
-        } else if (token.type == TokenType::__EOF__ && this->RealSize() == 1) {
-            return result->Success(new ListNode({}, this->currentToken.st, this->currentToken.et));
-        }
-
-        return result->Failure(new SyntaxError(
-            "Invilid syntax", token.st, token.et
-        ));
-    }
-
-    inline unsigned RealSize() {
-        unsigned size = 0;
-        for (auto &tk : this->tokens) {
-            size += (int) (tk.type != TokenType::NewLine);
-        }
-        return size;
-    }
-
-    ParseResult *NewExpr() {
-        auto result = new ParseResult;
-        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "new")) {
-            return result->Failure(new SyntaxError("Expected 'new'", this->currentToken.st, this->currentToken.et));
-        }
-        result->RegisterAdvance();
-        this->Advance();
-
-        auto newExpr = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            return result;
-        }
-        return result->Success(new NewExprNode(newExpr));
-    }
-
-    ParseResult *ForExpr() {
-        auto result = new ParseResult;
-        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "for")) {
-            return result->Failure(new SyntaxError(
-                "Expected 'for'",
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-
-        result->RegisterAdvance();
-        this->Advance();
-
-        if (this->currentToken.type != TokenType::Identifier) {
-            return result->Failure(new SyntaxError(
-                "Expected an identifier in for-statement",
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-
-        auto loopVariable = this->currentToken;
-        result->RegisterAdvance();
-        this->Advance();
-
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "in")) {
-            result->RegisterAdvance();
-            this->Advance();
-
-            auto range = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                return result;
-            }
-
-            if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "then")) {
-                return result->Failure(new SyntaxError(
-                    "Expected 'then' after identifier in range-based for-loop",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-            result->RegisterAdvance();
-            this->Advance();
-
-            if (this->currentToken.type == TokenType::NewLine) {
-                result->RegisterAdvance();
-                this->Advance();
-
-                auto body = result->Register(this->Statements());
-                if (result->err != nullptr) {
-                    return result;
-                }
-
-                if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
-                    return result->Failure(new SyntaxError(
-                        "Expected 'end' after multi-line statement",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                result->RegisterAdvance();
-                this->Advance();
-
-                return result->Success(new ForExpressionNode(
-                    loopVariable, range, body, true
-                ));
-            }
-
-            auto body = result->Register(this->Statement());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(new ForExpressionNode(
-                loopVariable, range, body, false
-            ));
-
-        } else if (this->currentToken.type == TokenType::OP_Eq) {
-            result->RegisterAdvance();
-            this->Advance();
-
-            auto startValue = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                return result;
-            }
-
-            if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "to")) {
-                return result->Failure(new SyntaxError(
-                    "Expected 'to' after the start of the initial expression in for-statement",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-
-            result->RegisterAdvance();
-            this->Advance();
-            auto endValue = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                return result;
-            }
-
-            NodeBase *stepValue = nullptr;
-            if (this->currentToken.Matches<std::string>(TokenType::Keyword, "step")) {
-                result->RegisterAdvance();
-                this->Advance();
-
-                stepValue = result->Register(this->Expr());
-                if (result->err != nullptr) {
-                    return result;
-                }
-            }
-
-            if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "then")) {
-                return result->Failure(new SyntaxError(
-                    "Expected 'then' after the end of the initial expression or 'step' in for-statement",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-            result->RegisterAdvance();
-            this->Advance();
-
-            if (this->currentToken.type == TokenType::NewLine) {
-                result->RegisterAdvance();
-                this->Advance();
-
-                auto body = result->Register(this->Statements());
-                if (result->err != nullptr) {
-                    return result;
-                }
-
-                if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
-                    return result->Failure(new SyntaxError(
-                        "Expected 'end' after multi-line statement",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                result->RegisterAdvance();
-                this->Advance();
-
-                return result->Success(new ForExpressionNode(
-                    loopVariable, startValue, endValue, stepValue, body, true
-                ));
-            }
-
-            auto body = result->Register(this->Statement());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(new ForExpressionNode(
-                loopVariable, startValue, endValue, stepValue, body, false
-            ));
-        } else {
-            return result->Failure(new SyntaxError(
-                "Expected '=' (initialization for loop var) or 'in' (range-based loop) in for-stmt",
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-    }
-
-    ParseResult *WhileExpr() {
-        auto result = new ParseResult;
-
-        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "while")) {
-            return result->Failure(new SyntaxError(
-                "Expected 'while'",
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-
-        result->RegisterAdvance();
-        this->Advance();
-        auto condition = result->Register(this->Expr());
-        if (result->err != nullptr) {
-            return result;
-        }
-
-        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "then")) {
-            return result->Failure(new SyntaxError(
-                "Expected 'then' after condition expression of while-statement",
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-
-        result->RegisterAdvance();
-        this->Advance();
-
-         if (this->currentToken.type == TokenType::NewLine) {
-            result->RegisterAdvance();
-            this->Advance();
-
-            auto body = result->Register(this->Statements());
-            if (result->err != nullptr) {
-                return result;
-            }
-
-            if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
-                return result->Failure(new SyntaxError(
-                    "Expected 'end' after multi-line statement",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-            result->RegisterAdvance();
-            this->Advance();
-
-            return result->Success(new WhileExpressionNode(condition, body, true));
-         }
-
-        auto body = result->Register(this->Statement());
-        if (result->err != nullptr) {
-            return result;
-        }
-        return result->Success(new WhileExpressionNode(condition, body, false));
-    }
-
-    ParseResult *CompExpr() {
-        auto result = new ParseResult;
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "not")) {
-            auto opToken = this->currentToken;
-            result->RegisterAdvance();
-            this->Advance();
-
-            auto node = result->Register(this->CompExpr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(new UnaryOperationNode(opToken, node));
-        }
-
-        auto node = result->Register(this->BinaryOperation(&Parser::ArithExpr, COMPARE_OPERANDS));
-        if (result->err != nullptr) {
-            return result;
-        }
-        return result->Success(node);
-    }
-
-    ParseResult *ArithExpr() {
-        return this->BinaryOperation(&Parser::Term, FIRST_LEVEL_OPERANDS);
-    }
-
-    ParseResult *Expr() {
-        auto result = new ParseResult;
-        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "var")) {
-            result->Register(this->Advance());
-            if (this->currentToken.type != TokenType::Identifier) {
-                return result->Failure(new SyntaxError(
-                    "Expected an identifier",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-
-            auto variableName = this->currentToken;
-            result->Register(this->Advance());
-
-            if (this->currentToken.type != TokenType::OP_Eq) {
-                return result->Failure(new SyntaxError(
-                    "Expected '='",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-
-            result->Register(this->Advance());
-            auto expResult = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            return result->Success(new VariableAssignNode(variableName, expResult));
-        }
-
-        auto node = result->Register(this->BinaryOperation(&Parser::CompExpr, LOGIC_OPERANDS));
-        if (result->err != nullptr) {
-            return result;
-        }
-        return result->Success(node);
-    }
-
-    template<typename T>
-    ParseResult *BinaryOperation(T func, std::vector<TokenType> validTokenTypes, T rightFunc = nullptr) {
-        if (rightFunc == nullptr) {
-            rightFunc = func;
-        }
-        auto result = new ParseResult;
-        auto leftNode = result->Register((this->*func)());
-        if (result->err != nullptr) {
-            return result;
-        }
-
-        while (Lexer::Contains(validTokenTypes, this->currentToken.type)) {
-            auto operationToken = this->currentToken;
-            result->Register(this->Advance());
-            auto rightNode = result->Register((this->*rightFunc)());
-            if (result->err != nullptr) {
-                return result;
-            }
-            leftNode = dynamic_cast<NodeBase *>(
-                new BinaryOperationNode(leftNode, operationToken, rightNode)
-            );
-        }
-        // return leftNode->nodeType == NodeType::Expression ?
-        //     dynamic_cast<BinaryOperationNode *>(leftNode) : dynamic_cast<NumberNode *>(leftNode);
-        return result->Success(leftNode);
-    }
-
-    template<typename T>
-    // Only for use to check keywords
-    ParseResult *BinaryOperation(T func, std::vector<std::pair<TokenType, std::string>> validTokens, T rightFunc = nullptr) {
-        if (rightFunc == nullptr) {
-            rightFunc = func;
-        }
-        auto result = new ParseResult;
-        auto leftNode = result->Register((this->*func)());
-        if (result->err != nullptr) {
-            return result;
-        }
-    
-        while (this->currentToken.value != nullptr && this->currentToken.type == TokenType::Keyword && Lexer::Contains(validTokens, std::make_pair(this->currentToken.type, *(std::string *) this->currentToken.value))) {
-            auto operationToken = this->currentToken;
-            result->Register(this->Advance());
-            auto rightNode = result->Register((this->*rightFunc)());
-            if (result->err != nullptr) {
-                return result;
-            }
-            leftNode = dynamic_cast<NodeBase *>(
-                new BinaryOperationNode(leftNode, operationToken, rightNode)
-            );
-        }
-        // return leftNode->nodeType == NodeType::Expression ?
-        //     dynamic_cast<BinaryOperationNode *>(leftNode) : dynamic_cast<NumberNode *>(leftNode);
-        return result->Success(leftNode);
-    }
-
-    ParseResult *FunctionDefinition() {
-        auto result = new ParseResult;
-        // deprecated:  this->insideAFunction = true;
-        this->functionLayers++;
-        this->closureNodes.insert(std::make_pair(this->functionLayers, std::vector<NonlocalStatementNode *>()));
-        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "function")) {
-            return result->Failure(new SyntaxError(
-                "Expected 'function'", this->currentToken.st, this->currentToken.et
-            ));
-        }
-
-        result->RegisterAdvance();
-        this->Advance();
-        Token funcNameToken;
-        if (this->currentToken.type == TokenType::Identifier) {
-            funcNameToken = this->currentToken;
-            result->RegisterAdvance();
-            this->Advance();
-
-            if (this->currentToken.type != TokenType::Lparen) {
-                return result->Failure(new SyntaxError(
-                    "Expected '(' after function name",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-        } else {
-            funcNameToken = Token(TokenType::Invilid);
-             if (this->currentToken.type != TokenType::Lparen) {
-                return result->Failure(new SyntaxError(
-                    "Expected an identifier or '(' after 'function'",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-        }
-
-        result->RegisterAdvance();
-        this->Advance();
-        Tokens args;
-
-        if (this->currentToken.type == TokenType::Identifier) {
-            args.push_back(this->currentToken);
-            result->RegisterAdvance();
-            this->Advance();
-
-            while (this->currentToken.type == TokenType::Comma) {
-                result->RegisterAdvance();
-                this->Advance();
-
-                if (this->currentToken.type != TokenType::Identifier) {
-                    return result->Failure(new SyntaxError(
-                        "Expected an identifier after ',' in parameter list",
-                        this->currentToken.st, this->currentToken.et
-                    ));
-                }
-                args.push_back(this->currentToken);
-                result->RegisterAdvance();
-                this->Advance();
-            }
-
-            if (this->currentToken.type != TokenType::Rparen) {
-                return result->Failure(new SyntaxError(
-                    "Mismatched '(' found in the end of the parameter list (unfinished)",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-        } else {
-            if (this->currentToken.type != TokenType::Rparen) {
-                return result->Failure(new SyntaxError(
-                    "Expected ')'",
-                    this->currentToken.st, this->currentToken.et
-                ));
-            }
-        }
-        
-        result->RegisterAdvance();
-        this->Advance();
-        if (this->currentToken.type == TokenType::Arrow) {
-            result->RegisterAdvance();
-            this->Advance();
-    
-            auto bodyNode = result->Register(this->Expr());
-            if (result->err != nullptr) {
-                return result;
-            }
-            auto fd = new FunctionDefinitionNode(funcNameToken, args, bodyNode, true);
-            this->functionLayers--;
-            return result->Success(fd);
-        }
-
-        if (this->currentToken.type != TokenType::NewLine) {
-            return result->Failure(new SyntaxError(
-                    "Expected '->' or new-lines after parameter list in function definition",
-                    this->currentToken.st, this->currentToken.et
-            ));
-        }
-
-        result->RegisterAdvance();
-        this->Advance();
-
-        auto body = result->Register(this->Statements());
-        if (result->err != nullptr) {
-            return result;
-        }
-
-        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
-            return result->Failure(new SyntaxError(
-                "Expected 'end' after multi-line statement",
-                this->currentToken.st, this->currentToken.et
-            ));
-        }
-        result->RegisterAdvance();
-        this->Advance();
-
-        assert(functionLayers > 0);
-        auto fsd = new FunctionDefinitionNode(funcNameToken, args, body, false);
-        
-        if (this->functionLayers == this->closureNodes.size()) {
-            fsd->SetClosure(this->closureNodes[this->functionLayers]);
-            fsd->SetCell({});
-        } else if (this->functionLayers == 1) {
-            if (closureNodes.find(2) != closureNodes.end()) {
-                fsd->SetCell(this->closureNodes[2]);
-            } else {
-                fsd->SetCell({});
-            }
-            fsd->SetClosure({});
-        } else {
-            fsd->SetClosure(this->closureNodes[this->functionLayers]);
-            fsd->SetCell(this->closureNodes[this->functionLayers + 1]);
-        }
-
-        this->functionLayers--;
-        return result->Success(fsd);
-    }
-
-    ParseResult *Parse() {
-        auto result = this->Statements();
-        if (result->err == nullptr && this->currentToken.type != TokenType::__EOF__) {
-            return result->Failure(new SyntaxError("Unexpected end of input", this->currentToken.st, this->currentToken.et));
-        }
-        return result;
-    }
-
-private:
-    Token currentToken;
-    Tokens tokens;
-    int tokenIndex;
-    bool insideAFunction; // deprecated
-    int functionLayers;
-    int clousureLayer;
-    std::map<int, std::vector<NonlocalStatementNode *>> closureNodes;
-};
-
-
-enum class NumberType { Int, Float };
-struct RuntimeResult;
-struct Object;
-
-std::vector<RuntimeResult *> contextResultCache;
-
-struct RuntimeResult final {
-    Object *value;
-    Error *error;
-    Object *funcReturnValue;
-    // for loops
-    bool shouldContinue;
-    bool shouldBreak;
-    std::string extraInfo = "";
-
-    std::vector<RuntimeResult *> *resultCache;
-    Error *cause;
-
-    void Reset() {
-        this->value = nullptr;
-        this->error = nullptr;
-        this->shouldContinue = false;
-        this->shouldBreak = false;
-        this->funcReturnValue = nullptr;
-        this->cause = nullptr;
-    }
-
-    explicit RuntimeResult() : error(nullptr) {
-        this->Reset();
-        resultCache = &contextResultCache;
-        contextResultCache.push_back(this);
-    }
-
-    Object *Register(RuntimeResult *res) {
-        // if (res->error != nullptr) {
-            this->error = res->error;
-        // }
-        this->funcReturnValue = res->funcReturnValue;
-        this->shouldContinue = res->shouldContinue;
-        this->shouldBreak = res->shouldBreak;
-        this->cause = res->cause;
-        this->extraInfo = res->extraInfo;
-        return res->value;
-    }
-
-    void SetCause(Error *err) {
-        if (err != nullptr) {
-            this->cause = err;
-        }
-    }
-
-    void ClearCause() {
-        this->cause = nullptr;
-    }
-
-    RuntimeResult *Success(Object *value) {
-        this->Reset();
-        this->value = value;
-        return this;
-    }
-
-    RuntimeResult *SuccessReturn(Object *value) {
-        this->Reset();
-        this->funcReturnValue = value;
-        return this;
-    }
-
-    RuntimeResult *SuccessContinue() {
-        this->Reset();
-        this->shouldContinue = true;
-        return this;
-    }
-
-    RuntimeResult *SuccessBreak() {
-        this->Reset();
-        this->shouldBreak = true;
-        return this;
-    }
-
-    RuntimeResult *Failure(Error *err, Error *cause = nullptr) {
-        this->Reset();
-        this->error = err;
-        this->SetCause(cause);
-        return this; 
-    }
-
-    RuntimeResult *Failure(Error *err, Error *cause, const std::string &extra) {
-        this->Reset();
-        this->error = err;
-        this->extraInfo = extra;
-        this->SetCause(cause);
-        return this; 
-    }
-
-    bool ShouldReturn() {
-        return this->error != nullptr || this->shouldBreak || this->shouldContinue || this->funcReturnValue != nullptr;
-    }
-};
-
-
-struct Object {
-    const char *typeName;
-    Context *ctx;
-    Position *startPos;
-    Position *endPos;
-
-    explicit Object(const char *n) : typeName(n), ctx(nullptr) {}
-    explicit Object() : Object("Object") {}
-
-    virtual inline std::string ToString() {
-        return std::format("<object {} at {}>", this->typeName, static_cast<void *>(this));
-    }
-
-    virtual Object *SetContext(Context *ctx = nullptr) {
-        this->ctx = ctx;
-        if (ctx && ctx->exFrame) {
-            this->ctx->exFrame = ctx->exFrame;
-        }
-        return this;
-    }
-
-    virtual Object *Copy() {
-        // Object *o = new Object;
-        // *o = *this;
-        // return o;
-        assert(false);
-        return nullptr;
-    }
-
-    virtual Object *SetPos(Position *st = nullptr, Position *et = nullptr) {
-        this->startPos = st;
-        this->endPos = et;
-        return this;
-    }
-
-    virtual ~Object() = default;
-
-    virtual bool AsBool() {
-        return true;
-    }
-
-    virtual std::pair<Object *, Error *> AddTo(Object *other) {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "+"));
-    }
-
-    virtual std::pair<Object *, Error *> SubstractedBy(Object *other) {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "-"));
-    }
-    
-    virtual std::pair<Object *, Error *> PoweredBy(Object *other)  {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "^"));
-    }
-
-    virtual std::pair<Object *, Error *> MultipliedBy(Object *other)  {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "*"));
-    }
-
-    virtual std::pair<Object *, Error *> DividedBy(Object *other)  {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "/"));
-    }
-
-    virtual std::pair<Object *, Error *> GetCompEquals(Object *other);
-    virtual std::pair<Object *, Error *> GetCompNequals(Object *other);
-    
-    virtual std::pair<Object *, Error *> GetCompLt(Object *other) {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "<"));   
-    }
-
-    virtual std::pair<Object *, Error *> GetCompGt(Object *other) {
-        return std::make_pair(nullptr, this->IllegalOperation(other, ">"));   
-    }
-
-    virtual std::pair<Object *, Error *> GetCompLte(Object *other) {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "<="));    
-    }
-
-    virtual std::pair<Object *, Error *> GetCompGte(Object *other) {
-        return std::make_pair(nullptr, this->IllegalOperation(other, ">="));   
-    }
-
-    virtual std::pair<Object *, Error *> And(Object *other) {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "and"));      
-    }
-
-    virtual std::pair<Object *, Error *> Or(Object *other) {
-        return std::make_pair(nullptr, this->IllegalOperation(other, "or"));     
-    }
-
-    virtual std::pair<Object *, Error *> Not(Object *other) {
-         return std::make_pair(nullptr, this->IllegalOperation(nullptr, "not"));
-    }
-
-    virtual std::pair<Object *, Error *> Subsciption(Object *other) {
-        return std::make_pair(nullptr, new TypeError(
-            std::format("'{}' object is not subscriptable", this->typeName),
-            this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    virtual std::pair<Object *, Error *> SubsciptionAssignment(Object *other, Object *value) {
-        return std::make_pair(nullptr, new TypeError(
-            std::format("'{}' object cannot be assigned through subscription", this->typeName),
-            this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    virtual std::pair<Object *, Error *> Len() {
-        return std::make_pair(nullptr, new TypeError(
-            std::format("Cannot perform 'len' on object '{}'", this->typeName),
-            this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    virtual std::pair<Object *, Error *> GetAttr(const std::string &attr) {
-         return std::make_pair(nullptr, new TypeError(
-            std::format("'{}' has no user-defined attribute", this->typeName),
-            this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    virtual std::pair<Object *, Error *> SetAttr(const std::string &attr, Object *newVal) {
-        return std::make_pair(nullptr, new TypeError(
-            std::format("'{}' object has no user-defined attribute", this->typeName),
-            this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    virtual std::pair<Object *, Error *> Iter() {
-        return std::make_pair(nullptr, new TypeError(
-            std::format("'{}' object is not iterable", this->typeName),
-            this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    virtual std::pair<Object *, Error *> Next() {
-        return std::make_pair(nullptr, new TypeError(
-            std::format("'{}' object is not a iterator", this->typeName),
-            this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    virtual RuntimeResult *Execute(std::vector<Object *> args) {
-        auto result = new RuntimeResult;
-        return result->Failure(new TypeError(
-            std::format("'{}' object is not callable", this->typeName),
-            this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    virtual Error *IllegalOperation(Object *other, const std::string &operationId) {
-        Object *o = other == nullptr ? this : other;
-        return new TypeError(
-            std::format("Invilid operation '{}' between '{}' and '{}'", operationId, this->typeName, o->typeName),
-            this->startPos, this->endPos, this->ctx
-        );
-    }
-};
-
-template<typename T>
-T *As(Object *o) {
-    return dynamic_cast<T *>(o);
-}
-
-struct Number : public Object {
-    std::variant<int, double> value;
-    // union {
-    //     int value;
-    //     double value;
-    // };
-    NumberType ntype;
-    static Number *null;
-
-    
-    explicit Number(int v) : ntype(NumberType::Int), value(v), Object("Number") {
-        this->SetPos();
-    }
-    explicit Number(double v) : ntype(NumberType::Float), value(v), Object("Number") {
-        this->SetPos();
-    }
-
-    explicit Number(std::variant<int, double> v) : value(v), Object("Number") {
-        this->SetPos();
-        if (std::holds_alternative<int>(v)) {
-            this->ntype = NumberType::Int;
-        } else {
-            this->ntype = NumberType::Float;
-        }
-    }
-
-    explicit Number() : ntype(NumberType::Float), value(0), Object("Number") {}
-
-    Number *SetContext(Context *ctx = nullptr) override {
-        Object::SetContext(ctx);
-        return this;
-    } 
-
-    Number *SetPos(Position *st = nullptr, Position *et = nullptr) override {
-        Object::SetPos(st, et);
-        return this;
-    }
-
-    Number *Copy() override {
-        return (new Number(this->value))->SetPos(this->startPos, this->endPos)->SetContext(this->ctx);
-    }
-
-    // template<typename T>
-    // static bool IsSameVariant(const std::variant<int, double> &a, const std::variant<int, double> &b) {
-    //     return std::holds_alternative<T>(a) && std::holds_alternative<T>(b);
-    // }
-
-    std::pair<Object *, Error *> AddTo(Object *other) override {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '+' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->BinaryOperation(b, a, ob->startPos, ob->endPos, TokenType::OP_Plus);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "+"));
-    }
-
-    std::pair<Object *, Error *> SubstractedBy(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '-' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->BinaryOperation(b, a, ob->startPos, ob->endPos, TokenType::OP_Minus);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "-"));
-    }
-
-    std::pair<Object *, Error *> PoweredBy(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '^' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->BinaryOperation(b, a, ob->startPos, ob->endPos, TokenType::OP_Pow);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "^"));
-    }
-
-    std::pair<Object *, Error *> GetCompEquals(Object *other) override {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '==' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->ComparisonOperation(a, b, ob->startPos, ob->endPos, TokenType::OP_Equal);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "=="));
-    }
-
-    std::pair<Object *, Error *> GetCompNequals(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '!=' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->ComparisonOperation(a, b, ob->startPos, ob->endPos, TokenType::OP_Nequal);
-        }
-       return std::make_pair(nullptr, Object::IllegalOperation(other, "!="));
-    }
-
-    std::pair<Object *, Error *> GetCompLt(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '<' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->ComparisonOperation(a, b, ob->startPos, ob->endPos, TokenType::OP_Lt);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "<"));
-    }
-
-    std::pair<Object *, Error *> GetCompGt(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '>' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->ComparisonOperation(a, b, ob->startPos, ob->endPos, TokenType::OP_Gt);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, ">"));
-    }
-
-    std::pair<Object *, Error *> GetCompLte(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '<=' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->ComparisonOperation(a, b, ob->startPos, ob->endPos, TokenType::OP_Lte);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "<="));
-    }
-    
-    std::pair<Object *, Error *> GetCompGte(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '>=' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->ComparisonOperation(a, b, ob->startPos, ob->endPos, TokenType::OP_Gte);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, ">="));
-    }
-
-    std::pair<Number *, Error *> BinaryOperation(std::variant<int, double> a, std::variant<int, double> b, Position *ost, Position *oet, TokenType opType) {
-        bool aIsInt = std::holds_alternative<int>(a), bIsInt = std::holds_alternative<int>(b);
-        // Shit code :(
-        
-        if (aIsInt && bIsInt) {
-            switch (opType) {
-            case TokenType::OP_Plus:
-                return std::make_pair((new Number(std::get<int>(a) + std::get<int>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Minus:
-                return std::make_pair((new Number(std::get<int>(a) - std::get<int>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Mul:
-                return std::make_pair((new Number(std::get<int>(a) * std::get<int>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Div:
-                if (std::get<int>(b) == 0) {
-                    return std::make_pair(nullptr, new RuntimeError("Division by zero", ost, oet, this->ctx));
-                }
-                return std::make_pair((new Number(std::get<int>(a) / std::get<int>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Pow:
-                return std::make_pair((new Number(pow(std::get<int>(a), std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            default:
-                assert(false);
-            }
-        } else if (aIsInt && !bIsInt) {
-            switch (opType) {
-            case TokenType::OP_Plus:
-                return std::make_pair((new Number(std::get<int>(a) + std::get<double>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Minus:
-                return std::make_pair((new Number(std::get<int>(a) - std::get<double>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Mul:
-                return std::make_pair((new Number(std::get<int>(a) * std::get<double>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Div:
-                if (std::get<double>(b) == 0) {
-                    return std::make_pair(nullptr, new RuntimeError("Division by zero", ost, oet, this->ctx));
-                }
-                return std::make_pair((new Number(std::get<int>(a) / std::get<double>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Pow:
-                return std::make_pair((new Number(pow(std::get<int>(a), std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            default:
-                assert(false);
-            }
-        } else if (!aIsInt && bIsInt) {
-            switch (opType) {
-            case TokenType::OP_Plus:
-                return std::make_pair((new Number(std::get<double>(a) + std::get<int>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Minus:
-                return std::make_pair((new Number(std::get<double>(a) - std::get<int>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Mul:
-                return std::make_pair((new Number(std::get<double>(a) * std::get<int>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Div:
-                if (std::get<int>(b) == 0) {
-                    return std::make_pair(nullptr, new RuntimeError("Division by zero", ost, oet, this->ctx));
-                }
-                return std::make_pair((new Number(std::get<double>(a) / std::get<int>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Pow:
-                return std::make_pair((new Number(pow(std::get<double>(a), std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            default:
-                assert(false);
-            }   
-        } else {
-            switch (opType) {
-            case TokenType::OP_Plus:
-                return std::make_pair((new Number(std::get<double>(a) + std::get<double>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Minus:
-                return std::make_pair((new Number(std::get<double>(a) - std::get<double>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Mul:
-                return std::make_pair((new Number(std::get<double>(a) * std::get<double>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Div:
-                if (std::get<double>(b) == 0) {
-                    return std::make_pair(nullptr, new RuntimeError("Division by zero", ost, oet, this->ctx));
-                }
-                return std::make_pair((new Number(std::get<double>(a) / std::get<double>(b)))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Pow:
-                return std::make_pair((new Number(pow(std::get<double>(a), std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            default:
-                assert(false);
-            }
-        }
-    }
-
-    std::pair<Number *, Error *> ComparisonOperation(std::variant<int, double> a, std::variant<int, double> b, Position *ost, Position *oet, TokenType opType) {
-        bool aIsInt = std::holds_alternative<int>(a), bIsInt = std::holds_alternative<int>(b);
-        // Shit code again :(
-                
-        if (aIsInt && bIsInt) {
-            switch (opType) {
-            case TokenType::OP_Lt:
-                return std::make_pair((new Number((int) (std::get<int>(a) > std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Gt:
-                return std::make_pair((new Number((int) (std::get<int>(a) < std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Lte:
-                return std::make_pair((new Number((int) (std::get<int>(a) >= std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Gte:
-                return std::make_pair((new Number((int) (std::get<int>(a) <= std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Equal:
-                return std::make_pair((new Number((int) (std::get<int>(a) == std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Nequal:
-                return std::make_pair((new Number((int) (std::get<int>(a) != std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            default:
-                assert(false);
-            }
-        } else if (aIsInt && !bIsInt) {
-           switch (opType) {
-            case TokenType::OP_Lt:
-                return std::make_pair((new Number((int) (std::get<int>(a) > std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Gt:
-                return std::make_pair((new Number((int) (std::get<int>(a) < std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Lte:
-                return std::make_pair((new Number((int) (std::get<int>(a) <= std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Gte:
-                return std::make_pair((new Number((int) (std::get<int>(a) >= std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Equal:
-                return std::make_pair((new Number((int) (std::get<int>(a) == std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Nequal:
-                return std::make_pair((new Number((int) (std::get<int>(a) != std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            default:
-                assert(false);
-            }
-        } else if (!aIsInt && bIsInt) {
-            switch (opType) {
-            case TokenType::OP_Lt:
-                return std::make_pair((new Number((int) (std::get<double>(a) > std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Gt:
-                return std::make_pair((new Number((int) (std::get<double>(a) < std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Lte:
-                return std::make_pair((new Number((int) (std::get<double>(a) <= std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Gte:
-                return std::make_pair((new Number((int) (std::get<double>(a) >= std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Equal:
-                return std::make_pair((new Number((int) (std::get<double>(a) == std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Nequal:
-                return std::make_pair((new Number((int) (std::get<double>(a) != std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            default:
-                assert(false);
-            }      
-        } else {
-            switch (opType) {
-            case TokenType::OP_Lt:
-                return std::make_pair((new Number((int) (std::get<double>(a) > std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Gt:
-                return std::make_pair((new Number((int) (std::get<double>(a) < std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Lte:
-                return std::make_pair((new Number((int) (std::get<double>(a) <= std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Gte:
-                return std::make_pair((new Number((int) (std::get<double>(a) >= std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Equal:
-                return std::make_pair((new Number((int) (std::get<double>(a) == std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            case TokenType::OP_Nequal:
-                return std::make_pair((new Number((int) (std::get<double>(a) != std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            default:
-                assert(false);
-            }
-        }
-    }
-
-    // 0 for and, 1 for or
-    std::pair<Number *, Error *> LogicalOperation(std::variant<int, double> a, std::variant<int, double> b, Position *ost, Position *oet, int op) {\
-        bool aIsInt = std::holds_alternative<int>(a), bIsInt = std::holds_alternative<int>(b);
-        // Shit code again again :(
-                        
-        if (aIsInt && bIsInt) {
-            if (op == 0) {
-                return std::make_pair((new Number((int) ((bool) std::get<int>(a) && (bool) std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            } else if (op == 1) {
-                return std::make_pair((new Number((int) ((bool) std::get<int>(a) || (bool) std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            } else assert(false);
-        } else if (aIsInt && !bIsInt) {
-            if (op == 0) {
-                return std::make_pair((new Number((int) ((bool) std::get<int>(a) && (bool) std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            } else if (op == 1) {
-                return std::make_pair((new Number((int) ((bool) std::get<int>(a) || (bool) std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            } else assert(false);
-        } else if (!aIsInt && bIsInt) {
-            if (op == 0) {
-                return std::make_pair((new Number((int) ((bool) std::get<double>(a) && (bool) std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            } else if (op == 1) {
-                return std::make_pair((new Number((int) ((bool) std::get<double>(a) || (bool) std::get<int>(b))))->SetContext(this->ctx), nullptr);
-            } else assert(false);
-        } else {
-           if (op == 0) {
-                return std::make_pair((new Number((int) ((bool) std::get<double>(a) && (bool) std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            } else if (op == 1) {
-                return std::make_pair((new Number((int) ((bool) std::get<double>(a) || (bool) std::get<double>(b))))->SetContext(this->ctx), nullptr);
-            } else assert(false);
-        }
-    }
-
-    std::pair<Object *, Error *> And(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Logical operation 'and' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->LogicalOperation(b, a, ob->startPos, ob->endPos, 0);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "and"));        
-    } 
-
-
-    std::pair<Object *, Error *> Or(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Logical operation 'or' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->LogicalOperation(b, a, ob->startPos, ob->endPos, 1);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "or"));
-    } 
-
-    std::pair<Object *, Error *> MultipliedBy(Object *other) override {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '*' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->BinaryOperation(b, a, ob->startPos, ob->endPos, TokenType::OP_Mul);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "*"));
-    }
-
-    std::pair<Object *, Error *> DividedBy(Object *other) {
-        if (other == nullptr) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Operator '/' not supported between '{}' and null", this->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (std::string(other->typeName) == std::string(this->typeName)) {
-            auto ob = dynamic_cast<Number *>(other);
-            auto a = ob->value;
-            auto b = this->value;
-            return this->BinaryOperation(b, a, ob->startPos, ob->endPos, TokenType::OP_Div);
-        }
-        return std::make_pair(nullptr, Object::IllegalOperation(other, "/"));
-    }
-
-    std::pair<Object *, Error *> Not() {
-        if (this->ntype == NumberType::Float) {
-            return std::make_pair((new Number(std::get<double>(this->value) == 0.0))->SetContext(this->ctx), nullptr);
-        } else {
-            return std::make_pair((new Number(std::get<int>(this->value) == 0))->SetContext(this->ctx), nullptr);
-        }
-    }
-
-    inline std::string ToString() override {
-        if (std::holds_alternative<int>(this->value)) {
-            return std::format("{}", std::get<int>(this->value));
-        } else {
-            return std::format("{}", std::get<double>(this->value));
-        }
-    }
-
-    bool AsBool() override {
-        if (this->ntype == NumberType::Int) {
-            return std::get<int>(this->value) != 0;
-        } else {
-            return std::get<double>(this->value) != 0.0;
-        }
-    }
-
-    ~Number() {
-
-    }
-};
-
-
-struct SymbolTable final {
-    std::map<std::string, Object *> symbols;
-    SymbolTable *parentFieldSymbols;
-
-    explicit SymbolTable() {
-        this->parentFieldSymbols = nullptr;
-    }
-
-    explicit SymbolTable(SymbolTable *parant) {
-        this->parentFieldSymbols = parant;
-    }
-
-    inline Object *Get(const std::string &name) {
-        if (this->symbols.find(name) == this->symbols.end()) {
-            if (this->parentFieldSymbols != nullptr) {
-                SymbolTable *st = this->parentFieldSymbols;
-                while (st != nullptr) {
-                    if (st->symbols.find(name) != st->symbols.end()) {
-                        return st->symbols[name];
-                    }
-                    st = st->parentFieldSymbols;
-                }
-            }
-        } else {
-            return this->symbols[name];
-        }
-        return nullptr;
-    }
-
-    inline void Set(const std::string &name, Object *newValue) {
-        if (this->symbols.find(name) == this->symbols.end()) {
-            this->symbols.emplace(std::make_pair(name, newValue));
-        } else {
-            this->symbols[name] = newValue;
-        }
-    } 
-
-    inline void Remove(const std::string &name) {
-        this->symbols.erase(name);
-    }
-
-    inline std::string ToString(bool showBuiltins = true) const {
-        std::stringstream ss;
-        ss << "{\n";
-        unsigned nums = 0;
-        for (auto [n, v] : this->symbols) {
-            nums++;            
-            if (!showBuiltins && v->typeName == "BuiltinFunction") {
-                if (nums == this->symbols.size() - 1) {
-                    auto s = showBuiltins ? "" : "\n";                
-                    ss << s << "}";
-                }
-                continue;
-            }
-            ss << std::format("  [{}] \'{}\':  {} ({})", v->typeName, n, v->ToString(), (void *) v);
-            if (nums != this->symbols.size()) {
-                ss << ",\n";
-            } else {
-                ss << "\n}";
-            }
-        }
-        return ss.str();
-    }
-};
-
-
-std::pair<Object *, Error *> Object::GetCompEquals(Object *other) {
-    if (std::string(this->typeName) != std::string(other->typeName)) {
-        return std::make_pair(new Number(0), nullptr);
-    }
-    return std::make_pair(new Number((void *) this == (void *) other), nullptr);
-    // return std::make_pair(nullptr, this->IllegalOperation(other, "=="));
-}
-
-std::pair<Object *, Error *> Object::GetCompNequals(Object *other) {
-    if (std::string(this->typeName) == std::string(other->typeName)) {
-        return std::make_pair(new Number(1), nullptr);
-    }
-    return std::make_pair(new Number((void *) this != (void *) other), nullptr);
-    // return std::make_pair(nullptr, this->IllegalOperation(other, "!="));   
-}
-
-struct String : public Object {
-    using ObjectWithError = std::pair<Object *, Error *>;
-
-    struct StringIterator : public Object {
-        std::string content;
-        std::wstring iterContent;
-        long n;
-        explicit StringIterator(const std::string &content) : content(content), n(-1) {
-            this->iterContent = ToWideString(this->content);
-        }
-
-        ObjectWithError Next() override {
-            this->n++;
-            if (n < this->iterContent.length()) {
-                auto s = ToByteString(Lexer::CharAt(this->iterContent, n));
-                return std::make_pair(new String(s), nullptr);
-            } else {
-                return std::make_pair(nullptr, new StopIteration);
-            }
-        }
-    };
-
-    static inline std::string Repeat(const std::string &s, int times) {
-        std::string result;
-        for (int i = 0; i < times; i++) {
-            result += s;
-        }
-        return result;
-    }
-
-    std::string s;
-    explicit String(const std::string &value) : s(value), Object("String") {}
-
-    std::pair<Object *, Error *> AddTo(Object *other) override {
-        if (other->typeName == std::string("String")) {
-            auto *o = dynamic_cast<String *>(other);
-            return std::make_pair((new String(this->s + o->s))->SetContext(this->ctx)->SetPos(this->startPos, this->endPos), nullptr);
-        } else {
-            return std::make_pair(nullptr, Object::IllegalOperation(other, "+"));
-        }
-    }
-
-    std::pair<Object *, Error *> MultipliedBy(Object *other) override {
-        if (other->typeName == "Number") {
-            auto *o = dynamic_cast<Number *>(other);
-            if (o->ntype != NumberType::Int) {
-                return std::make_pair(nullptr, new TypeError(
-                    "The right of '*' in string multiplication must be an integer",
-                    other->startPos, other->endPos, this->ctx
-                ));
-            }
-            return std::make_pair((new String(String::Repeat(this->s, std::get<int>(o->value))))->SetContext(this->ctx)->SetPos(this->startPos, this->endPos), nullptr);
-        } else {
-           return std::make_pair(nullptr, Object::IllegalOperation(other, "*"));
-        }
-    }
-
-    std::pair<Object *, Error *> GetCompEquals(Object* other) override {
-        if (other->typeName == "String") {
-            return this->s == dynamic_cast<String *>(other)->s ? std::make_pair(new Number(1), nullptr) : std::make_pair(new Number(0), nullptr);
-        } else {
-            return std::make_pair(nullptr, Object::IllegalOperation(other, "=="));
-        }
-    }
-
-    std::pair<Object *, Error *> GetCompNequals(Object* other) override {
-        if (other->typeName == "String") {
-            return this->s == dynamic_cast<String *>(other)->s ? std::make_pair(new Number(0), nullptr) : std::make_pair(new Number(1), nullptr);
-        } else {
-            return std::make_pair(nullptr, Object::IllegalOperation(other, "!="));
-        }
-    }
-
-    bool AsBool() override {
-        return this->s.size() > 0;
-    }
-
-    Object *Copy() override {
-        return (new String(this->s))->SetContext(this->ctx)->SetPos(this->startPos, this->endPos);
-    }
-
-    inline std::string ToString() override {
-        return this->s;
-    }
-
-    std::pair<Object *, Error *> Len() override {
-        return std::make_pair(new Number((int) ToWideString(this->s).length()), nullptr);
-    }
-
-    inline void Representation() {
-        std::string repr;
-        std::cout << "'";
-        std::wstring ws = ToWideString(this->s);
-        for (long i = 0; i < ws.length(); i++) {
-            auto c = ToByteString(Lexer::CharAt(ws, i));
-            if (REVERSED_ESCAPE_CHARACTERS.find(c) != REVERSED_ESCAPE_CHARACTERS.end()) {
-                std::cout << "\\";
-                std::cout << REVERSED_ESCAPE_CHARACTERS.at(c);
-                continue;
-            }
-            std::cout << c;
-        }
-        std::cout << "'" << std::endl;
-    }
-
-    inline void Representation(std::ostream &o, bool nl = false) {
-        std::string repr;
-        std::wstring ws = ToWideString(this->s);        
-        o << "'";
-        for (long i = 0; i < ws.length(); i++) {
-            auto c = ToByteString(Lexer::CharAt(ws, i));
-            if (REVERSED_ESCAPE_CHARACTERS.find(c) != REVERSED_ESCAPE_CHARACTERS.end()) {
-                o << "\\";
-                o << REVERSED_ESCAPE_CHARACTERS.at(c);
-                continue;
-            }
-            o << c;
-        }
-        o << "'";
-        if (nl) {
-            o << std::endl;
-        }
-    }
-
-    ObjectWithError Subsciption(Object *other) override {
-        if (other->typeName != std::string("Number")) {
-            return std::make_pair(nullptr, new TypeError(
-                "String index should be a number",
-                other->startPos, other->endPos, this->ctx 
-            ));
-        }
-
-        auto index = As<Number>(other);
-        if (!std::holds_alternative<int>(index->value)) {
-            return std::make_pair(nullptr, new TypeError(
-                "String index should be a positive integer",
-                other->startPos, other->endPos, this->ctx
-            ));
-        }
-
-        auto indexNum = std::get<int>(index->value);
-        auto ws = ToWideString(this->s);
-        if (indexNum < 0) {
-            return std::make_pair(nullptr, new TypeError(
-                "String index should be a positive integer",
-                other->startPos, other->endPos, this->ctx
-            ));
-        }
-
-        if (indexNum + 1 > ws.length()) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("String index out of range (maximum is {} but got {})", this->s.length() - 1, indexNum),
-                other->startPos, other->endPos, this->ctx
-            ));
-        }
-
-        return std::make_pair(new String(ToByteString(Lexer::CharAt(ws, indexNum))), nullptr);
-    }
-
-    ObjectWithError Iter() {
-        return std::make_pair(new StringIterator(this->s), nullptr);
-    }
-
-    ~String() = default;
-};
-
-
-template <>
-inline std::string StringifySequence(const std::vector<Object *> &seq) {
-    std::string result = "[";
-    for (int i = 0; i < seq.size(); i++) {
-        if (seq[i]->typeName == "String") {
-            std::ostringstream oss;
-            As<String>(seq[i])->Representation(oss);
-            result += oss.str();
-        } else {
-            result += seq[i]->ToString();
-        }
-        if (i + 1 != seq.size()) {
-            result += ", ";
-        }
-    }
-    result += "]";
-    return result;
-}
-
-
-struct List : public Object {
-    std::vector<Object *> elements;
-    using ObjectWithError = std::pair<Object *, Error *>;
-    bool isParameterPack = false;
-    bool isMutable = true;
-
-    List *AsParameterPack() { 
-        auto c = As<List>(this->Copy());
-        c->isParameterPack = true;
-        return c;
-    }
-    List *SetUnmutable(bool v = false) { this->isMutable = v; return this; }
-
-    explicit List(const std::vector<Object *> &elements) : elements(elements), Object("List") {}
-
-    // immutable operation for operators of list
-    ObjectWithError AddTo(Object *other) override {
-        auto copy = dynamic_cast<List *>(this->Copy());
-        copy->elements.push_back(other);
-        return std::make_pair(copy, nullptr);
-    }
-
-    ObjectWithError MultipliedBy(Object *other) override {
-        if (other->typeName != "List") {
-            return std::make_pair(nullptr, Object::IllegalOperation(other, "<list-concat '*'>"));
-        }
-        auto newList = dynamic_cast<List *>(this->Copy());
-        // for (auto e : this->elements) {
-        //     newList->elements.push_back(e);
-        // }
-        for (auto e : dynamic_cast<List *>(other)->elements) {
-            newList->elements.push_back(e);
-        }
-        return std::make_pair(newList, nullptr);
-    }
-
-    ObjectWithError SubstractedBy(Object *other) override {
-        if (other->typeName != "Number") {
-            return std::make_pair(nullptr, Object::IllegalOperation(other, "<list-remove '-'>"));
-        } else {
-            auto index = dynamic_cast<Number *>(other);
-            if (index->ntype != NumberType::Int) {
-                return std::make_pair(nullptr, new TypeError(
-                    "List index must be an integer",
-                    this->startPos, this->endPos, this->ctx
-                ));
-            } else {
-                auto indexValue = std::get<int>(index->value);      
-                auto newList = dynamic_cast<List *>(this->Copy());
-                if (indexValue < 0) {
-                    indexValue = newList->elements.size() + indexValue;
-                }
-                if (indexValue + 1 > newList->elements.size()) {
-                    return std::make_pair(nullptr, new RuntimeError(
-                        std::format("List index out of range (given {} but maximum is {})", indexValue, newList->elements.size()),
-                        this->startPos, this->endPos, this->ctx
-                    ));
-                }
-                decltype(newList->elements)::iterator it = newList->elements.begin() + indexValue;
-                newList->elements.erase(it);
-                return std::make_pair(newList, nullptr);
-            }
-        }
-    }
-
-    ObjectWithError DividedBy(Object *other) override {
-        if (other->typeName != std::string("Number")) {
-            return std::make_pair(nullptr, Object::IllegalOperation(other, "<list-access '/'>"));
-        } else {
-            auto index = dynamic_cast<Number *>(other);
-            if (index->ntype != NumberType::Int) {
-                return std::make_pair(nullptr, new TypeError(
-                    "List index must be an integer",
-                    this->startPos, this->endPos, this->ctx
-                ));
-            } else {
-                auto indexValue = std::get<int>(index->value);      
-                if (indexValue < 0) {
-                    indexValue = this->elements.size() + indexValue;
-                }
-                if (indexValue + 1 > this->elements.size() || indexValue < 0) {
-                    return std::make_pair(nullptr, new RuntimeError(
-                        std::format("List index out of range (given {} but maximum is {})", indexValue, this->elements.size()),
-                        this->startPos, this->endPos, this->ctx
-                    ));
-                }
-                return std::make_pair(this->elements[indexValue], nullptr);
-            }
-        }
-    }
-
-    ObjectWithError Subsciption(Object *other) override {
-        return this->DividedBy(other);
-    }
-
-    ObjectWithError SubsciptionAssignment(Object *other, Object *newVal) override {
-        if (other->typeName != "Number") {
-            return std::make_pair(nullptr, Object::IllegalOperation(other, "<list-access '[]'>"));
-        } else {
-            auto index = dynamic_cast<Number *>(other);
-            if (index->ntype != NumberType::Int) {
-                return std::make_pair(nullptr, new TypeError(
-                    "List index must be an integer",
-                    this->startPos, this->endPos, this->ctx
-                ));
-            } else {
-                auto indexValue = std::get<int>(index->value);      
-                if (indexValue < 0) {
-                    indexValue = this->elements.size() + indexValue;
-                }
-                if (indexValue + 1 > this->elements.size() || indexValue < 0) {
-                    return std::make_pair(nullptr, new RuntimeError(
-                        std::format("List index out of range (given {} but maximum is {})", indexValue, this->elements.size()),
-                        this->startPos, this->endPos, this->ctx
-                    ));
-                }
-                this->elements[indexValue] = newVal;
-            }
-        }
-        return std::make_pair(Number::null, nullptr);
-    }
-
-    Object *Copy() override {
-        auto copy = new List(this->elements);
-        copy->SetPos(this->startPos, this->endPos);
-        copy->SetContext(this->ctx);
-        // copy->isParameterPack = this->isParameterPack;
-        // copy->isMutable = this->isMutable;
-        return copy;
-    }
-
-     std::pair<Object *, Error *> Len() override {
-        return std::make_pair(new Number((int) this->elements.size()), nullptr);
-    }
-    
-
-    inline std::string ToString() override {
-        return StringifySequence(this->elements);
-    }
-};
-
-std::string StringifyMapping(const std::map<Object *, Object *> &mapping, std::string prefIgnore = "", std::string suffIgnore = "") {
-    std::string result = "{";
-    int i = 0;
-    for (auto &[k, v] : mapping) {
-        std::string str = "";
-        if (prefIgnore != "") {
-            if (k->ToString().starts_with(prefIgnore)) {
-                i++;
-                continue;
-            }
-        }        
-        if (suffIgnore != "") {
-            if (k->ToString().ends_with(suffIgnore)) {
-                i++;
-                continue;
-            }
-        }
-        if (k->typeName == "String") {
-            str = std::string("'") + k->ToString() + std::string("'");
-        } else {
-            str = k->ToString();
-        }
-        result += str;
-        result += ": ";
-        if (v->typeName == "String") {
-            str = std::string("'") + v->ToString() + std::string("'");
-        } else {
-            str = v->ToString();
-        }
-        result += str;
-        if (i + 1 != mapping.size()) {
-            result += ", ";
-        }
-        i++;
-    }
-    return result + "}";
-}
-
-
-struct Dictionary : public Object {
-    std::map<Object *, Object *> elements;
-    using ObjectWithError = std::pair<Object *, Error *>;
-
-    explicit Dictionary(const std::map<Object *, Object *> &elements) : elements(elements), Object("Dictionary") {}
-
-    std::vector<Object *> GetKeys() {
-        std::vector<Object *> result;
-        for (auto [k, _] : this->elements) {
-            result.push_back(k);
-        }
-        return result;
-    }
-
-    ObjectWithError Subsciption(Object *other) override {
-        for (auto k : this->GetKeys()) {
-            auto compResult = other->GetCompEquals(k);
-            if (compResult.first == nullptr) {
-                return std::make_pair(nullptr, new TypeError(
-                    std::format("Invilid key type (which is not defined `GetCompEq` with type '{}'): '{}'", k->typeName, other->typeName),
-                    this->startPos, this->endPos, this->ctx
-                ));
-            }
-            if (compResult.second != nullptr) {
-                return std::make_pair(nullptr, compResult.second);
-            }
-            if (compResult.first->AsBool()) {
-                return std::make_pair(this->elements.at(k), nullptr);
-            }
-        }
-        return std::make_pair(nullptr, new AttributeError(
-            std::format("Dictionary has no attribute `{}`", other->ToString()),
-            other->startPos, other->endPos, this->ctx
-        ));
-    }
-
-    ObjectWithError SubsciptionAssignment(Object *other, Object *newVal) override {
-        for (auto k : this->GetKeys()) {
-            auto compResult = other->GetCompEquals(k);
-            if (compResult.first == nullptr) {
-                return std::make_pair(nullptr, new TypeError(
-                    std::format("Invilid key type (which is not defined `GetCompEq` with type '{}'): '{}'", k->typeName, other->typeName),
-                    this->startPos, this->endPos, this->ctx
-                ));
-            }
-            if (compResult.second != nullptr) {
-                return std::make_pair(nullptr, compResult.second);
-            }
-            if (compResult.first->AsBool()) {
-                this->elements[k] = newVal;        
-                return std::make_pair(Number::null, nullptr);
-            }
-        }
-        if (other->typeName != std::string("String") && other->typeName != std::string("Number")) {
-            return std::make_pair(nullptr, new TypeError(
-                std::format("Invilid key type: '{}'", other->typeName),
-                other->startPos, other->endPos, this->ctx
-            ));
-        }
-        this->elements[other] = newVal;
-        return std::make_pair(Number::null, nullptr);
-    }
-
-    ObjectWithError GetAttr(const std::string &attr) override {
-        for (auto [attrName, value] : this->elements) {
-            if (attrName->typeName != std::string("String")) {
-                continue;
-            }
-            auto key = As<String>(attrName);
-            if (attr == key->s) {
-                return std::make_pair(value, nullptr);
-            }
-        }
-        return std::make_pair(nullptr, new AttributeError(
-           std::format("Could not found attribute '.{}'", attr),
-           this->startPos, this->endPos, this->ctx
-        ));
-    }
-
-    ObjectWithError SetAttr(const std::string &attr, Object *newVal) override {
-        return this->SubsciptionAssignment((new String(attr))->SetContext(this->ctx)->SetPos(newVal->startPos, newVal->endPos), newVal);
-    }
-
-    Object *Copy() override {
-        auto copy = new Dictionary(this->elements);
-        copy->SetContext(this->ctx)->SetPos(this->startPos, this->endPos);
-        return copy;
-    }
-
-    ObjectWithError Len() override {
-        return std::make_pair(new Number((int) this->elements.size()), nullptr);
-    }
-
-    inline std::string ToString() override {
-        return StringifyMapping(this->elements);
-    }
-};
-
-
-enum class InterpreterStartMode {
-    Repl,
-    File,
-    Evaluation
-};
-
-class Interpreter final {
-public:
-    explicit Interpreter();
-    RuntimeResult *Visit(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitExpression(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitSingleExpression(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitVarAccessNode(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitVarAssignNode(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitNumber(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitIfExpressionNode(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitForExpression(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitWhileExpression(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitFunctionCall(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitFunctionDefinition(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitString(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitList(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitReturn(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitContinue(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitBreak(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitSubscription(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitDictionary(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitAttribution(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitAdvancedVarAccess(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitNewExpression(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitAttributionCall(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitStructDef(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitNonlocal(NodeBase *node, Context *ctx);
-    RuntimeResult *VisitDefer(NodeBase *node, Context *ctx);
-    std::vector<Context *> *GetCallStack() { return this->callStack; }
-    [[noreturn]] RuntimeResult *VisitEmpty(NodeBase *node, Context *ctx);
-    ~Interpreter();
-
-    std::vector<Context *> *callStack;
-};
-
-
-std::map<std::string, Context *> moduleContextCache;
-std::map<std::string, std::string> symbolsModuleLocation;
-struct FunctionBase : virtual public Object {
-    std::string functionName;
-    bool hasMutableArgument = false;
-    explicit FunctionBase(const std::string &name) : functionName(name), Object("FunctionBase")
-    {}
-
-    explicit FunctionBase() : FunctionBase("<anonymous>") {}
-
-    Context *GenerateNewContext() {
-        if (symbolsModuleLocation.find(this->functionName) == symbolsModuleLocation.end()) {
-            auto frameContext = new Context(this->functionName, this->ctx, this->startPos);
-            // frameContext->symbols = new SymbolTable(frameContext->global);
-            if (this->ctx && this->ctx->symbols) {
-                frameContext->symbols = new SymbolTable(this->ctx->symbols);
-            } else {
-                frameContext->symbols = new SymbolTable(frameContext->global);
-            }
-            frameContext->nonlocals = new SymbolTable;
-            // frameContext->symbols->Set(frameContext->parent->ctxLabel, this->ctx->symbols->Get(frameContext->parent->ctxLabel));        
-            return frameContext;
-        }
-        auto ctxTmpl = moduleContextCache.at(symbolsModuleLocation.at(this->functionName));
-        Context *frameContext = nullptr;
-        if (ctxTmpl->external) {
-            frameContext = new Context(this->functionName, this->ctx, this->startPos);
-        } else {
-            frameContext = new Context(this->functionName, ctxTmpl, this->startPos);
-        }
-
-        frameContext->symbols = new SymbolTable(ctxTmpl->symbols);
-        frameContext->nonlocals = new SymbolTable;
-
-        return frameContext;
-    }
-
-    virtual RuntimeResult *CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args) {
-        auto result = new RuntimeResult;
-        if (args.size() > argNames.size()) {
-            return result->Failure(new TypeError(
-                std::format("Too many arguments given to function '{}' (Expected {} but got {})", this->functionName, argNames.size(), args.size()),
-                this->startPos, this->endPos, this->ctx
-            ));
-        } else if (args.size() < argNames.size()) {
-            return result->Failure(new TypeError(
-                std::format("Too few arguments given to function '{}' (Expected {} but got {})", this->functionName, argNames.size(), args.size()),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        return result->Success(nullptr);
-    }
-
-    virtual RuntimeResult *PopulateArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx) {
-        for (int i = 0; i < args.size(); i++) {
-            auto argValue = args[i];
-            auto argName = argNames[i];
-            argValue->SetContext(execCtx);
-            execCtx->symbols->Set(argName, argValue);
-        }
-        return (new RuntimeResult)->Success(nullptr);
-    }
-
-    virtual RuntimeResult *CheckAndPopulate(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx) {
-        auto result = new RuntimeResult;
-        result->Register(this->CheckArguments(argNames, args));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        result->Register(this->PopulateArguments(argNames, args, execCtx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        return result->Success(nullptr);
-    }
-};
-
-
-struct Function : public FunctionBase {
-    NodeBase *body;
-    std::vector<std::string> parameters;
-    bool shouldAutoReturn;
-    std::string mutableArgName;
-    std::vector<std::string> cellVars;
-    SymbolTable *closureVarsTable;
-
-    explicit Function(const std::string &name, NodeBase *body, std::vector<std::string> args, bool shouldAutoReturn) :
-        FunctionBase(name), body(body), parameters(args), shouldAutoReturn(shouldAutoReturn), Object("Function")
-    {
-        this->closureVarsTable = new SymbolTable;
-    }
-
-    explicit Function(NodeBase *body, std::vector<std::string> args, bool shouldAutoReturn) : 
-        Function("<anonymous>", body, args, shouldAutoReturn) {}
-
-    RuntimeResult *CheckMutableArgument(const std::vector<std::string> &argNames, std::vector<Object *> &args, bool isMethod = false) {
-        auto result = new RuntimeResult;
-        std::vector<std::string> mutableArgNames;
-        for (auto &argName : argNames) {
-            if (argName.starts_with("_") && argName.ends_with("_") && !argName.starts_with("__") && !argName.ends_with("__")) {
-                this->hasMutableArgument = true;
-                mutableArgNames.push_back(argName);
-            }
-        }
-        if (!this->hasMutableArgument && !isMethod) {
-            return FunctionBase::CheckArguments(argNames, args);
-        }
-        if (this->hasMutableArgument) {
-            if (mutableArgNames.size() > 1) {
-                return result->Failure(new RuntimeError(
-                    "Too many mutable arguments",
-                    this->startPos, this->endPos, this->ctx
-                ));
-            }
-
-            if (argNames[argNames.size() - 1] != mutableArgNames[0]) {
-                return result->Failure(new RuntimeError(
-                    "Mutable argument appeared before positional arguments",
-                    this->startPos, this->endPos, this->ctx
-                ));
-            }        
-            this->mutableArgName = mutableArgNames[0];
-            return result->Success(Number::null);
-        }
-        return result->Success(nullptr);
-    }
-
-    RuntimeResult *CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args) override {
-        auto result = new RuntimeResult;
-        result->Register(this->CheckMutableArgument(argNames, args));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        if (argNames.size() == 0) {
-            return result->Success(nullptr);
-        }
-
-        if (args.size() < argNames.size() - 1) {
-             return result->Failure(new RuntimeError(
-                std::format("Too few arguments given to function '{}' (Expected at least {} but got {})", this->functionName, argNames.size() - 1, args.size()),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        return result->Success(nullptr);
-    }
-
-    virtual RuntimeResult *PopulateArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx) override {
-        if (!this->hasMutableArgument) {
-            return FunctionBase::PopulateArguments(argNames, args, execCtx);
-        }
-        auto mutableArgumentValue = new List({});
-        bool mutableArgumentReplaced = false;
-        int i;
-        for (i = 0; i < argNames.size() - 1; i++) {
-            auto argValue = args[i];
-            auto argName = argNames[i];
-            argValue->SetContext(execCtx);
-            execCtx->symbols->Set(argName, argValue);
-        }
-
-        if (!mutableArgumentReplaced) {
-            for (; i < args.size(); i++) {
-                auto argValue = args[i];
-                argValue->SetContext(execCtx);
-
-                if (argValue->typeName == std::string("List")) {
-                    if (As<List>(argValue)->isParameterPack) {
-                        for (auto &&unpackedVal : As<List>(argValue)->elements) {
-                            mutableArgumentValue->elements.push_back(unpackedVal);
-                        }
-                        continue;
-                    }
-                }
-                mutableArgumentValue->elements.push_back(argValue);
-            }
-            execCtx->symbols->Set(this->mutableArgName.substr(1, this->mutableArgName.size() - 2), mutableArgumentValue);
-            if (!mutableArgumentValue->elements.empty()) {
-                execCtx->symbols->Set("$" + this->mutableArgName.substr(1, this->mutableArgName.size() - 2), mutableArgumentValue->AsParameterPack());
-            }
-        }
-
-        return (new RuntimeResult)->Success(nullptr);
-    }
-
-    RuntimeResult *Execute(std::vector<Object *> args) {
-        auto result = new RuntimeResult;
-        auto interpreter = new Interpreter;
-        auto frameContext = this->GenerateNewContext();
-
-        for (auto [name, value] : this->closureVarsTable->symbols) {
-            frameContext->nonlocals->Set(name, value);
-        }
-
-        result->Register(this->CheckAndPopulate(this->parameters, args, frameContext));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-
-        auto returnValue = result->Register(interpreter->Visit(this->body, frameContext));
-        if (result->ShouldReturn() && result->funcReturnValue == nullptr) {
-            Error *lastError = result->error;
-            if (frameContext->deferNodes.size() != 0) {
-                for (auto node : frameContext->deferNodes) {
-                    auto expr = dynamic_cast<DeferNode *>(node)->deferExpr;
-                    if (currentCallStackDepth <= MAX_CALLSTACK_DEPTH) {
-
-                        std::map<Object *, Object *> excInfo {
-                            { new String("category"), new String(lastError->name) },
-                            { new String("details"), new String(lastError->details) },
-                            { new String("line"), new Number(lastError->st->line + 1) },
-                            { new String("column"), new Number(lastError->st->column + 1) },
-                            { new String("filename"), new String(lastError->st->filename) }
-                        };
-                        frameContext->symbols->Set("__lastexc__", new Dictionary(excInfo));
-                        result->Register(interpreter->Visit(expr, frameContext));        
-                        if (result->ShouldReturn()) {
-                            return result->Failure(
-                                result->error, lastError, "During handling the above exception, another exception occurred:"
-                            );                        
-                        }
-                    } else {
-                         return result->Failure(new RuntimeError(
-                            "`defer` terminated due to stack overflow",
-                            this->startPos, this->endPos, this->ctx
-                        ));
-                    }
-                }
-
-                auto frameState = frameContext->symbols->Get("__recovered__");
-                if (!frameState) {
-                    return result->Failure(lastError);
-                } else {
-                    return result->Success(frameState);
-                }
-            } else {
-                return result;
-            }
-        }
-        Object *returns = nullptr;
-        if (shouldAutoReturn && result->funcReturnValue == nullptr) {
-            returns = returnValue;
-        } else if (result->funcReturnValue != nullptr) {
-            returns = result->funcReturnValue;
-        } else {
-            returns = Number::null;
-        }
-
-        if (frameContext->deferNodes.size() != 0) {
-            for (auto node : frameContext->deferNodes) {
-                auto expr = dynamic_cast<DeferNode *>(node)->deferExpr;
-                if (currentCallStackDepth <= MAX_CALLSTACK_DEPTH) {
-                    frameContext->symbols->Set("__lastexc__", Number::null);
-                    result->Register(interpreter->Visit(expr, frameContext));        
-                    if (result->ShouldReturn()) {
-                        return result;                    
-                    }
-                } else {
-                    return result->Failure(new RuntimeError(
-                        "`defer` terminated due to stack overflow",
-                        this->startPos, this->endPos, this->ctx
-                    ));
-                }
-            }
-        }
-        return result->Success(returns);
-    }
-
-    Object *Copy() override {
-        auto copiedFunction = new Function(this->functionName, this->body, this->parameters, this->shouldAutoReturn);
-        copiedFunction->cellVars = this->cellVars;
-        copiedFunction->closureVarsTable = this->closureVarsTable;
-        copiedFunction->SetContext(this->ctx);
-        copiedFunction->SetPos(this->startPos, this->endPos);
-        return copiedFunction;        
-    }
-
-    Object *SetContext(Context *ctx) override {
-        Object::SetContext(ctx);
-        return this;
-    }
-
-    Object *SetPos(Position *st, Position *et) override {
-        Object::SetPos(st, et);
-        return this;
-    }
-
-    inline std::string ToString() override {
-        return std::format("<function {} at {}>", this->functionName, (void *) this);
-    }
-};
-
-
-struct ClassObject : public Dictionary {
-    explicit ClassObject(const std::map<Object *, Object *> &elements) : Dictionary(elements) {}
-    std::string className;
-    bool isProto = true;
-
-    RuntimeResult *BuildClass() {
-        auto result = new RuntimeResult;
-        auto [className, error] = this->GetAttr("__cls__");
-        if (error != nullptr) {
-            return result->Failure(new ValueError(
-                "Class prototype without an '__cls__' attribute",
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        if (className->typeName != "String") {
-            return result->Failure(new TypeError(
-                std::format("Invilid type for '__cls__': '{}'", className->typeName),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        this->className = As<String>(className)->s.c_str();
-        this->typeName = "ClassObject";
-        return result->Success(nullptr);
-    }
-
-
-    inline std::string ToString() override {
-        if (isProto) {
-            return std::format("<Prototype of object '{}' at {}>", this->className, (void *) this);
-        } else {
-            std::stringstream ss;
-            ss << RED << this->className << RESET << " {\n  ";
-            int idx = 0;
-            for (const auto &[k, v] : this->elements) {
-                std::string s;
-                if (idx + 1 == this->elements.size()) {
-                    s = "\n}";
-                } else {
-                    s = ",\n  ";
-                }
-                std::string vs;
-                if (v->typeName == std::string("Function")) {
-                    vs = "[Function]";
-                } else if (v->typeName == std::string("BuiltinFunction")) {
-                    vs = "[Native Function]";
-                } else if (v->typeName == std::string("BuiltinMethod")) {
-                    vs = "[Native Method]";
-                } else if (v->typeName == std::string("String")) {
-                    vs = std::format("'{}'", v->ToString());
-                } else {
-                    if (v->typeName == std::string("ClassObject")) {
-                        auto co = As<ClassObject>(v);
-                        if (co->className == this->className) {
-                            vs = "[this]";
-                        } else {
-                            vs = std::format("[Object {}]", co->className);
-                        }
-                    } else  {
-                        vs = v->ToString();
-                    }
-                }
-                ss << std::format("'{}': ", k->ToString());
-                ss << CYAN;
-                ss << std::format("{}", vs);
-                ss << RESET;
-                ss << std::format("{}", s);
-                idx++;
-            }
-            return ss.str();
-        }
-    }
-
-    Object *Copy() override {
-        auto copy = new ClassObject(this->elements);
-        copy->className = this->className;
-        copy->isProto = this->isProto;
-        copy->SetContext(this->ctx)->SetPos(this->startPos, this->endPos);
-        copy->BuildClass();
-        return copy;
-    }
-
-    Object *Instantiate(const std::vector<Object *> &args, Context *ctx, Position *st, Position *et);
-};
-
-struct Method : public Function {
-    Object *self;
-
-    static Method *FromFunction(Function *f, Object *self, const std::string &name = "<anonymous>") {
-        auto m = new Method(f->functionName, f->body, f->parameters, f->shouldAutoReturn);
-        m->SetPos(f->startPos, f->endPos);
-        m->SetContext(f->ctx);
-        m->self = self;
-        m->functionName = name;
-        return m;
-    }
-
-    explicit Method(const std::string &name, NodeBase *body, std::vector<std::string> args, bool shouldAutoReturn)
-        : Function(name, body, args, shouldAutoReturn), Object("Method") {}
-
-    RuntimeResult *CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args) override {
-        auto result = new RuntimeResult;
-        result->Register(this->CheckMutableArgument(argNames, args, true));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-
-         if (args.size() + 1 < argNames.size()) {
-                return result->Failure(new RuntimeError(
-                std::format("Too few arguments given to method '{}' (Expected at least {} but got {})", this->functionName, argNames.size() - 1, args.size()),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-
-        return result->Success(nullptr);
-    }
-    
-    RuntimeResult *PopulateArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx) override {
-        if (argNames.size() == 0) {
-            return Function::PopulateArguments(argNames, args, execCtx);
-        }
-        if ((args.size() < argNames.size() - 1 && hasMutableArgument) || (args.size() != argNames.size() - 1 && !hasMutableArgument)) {
-            return (new RuntimeResult)->Failure(new TypeError(
-                std::format("Invilid argument sequence length of method '{}': {} (requires {})", this->functionName, args.size(), argNames.size() - 1),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        execCtx->symbols->Set(argNames[0], this->self);
-        std::vector<std::string> remain;
-        for (int i = 1; i < argNames.size(); i++) {
-            remain.push_back(argNames[i]);
-        }
-
-        return Function::PopulateArguments(remain, args, execCtx);
-    }
-
-    Object *Copy() override {
-        auto copiedMethod = new Method(this->functionName, this->body, this->parameters, this->shouldAutoReturn);
-        copiedMethod->self = this->self;
-        copiedMethod->SetContext(this->ctx);
-        copiedMethod->SetPos(this->startPos, this->endPos);
-        return copiedMethod;
-    }
-
-    inline std::string ToString() override {
-        std::string tpName;
-        if (this->self->typeName == std::string("ClassObject")) {
-            tpName = As<ClassObject>(this->self)->className;
-        } else {
-            tpName = this->self->typeName;
-        }
-        return std::format("<bound-method {} at {} of object '{}' at {}>", this->functionName, (void *) this, tpName, (void *) self);
-    }
-};
-
-
-void Interprete(const std::string &, const std::string &, InterpreterStartMode, const std::string & = "", Context * = nullptr, Position *parentEntry = nullptr);
-void SetBuiltins(SymbolTable *global);
-const std::vector<std::string> builtinNames { 
-    "print", "println", "typeof", "readLine", "len", "parseInt", "parseFloat", "str", "eval",
-    "sin", "cos", "tan", "abs", "log", "ln", "sqrt", "isFloating", "isInteger",
-    "input", "import", "set", "require",
-    "readFile", "writeFile", "append", "concat", "remove", "builtins", "panic", "del",
-    "range", "addressOf", "keys", "values", "global", "recover", "BigInteger", "exit"
-};
-
-std::map<std::string, std::string> *envVars = nullptr;
-const std::map<std::string, std::string> requiredEnvVars = { 
-    { "native-lib-path", "lib/" },
-    { "builtins-import-path", "builtins/" },
-    { "version", YAN_LANG_VERSION }
-};
-
-
-namespace builtins {
-    using YanArgumentListType = std::vector<Object *> &;
-    using YanContext = Context *;
-    using YanObject = RuntimeResult *;
-    using BuiltinFunctionImplementation = std::function<RuntimeResult *(YanContext)>;
-    
-    void AllocEnvVars() {
-        ::envVars = new std::map<std::string, std::string>;
-    }
-
-    bool HasEnvVar(const std::string &key) {
-        if (envVars == nullptr) {
-            std::cerr << "Fatal: Env has not been allocated, builtins::AllocEnv() should be called before operation" << std::endl;
-            assert(false);
-        }
-        return ::envVars->find(key) != ::envVars->end();
-    }
-
-    void SetEnvVar(const std::string &key, const std::string &val) {
-        if (envVars == nullptr) {
-            std::cerr << "Fatal: Env has not been allocated, builtins::AllocEnv() should be called before operation" << std::endl;
-            assert(false);
-        }
-        if (!HasEnvVar(key)) {
-            ::envVars->insert(std::make_pair(key, val));
-        } else {
-            (*::envVars)[key] = val;
-        }
-    }
-
-    std::string GetEnvVar(const std::string &key) {
-        if (envVars == nullptr) {
-            std::cerr << "Fatal: Env has not been allocated, builtins::AllocEnv() should be called before operation" << std::endl;
-            assert(false);
-        }
-        if (!HasEnvVar(key)) {
-            std::cerr << "Fatal: Invilid env key: " << key << std::endl;
-            assert(false);
-        }
-        return (*::envVars)[key];
-    }
-
-    // default
-    void RestoreEnvVar() {
-        if (envVars == nullptr) {
-            std::cerr << "Fatal: Env has not been allocated, builtins::AllocEnv() should be called before operation" << std::endl;
-            assert(false);
-        }
-        std::fstream file;
-        file.open("./env.def", std::ios::in);
-        std::string buf;
-
-        if (file.is_open()) {
-            while (std::getline(file, buf)) {
-                auto def = Split(buf, "=");
-                if (def.size() != 2) {
-                    std::cerr << "Fatal: Invilid env definition: " << buf << std::endl;
-                    assert(false); 
-                }
-
-                SetEnvVar(def[0], def[1]);
-            }      
-            file.close();        
-        }
-
-        for (auto [requiredKey, defaultVal] : requiredEnvVars) {
-            if (!HasEnvVar(requiredKey)) {
-                SetEnvVar(requiredKey, defaultVal);
-            }
-        }
-    }
-
-    std::map<std::string, std::string> GetVars() {
-        auto vars = *::envVars;
-        return vars;
-    }
-
-    struct YanModule {
-        YanModule(const std::string &moduleName) : moduleName(moduleName) {}
-        YanModule *AddSymbol(const std::string &symbolName, std::vector<std::string> &&decl) {
-            if (decl.size() != 0) {
-                this->functionArgumentDeclearation.insert(std::make_pair(symbolName, decl));
-            }
-            this->symbols.push_back(symbolName);
-            return this;
-        }
-
-        std::string moduleName;
-        std::vector<std::string> symbols;
-        std::map<std::string, std::vector<std::string>> functionArgumentDeclearation;
-    };
-
-    using YanModuleDeclearation = YanModule *;
-    using ModuleLoaderFunc = YanModuleDeclearation (*)();
-
-    
-    [[noreturn]] YanObject Invilid(YanContext ctx) {
-        std::cerr << "Fatal: Unknown builtin access" << std::endl;
-        assert(false);
-    }
-
-    Error *AssertYanTypeMatches(YanContext ctx, Object *obj, const std::string &argName, const std::vector<std::string> &validTypes) {
-        if (!Lexer::Contains(validTypes, std::string(obj->typeName))) {
-            return new TypeError(
-                std::format("Type of argument '{}' mismatched: Requires one of {} but got {}", argName, StringifyStringSequence(validTypes), obj->typeName),
-                obj->startPos, obj->endPos, ctx
-            );
-        }
-        return nullptr;
-    }
-
-    namespace IO {
-        YanObject Println(YanContext ctx) {
-            std::cout << ctx->symbols->Get("_str")->ToString() << std::endl;
-            return (new RuntimeResult)->Success(Number::null);
-        }
-
-        YanObject Readline(YanContext ctx) {
-            std::string s;
-            std::getline(std::cin, s);
-            return (new RuntimeResult)->Success(new String(s));
-        }
-
-        YanObject Input(YanContext ctx) {
-            auto prompt = ctx->symbols->Get("__prompt__");
-            if (prompt != nullptr) {
-                std::cout << prompt->ToString();
-            }
-            std::string s;
-            std::getline(std::cin, s);
-            return (new RuntimeResult)->Success(new String(s));
-        }
-
-        YanObject ReadFile(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg = ctx->symbols->Get("_filename");
-            auto err = AssertYanTypeMatches(ctx, arg, "_filename", { "String" });
-            if (err != nullptr) {
-                return result->Failure(err);
-            }
-            auto file = As<String>(arg)->s;
-
-            std::ifstream ifs;
-            ifs.open(file, std::ios::in);
-            if (!ifs.is_open()) {
-                return result->Failure(new OSError(
-                    std::format("Failed to open file: '{}'", file),
-                    arg->startPos, arg->endPos, ctx
-                ));
-            }
-            std::ostringstream oss;
-            oss << ifs.rdbuf();
-            auto content = oss.str();
-            ifs.close();
-
-            return result->Success(new String(content));
-        }
-
-        YanObject WriteFile(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg1 = ctx->symbols->Get("_filename");
-            auto arg2 = ctx->symbols->Get("_str");
-            auto arg3 = ctx->symbols->Get("__mode__");
-            std::fstream fileStream;
-            std::ios_base::openmode mode;
-
-            if (arg3 != nullptr) {
-                if (arg3->typeName != std::string("String")) {
-                    return result->Failure(new TypeError(
-                        "File open mode should be a string",
-                        arg3->startPos, arg3->endPos, ctx
-                    ));
-                }
-                auto modeString = As<String>(arg3)->s;
-                if (modeString == "w") {
-                    mode = std::ios::out;
-                } else if (modeString == "wa") {
-                    mode = std::ios::out | std::ios::app;
-                } else {
-                    return result->Failure(new ValueError(
-                        std::format("Invilid file open mode: \'{}\'", modeString),
-                        arg3->startPos, arg3->endPos, ctx
-                    ));
-                }
-            } else {
-                mode = std::ios::out;
-            }
-
-            if (arg1->typeName != std::string("String")) {
-                return result->Failure(new TypeError(
-                    "Expected a path with string type",
-                    arg3->startPos, arg3->endPos, ctx
-                ));
-            }
-            if (arg2->typeName != std::string("String")) {
-                return result->Failure(new TypeError(
-                    "Content should be a string",
-                    arg2->startPos, arg2->endPos, ctx
-                ));
-            }
-
-            auto filePath = As<String>(arg1)->s;
-            auto content = As<String>(arg2)->s;
-            fileStream.open(filePath, mode);
-            if (!fileStream.is_open()) {
-                return result->Failure(new OSError(
-                    std::format("Failed to open file: '{}'", filePath),
-                    arg1->startPos, arg1->endPos, ctx
-                ));
-            }
-            fileStream << content;
-            fileStream.close();
-            return result->Success(Number::null);
-        }
-
-        YanObject Print(YanContext ctx) {
-            std::cout << ctx->symbols->Get("_str")->ToString();
-            return (new RuntimeResult)->Success(Number::null);
-        }
-    }
-
-    namespace Math {
-        bool HoldsInteger(Number *n) {
-            return std::holds_alternative<int>(n->value);
-        }
-        
-        int GetInt(Number *n) {
-            assert(HoldsInteger(n));
-            return std::get<int>(n->value);
-        }
-
-        double GetFloat(Number *n) {
-            assert(!HoldsInteger(n));
-            return std::get<double>(n->value);
-        }
-
-        // For only 1 argument
-        template<typename T>
-        YanObject _MathFunc(YanContext ctx, YanObject o, T func) {
-            auto arg = ctx->symbols->Get("_x");
-            auto err = AssertYanTypeMatches(ctx, arg, "_x", { "Number" });
-            if (err != nullptr) {
-                return o->Failure(err);
-            }
-            auto num = dynamic_cast<Number *>(arg);
-            
-            return o->Success(new Number(func(HoldsInteger(num) ? GetInt(num) : GetFloat(num))));
-        }
-
-        YanObject Sin(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto sin_ = [](double x) { return sin(x); };
-            return _MathFunc(ctx, result, sin_);
-        }
-
-        YanObject Cos(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto cos_ = [](double x) { return cos(x); };
-            return _MathFunc(ctx, result, cos_);
-        }
-
-        YanObject Tan(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto tan_ = [](double x) { return tan(x); };
-            return _MathFunc(ctx, result, tan_);
-        }
-
-        YanObject Abs(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto abs_ = [](double x) { return x > 0 ? x : -x; };
-            return _MathFunc(ctx, result, abs_);
-        }
-
-        YanObject Log(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto log_ = [](double x) { return log10(x); };
-            return _MathFunc(ctx, result, log_);
-        }
-
-        YanObject Ln(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto ln_ = [](double x) { return log(x); };
-            return _MathFunc(ctx, result, ln_);
-        }
-
-        YanObject Sqrt(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto sqrt_ = [](double x) { return sqrt(x); };
-            return _MathFunc(ctx, result, sqrt_);
-        }
-
-        YanObject IsFloating(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg = ctx->symbols->Get("_num");
-            auto err = AssertYanTypeMatches(ctx, arg, "_num", { "Number" });
-            if (err != nullptr) {
-                return result->Failure(err);
-            }
-
-            auto num = As<Number>(arg);
-            int v = (int) !HoldsInteger(num);
-            return result->Success(new Number(v));
-        }
-
-        YanObject IsInteger(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg = ctx->symbols->Get("_num");
-            auto err = AssertYanTypeMatches(ctx, arg, "_num", { "Number" });
-            if (err != nullptr) {
-                return result->Failure(err);
-            }
-
-            auto num = As<Number>(arg);
-            int v = (int) HoldsInteger(num);
-            return result->Success(new Number(v));
-        }
-    }
-
-    YanObject Len(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto len = ctx->symbols->Get("_seq")->Len();
-        if (len.first == nullptr) {
-            return result->Failure(len.second);
-        }
-        return result->Success(len.first);
-    }
-
-    namespace List_ {
-        YanObject Append(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg = ctx->symbols->Get("_lst");
-            auto o = ctx->symbols->Get("_o");
-            auto err = AssertYanTypeMatches(ctx, arg, "_lst", { "List" });
-            if (err != nullptr) {
-                return result->Failure(err);
-            }
-            auto lst = As<List>(arg);
-            lst->elements.push_back(o);
-            return result->Success(Number::null);
-        } 
-
-        YanObject Remove(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg = ctx->symbols->Get("_lst");
-            auto arg2 = ctx->symbols->Get("_idx");
-            auto err = AssertYanTypeMatches(ctx, arg, "_lst", { "List" });
-            auto err2 = AssertYanTypeMatches(ctx, arg2, "_idx", { "Number" });
-            if (err != nullptr) {
-                return result->Failure(err);
-            }
-            if (err2 != nullptr) {
-                return result->Failure(err2);
-            }
-
-            auto lst = As<List>(arg);
-            auto idx = As<Number>(arg2);
-            if (!Math::HoldsInteger(idx)) {
-                return result->Failure(new TypeError(
-                    "List index must be an integer",
-                    idx->startPos, idx->endPos, ctx
-                ));
-            }
-            auto indexReal = Math::GetInt(idx);
-            if (indexReal < 0) {
-                return result->Failure(new TypeError(
-                    "List index must be a positive integer",
-                    idx->startPos, idx->endPos, ctx
-                ));  
-            }
-            lst->elements.erase(lst->elements.begin() + indexReal);
-            return result->Success(Number::null);
-        }
-
-        YanObject Concat(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg = ctx->symbols->Get("_lst1");
-            auto arg2 = ctx->symbols->Get("_lst2");
-            auto err = AssertYanTypeMatches(ctx, arg, "_lst1", { "List" });
-            auto err2 = AssertYanTypeMatches(ctx, arg2, "_lst2", { "List" });
-            if (err != nullptr) {
-                return result->Failure(err);
-            }
-            if (err2 != nullptr) {
-                return result->Failure(err2);
-            }
-
-            auto lst = As<List>(arg);
-            auto idx = As<List>(arg2);
-            for (auto &e : idx->elements) {
-                lst->elements.push_back(e);
-            }
-            return result->Success(Number::null);
-        }
-
-        YanObject Range(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg1 =  ctx->symbols->Get("_a");
-            auto arg2 = ctx->symbols->Get("__b__");
-            auto arg3 = ctx->symbols->Get("__c__");
-            Number *a = nullptr;
-            Number *b = nullptr;
-            Number *c = nullptr;
-
-            auto checkArg = [](Number *n) { 
-                return ::builtins::Math::HoldsInteger(n) && n->ntype == NumberType::Int && ::builtins::Math::GetInt(n) >= 0;
-            };
-
-            if (arg1->typeName == "Number") {
-                a = As<Number>(arg1);
-                if (!checkArg(a)) {
-                    return result->Failure(new ValueError(
-                        "range(x) requires an positive integer",
-                        arg1->startPos, arg1->endPos, ctx
-                    ));
-                }
-            } else {
-                return result->Failure(new TypeError(
-                    "range() requires number as parameters",
-                    arg1->startPos, arg1->endPos, ctx
-                ));
-            }
-            assert(!(arg2 == nullptr && arg3 != nullptr));
-
-            auto check = [ctx, checkArg](Object *arg1) {
-                auto result = new RuntimeResult;
-                if (arg1->typeName == "Number") {
-                    auto n = As<Number>(arg1);
-                    if (!checkArg(n)) {
-                        return result->Failure(new ValueError(
-                            "range(x) requires an positive integer",
-                            arg1->startPos, arg1->endPos, ctx
-                        ));
-                    }
-                    return result->Success(nullptr);
-                } else {
-                    return result->Failure(new TypeError(
-                        "range() requires number as parameters",
-                        arg1->startPos, arg1->endPos, ctx
-                    ));
-                }
-            };
-
-            if (arg2 != nullptr && arg3 == nullptr) {
-                result->Register(check(arg2));
-                if (result->ShouldReturn()) {
-                    return result;
-                }
-                b = As<Number>(arg2);
-                std::vector<Object *> iter;
-                for (int i = ::builtins::Math::GetInt(a); i < ::builtins::Math::GetInt(b); i++) {
-                    iter.push_back(new Number(i));
-                } 
-                return result->Success(new List(iter));
-            } else if (arg2 != nullptr && arg3 != nullptr) {
-                result->Register(check(arg2));
-                if (result->ShouldReturn()) {
-                    return result;
-                }
-                result->Register(check(arg3));
-                if (result->ShouldReturn()) {
-                    return result;
-                }
-                b = As<Number>(arg2);
-                c = As<Number>(arg3);
-                
-                std::vector<Object *> iter;
-                for (int i = ::builtins::Math::GetInt(a); i < ::builtins::Math::GetInt(b); i += ::builtins::Math::GetInt(c)) {
-                    iter.push_back(new Number(i));
-                } 
-                return result->Success(new List(iter));
-            } else {
-                std::vector<Object *> iter;
-                for (int i = 0; i < ::builtins::Math::GetInt(a); i++) {
-                    iter.push_back(new Number(i));
-                } 
-                return result->Success(new List(iter));
-            }
-        }
-
-        YanObject Keys(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg = ctx->symbols->Get("_dict");
-            auto err = AssertYanTypeMatches(ctx, arg, "_dict", { "Dictionary" });
-            if (err != nullptr) {
-                return result->Failure(err);
-            }
-            auto dict = As<Dictionary>(arg);
-            return result->Success(new List(dict->GetKeys()));
-        }
-
-        YanObject Values(YanContext ctx) {
-            auto result = new RuntimeResult;
-            auto arg = ctx->symbols->Get("_dict");
-            auto err = AssertYanTypeMatches(ctx, arg, "_dict", { "Dictionary" });
-            if (err != nullptr) {
-                return result->Failure(err);
-            }
-
-            auto dict = As<Dictionary>(arg);
-            std::vector<Object *> values;
-            for (auto &[k, v] : dict->elements) {
-                values.push_back(v);
-            }
-            return result->Success(new List(values));
-        }
-    }
-    
-    YanObject Set(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto argLst = ctx->symbols->Get("_lst");
-        auto argIdx = ctx->symbols->Get("_idx");
-        auto argValue = ctx->symbols->Get("_value");
-        auto err1 = AssertYanTypeMatches(ctx, argLst, "_lst", { "List" });
-        if (err1 != nullptr) {
-            return result->Failure(err1);
-        }
-        auto err2 = AssertYanTypeMatches(ctx, argIdx, "_idx", { "Number" });
-        if (err2 != nullptr) {
-            return result->Failure(err2);
-        }
-
-        auto lst = As<List>(argLst);
-        auto index = As<Number>(argIdx);
-        if (index->ntype != NumberType::Int) {
-            return result->Failure(new ValueError(
-                "List index must be an integer",
-                index->startPos, index->endPos, ctx
-            ));
-        } else if (Math::GetInt(index) < 0) {
-            return result->Failure(new ValueError(
-                "Negative index not allowed here",
-                index->startPos, index->endPos, ctx
-            ));
-        }
-
-        lst->elements[Math::GetInt(index)] = argValue;
-        return result->Success(Number::null);
-    }
-
-    YanObject _InterpreteModule(const std::string &moduleFile, const std::string &symbolName, Position *st, Position *et, YanContext ctx) {
-        auto result = new RuntimeResult;
-        std::ifstream ifs;
-        ifs.open(moduleFile, std::ios::in);
-        if (!ifs.is_open()) {
-            ifs.clear();
-            ifs.open(std::format("{}/{}", GetEnvVar("builtins-import-path"), moduleFile), std::ios::in);
-            if (!ifs.is_open()) {
-                return result->Failure(new OSError(
-                    std::format("Failed to open module: '{}'", moduleFile),
-                    st, et, ctx
-                ));
-            }
-        }
-        std::ostringstream oss;
-        oss << ifs.rdbuf();
-        auto code = oss.str();
-
-        auto lexer = new Lexer(moduleFile, ToWideString(code));
-        auto [tokens, err] = lexer->MakeTokens();
-        if (err != nullptr) {
-            return result->Failure(err);
-        }
-        auto parser = new Parser(tokens);
-        auto parseR = parser->Parse();
-        if (parseR->err != nullptr) {
-            return result->Failure(parseR->err);
-        }
-        auto moduleContext = new Context(std::format("<module '{}'>", moduleFile));
-        moduleContext->parent = ctx;
-        moduleContext->parentEntry = st;
-        moduleContext->symbols = new SymbolTable;
-        SetBuiltins(moduleContext->symbols);
-        auto interpreter = new Interpreter;
-        result->Register(interpreter->Visit(parseR->ast, moduleContext));
-        if (result->ShouldReturn()) {
-            return result->Failure(new RuntimeError(
-                std::format("Failed to load module: '{}'", moduleFile),
-                st, et, ctx
-            ), result->error);
-        }
-
-        auto symbol = moduleContext->symbols->Get(symbolName);
-        if (symbol == nullptr) {
-            return result->Failure(new RuntimeError(
-                std::format("Module '{}' has no symbol '{}'", moduleFile, symbolName),
-                st, et, ctx
-            ));
-        }
-        // if (symbol->typeName != "Function") {
-        //     return result->Failure(new ValueError(
-        //         "Only functions can be imported", st, et, ctx
-        //     ));
-        // }
-
-        auto symbolCopy = symbol->Copy();
-        moduleContextCache.insert(std::make_pair(moduleFile, moduleContext));        
-        symbolsModuleLocation.insert(std::make_pair(symbolName, moduleFile));
-        delete lexer;
-        delete parser;
-        delete parseR;
-        delete interpreter;
-        return result->Success(symbolCopy);
-    }
-
-    YanObject _ImportModule(const std::string &moduleFile, YanContext dest, Position *st, Position *et, YanContext ctx) {
-        auto result = new RuntimeResult;
-        std::ifstream ifs;
-        ifs.open(moduleFile, std::ios::in);
-        if (!ifs.is_open()) {
-            ifs.clear();
-            ifs.open(std::format("{}/{}", GetEnvVar("builtins-import-path"), moduleFile), std::ios::in);
-            if (!ifs.is_open()) {
-                return result->Failure(new OSError(
-                    std::format("Failed to open module: '{}'", moduleFile),
-                    st, et, ctx
-                ));
-            }
-        }
-        std::ostringstream oss;
-        oss << ifs.rdbuf();
-        auto code = oss.str();
-
-        auto lexer = new Lexer(moduleFile, ToWideString(code));
-        auto [tokens, err] = lexer->MakeTokens();
-        if (err != nullptr) {
-            return result->Failure(err);
-        }
-        auto parser = new Parser(tokens);
-        auto parseR = parser->Parse();
-        if (parseR->err != nullptr) {
-            return result->Failure(parseR->err);
-        }
-        auto moduleContext = new Context(std::format("<module '{}'>", moduleFile));
-        moduleContext->parent = ctx;   
-        moduleContext->parentEntry = st;             
-        moduleContext->symbols = new SymbolTable;
-        SetBuiltins(moduleContext->symbols);
-        auto interpreter = new Interpreter;
-        result->Register(interpreter->Visit(parseR->ast, moduleContext));
-        if (result->ShouldReturn()) {
-            return result->Failure(new RuntimeError(
-                std::format("Failed to load module: '{}'", moduleFile),
-                st, et, ctx
-            ), result->error);
-        }
-        moduleContextCache.insert(std::make_pair(moduleFile, moduleContext));
-
-        for (auto &[symbolName, symbol] : moduleContext->symbols->symbols) {
-            if (symbol->typeName != "BuiltinFunction" || !Lexer::Contains(builtinNames, symbolName)) {
-                dest->symbols->Set(symbolName, symbol->Copy());
-                symbolsModuleLocation.insert(std::make_pair(symbolName, moduleFile));
-            }
-        }
-
-        return result->Success(Number::null);
-    }
-    
-    YanObject _useModule(const std::string &moduleFile, YanContext dest, Position *st, Position *et, YanContext ctx) {
-        auto result = new RuntimeResult;
-        std::ifstream ifs;
-        ifs.open(moduleFile + ".yan", std::ios::in);
-        if (!ifs.is_open()) {
-            ifs.clear();
-            ifs.open(std::format("{}/{}", GetEnvVar("builtins-import-path"), moduleFile + ".yan"), std::ios::in);
-            if (!ifs.is_open()) {
-                return result->Failure(new OSError(
-                    std::format("Failed to open module: '{}'", moduleFile),
-                    st, et, ctx
-                ));
-            }
-        }
-        std::ostringstream oss;
-        oss << ifs.rdbuf();
-        auto code = oss.str();
-
-        auto lexer = new Lexer(moduleFile, ToWideString(code));
-        auto [tokens, err] = lexer->MakeTokens();
-        if (err != nullptr) {
-            return result->Failure(err);
-        }
-        auto parser = new Parser(tokens);
-        auto parseR = parser->Parse();
-        if (parseR->err != nullptr) {
-            return result->Failure(parseR->err);
-        }
-        auto moduleContext = new Context(std::format("<module '{}'>", moduleFile));
-        moduleContext->parent = ctx;        
-        moduleContext->parentEntry = st;        
-        moduleContext->symbols = new SymbolTable;
-        moduleContext->SetExternal(true);
-        SetBuiltins(moduleContext->symbols);
-        auto interpreter = new Interpreter;
-        result->Register(interpreter->Visit(parseR->ast, moduleContext));
-        if (result->ShouldReturn()) {
-            return result->Failure(new RuntimeError(
-                std::format("Failed to load module: '{}'", moduleFile),
-                st, et, ctx
-            ), result->error);
-        }
-        moduleContextCache.insert(std::make_pair(moduleFile, moduleContext));
-
-        std::map<Object *, Object *> moduleSymbols;
-        for (auto &[symbolName, symbol] : moduleContext->symbols->symbols) {
-            if (symbol->typeName != "BuiltinFunction" || !Lexer::Contains(builtinNames, symbolName)) {
-                moduleSymbols.insert(std::make_pair(new String(symbolName), symbol));
-                symbolsModuleLocation.insert(std::make_pair(symbolName, moduleFile));
-            }
-        }
-
-        auto p = Split(moduleFile, "/");
-        std::string importName {};
-        if (p.size() != 1) {
-            importName = p[p.size() - 1];
-        } else {
-            importName = moduleFile;
-        }
-        dest->symbols->Set(importName, new Dictionary(moduleSymbols));
-        return result->Success(Number::null);
-    }
-
-    // YanObject _LoadNativeModuleFromStub(const std::string &moduleStub, YanContext dest, Position *st, Position *et, YanContext ctx) {
-
-    // }
-
-    // auto ::LoadNativeFunctionImplementation(const std::string &dynamicLib, const std::string &name) -> RuntimeResult *(*)(Context *);
-    YanObject _LoadNativeSymbol(const std::string &mod, const std::string &symbolName, Position *st, Position *et, YanContext ctx);
-
-    YanObject Import(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto arg = ctx->symbols->Get("_symbol");
-        auto err = AssertYanTypeMatches(ctx, arg, "_symbol", { "String" });
-        if (err != nullptr) {
-            return result->Failure(err);
-        }
-        auto argString = As<String>(arg)->s;
-
-        if (!argString.starts_with("@")) {
-            auto symbolInfo = Split(argString, ".");
-            if (symbolInfo.size() != 1 && symbolInfo.size() != 2) {
-                return result->Failure(new ValueError(
-                    std::format("Invilid import specification: '{}'", arg->ToString()),
-                    arg->startPos, arg->endPos, ctx
-                ));
-            }
-            if (symbolInfo.size() == 2) {
-                auto symbolSourceFile = symbolInfo[0] + ".yan";
-                auto symbolName = symbolInfo[1];
-                auto symbol = _InterpreteModule(symbolSourceFile, symbolName, arg->startPos, arg->endPos, ctx);
-                if (symbol->error != nullptr) {
-                    return result->Failure(symbol->error, symbol->cause);
-                }
-
-                return result->Success(symbol->value);
-            } else {
-                auto destCtx = ctx->parent;
-                auto status = _useModule(symbolInfo[0], destCtx, arg->startPos, arg->endPos, ctx);
-                if (status->error != nullptr) {
-                    return result->Failure(status->error, status->cause);
-                }
-                return result->Success(Number::null);
-            }
-        } else {
-            return result->Failure(new ValueError(
-                "\'import\' does not support to load an native implementation",
-                arg->startPos, arg->endPos, ctx
-            ));
-        }
-    }
-
-    YanObject Require(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto arg = ctx->symbols->Get("_module");
-        auto err = AssertYanTypeMatches(ctx, arg, "_module", { "String" });
-        if (err != nullptr) {
-            return result->Failure(err);
-        }
-
-        auto argString = As<String>(arg)->s;
-        if (!argString.starts_with("@")) {
-            auto moduleName = argString + ".yan";
-            auto destCtx = ctx->parent;
-            auto status = _ImportModule(moduleName, destCtx, arg->startPos, arg->endPos, ctx);
-            if (status->error != nullptr) {
-                return result->Failure(status->error, status->cause);
-            }
-
-            return result->Success(Number::null);
-        } else {
-            auto moduleDescr = Split(argString.substr(1), ".");
-            if (moduleDescr.size() != 2) {
-                return result->Failure(new ValueError(
-                    "Invilid symbol location",
-                    arg->startPos, arg->endPos, ctx
-                ));
-            }
-            auto moduleName = moduleDescr[0];
-            auto symbol = moduleDescr[1];
-
-            auto destCtx = ctx->parent;
-            auto symbolValue = _LoadNativeSymbol(moduleName, symbol, arg->startPos, arg->endPos, ctx);
-            if (symbolValue->error != nullptr) {
-                return result->Failure(symbolValue->error);
-            }
-            return result->Success(symbolValue->value);
-        }
-    }
-
-    YanObject Eval(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto code = ctx->symbols->Get("_code");
-        if (code->typeName != std::string("String")) {
-            return result->Failure(new TypeError(
-                std::format("Argument '_code' must be a String (got {})", code->typeName),
-                code->startPos, code->endPos, ctx
-            ));
-        }
-
-        auto evaluationFrameId = std::format("<eval frame at {}>", (void *) ctx);
-        Interprete(evaluationFrameId, dynamic_cast<String *>(code)->s, InterpreterStartMode::Evaluation, evaluationFrameId, ctx, code->startPos);
-        return result->Success(Number::null);
-    }
-
-    YanObject ParseInt(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto yanStr = ctx->symbols->Get("_str");
-        if (yanStr->typeName != std::string("String")) {
-            return result->Failure(new TypeError(
-                std::format("Argument '_str' must be a String (got {})", yanStr->typeName),
-                yanStr->startPos, yanStr->endPos, ctx
-            ));
-        }
-        return (new RuntimeResult)->Success(new Number((int) Lexer::ParseInt(dynamic_cast<String *>(yanStr)->s)));
-    }
-
-    YanObject ParseFloat(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto yanStr = ctx->symbols->Get("_str");
-        if (yanStr->typeName != std::string("String")) {
-            return result->Failure(new TypeError(
-                std::format("Argument '_str' must be a String (got {})", yanStr->typeName),
-                yanStr->startPos, yanStr->endPos, ctx
-            ));
-        }
-        return (new RuntimeResult)->Success(new Number((double) Lexer::ParseFloat(dynamic_cast<String *>(yanStr)->s)));
-    }
-
-    YanObject ToString(YanContext ctx) {
-        return (new RuntimeResult)->Success(new String(ctx->symbols->Get("_object")->ToString()));
-    }
-
-    YanObject TypeNameOf(YanContext ctx) {
-        auto obj = ctx->symbols->Get("_object");
-        if (obj->typeName == std::string("ClassObject")) {
-            return (new RuntimeResult)->Success(new String(std::format("[Class {}]", dynamic_cast<ClassObject *>(obj)->className)));
-        } else {
-            return (new RuntimeResult())->Success(new String(std::format("[builtins.{}]", std::string(obj->typeName))));
-        }
-    }
-
-    YanObject Builtins(YanContext ctx) {
-        auto builtinLst = new List({});
-        for (const auto &n : builtinNames)  {
-            builtinLst->elements.push_back(new String(n));
-        }
-        return (new RuntimeResult)->Success(builtinLst);
-    }
-
-    YanObject Panic(YanContext ctx) {
-        auto err = ctx->symbols->Get("_err");
-        return (new RuntimeResult)->Failure(new ::Panic(err->ToString(), err->startPos, err->endPos, ctx));
-    }
-
-    YanObject Del(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto arg = ctx->symbols->Get("_varName");
-        if (arg->typeName != "String") {
-            return result->Failure(new TypeError(
-                "del() requires a string name of variable",
-                arg->startPos, arg->endPos, ctx
-            ));
-        }
-
-        auto delVarName = As<String>(arg);
-        if (ctx->symbols->Get(delVarName->s) == nullptr) {
-            return result->Failure(new ValueError(
-                std::format("del('{}'): not defined", delVarName->s),
-                arg->startPos, arg->endPos, ctx
-            ));
-        }
-
-        auto var = ctx->symbols->Get(delVarName->s);
-        if (var->typeName == "BuiltinFunction") {
-            return result->Failure(new RuntimeError(
-                std::format("Attempted to delete non-user defined function: '{}'", delVarName->s),
-                arg->startPos, arg->endPos, ctx
-            ));
-        }
-        ctx->parent->symbols->Remove(delVarName->s);
-        delete var;
-        return result->Success(Number::null);
-    }
-
-    YanObject AddressOf(YanContext ctx) {
-        return (new RuntimeResult)->Success(
-            new String(std::format("{}", static_cast<void *>(ctx->symbols->Get("_object"))))
-        );
-    }
-
-    YanObject Global(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto arg = ctx->symbols->Get("_varName");
-        auto value = ctx->symbols->Get("_value");
-
-        if (arg->typeName != std::string("String")) {
-            return result->Failure(new TypeError(
-                "Variable name must be a string",
-                arg->startPos, arg->endPos, ctx
-            ));
-        }
-
-        auto varName = As<String>(arg)->s;
-        if (ctx->global->Get(varName) == nullptr)  {
-            return result->Failure(new ValueError(
-                std::format("Variable '{}' is not declared in global scope", varName),
-                arg->startPos, arg->endPos, ctx
-            ));
-        }
-
-        ctx->global->Set(varName, value);
-        return result->Success(Number::null);
-    }
-
-    YanObject Recover(YanContext ctx) {
-        auto result = new RuntimeResult;
-        auto arg = ctx->parent->symbols->Get("__lastexc__");
-
-        if (!ctx->parent || !ctx->parent->parent) {
-            return result->Failure(new ValueError(
-                "Cannot recover from top-level scope or a normal function",
-                nullptr, nullptr, ctx
-            ));
-        }
-        auto ret = ctx->symbols->Get("__ret__");
-
-        if (arg != nullptr) {
-            ctx->parent->symbols->Remove("__lastexc__");
-            if (!ret) {
-                ctx->parent->parent->symbols->Set("__recovered__", Number::null);            
-            } else {
-                ctx->parent->parent->symbols->Set("__recovered__", ret);            
-            }
-        }
-        return result->Success(Number::null);
-    }
-
-    YanObject BigInteger(YanContext ctx);
-
-    YanObject Exit(YanContext ctx) {
-        auto arg = ctx->symbols->Get("__code__");
-        int exitCode = 0;
-        if (arg) {
-            if (arg->typeName != std::string("Number")) {
-                auto nv = As<Number>(arg);
-                if (!Math::HoldsInteger(nv)) {
-                    return (new RuntimeResult)->Failure(new TypeError(
-                        "Exit code requires an integer",
-                        arg->startPos, arg->endPos, ctx
-                    ));
-                }
-                exitCode = Math::GetInt(nv);
-            }
-        }
-
-        exit(exitCode);
-        return (new RuntimeResult)->Success(nullptr);
-    }
-}
-
-const std::map<std::string, builtins::BuiltinFunctionImplementation> builtinFuncIndexes {
-    { "print", builtins::IO::Print },
-    { "println", builtins::IO::Println },
-    { "readLine", builtins::IO::Readline },
-    { "typeof", builtins::TypeNameOf },
-    { "len", builtins::Len },
-    { "parseInt", builtins::ParseInt },
-    { "parseFloat", builtins::ParseFloat },
-    { "str", builtins::ToString },
-    { "eval", builtins::Eval },
-    { "sin", builtins::Math::Sin },
-    { "cos", builtins::Math::Cos },
-    { "tan", builtins::Math::Tan },
-    { "abs", builtins::Math::Abs },
-    { "log", builtins::Math::Log },
-    { "ln", builtins::Math::Ln },
-    { "sqrt", builtins::Math::Sqrt },
-    { "input", builtins::IO::Input },
-    { "import", builtins::Import },
-    { "set", builtins::Set },
-    { "require", builtins::Require },
-    { "readFile", builtins::IO::ReadFile },
-    { "writeFile", builtins::IO::WriteFile },
-    { "append", builtins::List_::Append },
-    { "concat", builtins::List_::Concat },
-    { "remove", builtins::List_::Remove },
-    { "builtins", builtins::Builtins },
-    { "panic", builtins::Panic },
-    { "isFloating", builtins::Math::IsFloating },
-    { "isInteger", builtins::Math::IsInteger },
-    { "del", builtins::Del },
-    { "range", builtins::List_::Range },
-    { "addressOf", builtins::AddressOf },
-    { "keys", builtins::List_::Keys },
-    { "values", builtins::List_::Values },
-    { "global", builtins::Global },
-    { "recover", builtins::Recover },
-    { "BigInteger", builtins::BigInteger },
-    { "exit", builtins::Exit }
-};
-
-const std::map<std::string, std::vector<std::string>> builtinFuncParamsRegistry {
-    { "print" , { "_str" } },
-    { "println", { "_str" } },
-    { "typeof", { "_object" } },
-    { "len", { "_seq" } },
-    { "parseInt", { "_str" } },
-    { "parseFloat", { "_str" } },
-    { "str", { "_object" } },
-    { "eval", { "_code" } },
-    { "sin", { "_x" } },
-    { "cos", { "_x" } },
-    { "tan", { "_x" } },
-    { "abs", { "_x" } },
-    { "log", { "_x" } },
-    { "ln", { "_x" } },
-    { "sqrt", { "_x" } },
-    { "input", { "__prompt__" } },
-    { "import", { "_symbol" } },
-    { "set", { "_lst", "_idx", "_value" } },
-    { "require", { "_module" } },
-    { "readFile", { "_filename" } },
-    { "writeFile", { "_filename", "_str", "__mode__" } },
-    { "append", { "_lst", "_o" } },
-    { "concat", { "_lst1", "_lst2" } },
-    { "remove", { "_lst", "_idx" } },
-    { "panic", { "_err" } },
-    { "isFloating", { "_num" } },
-    { "isInteger", { "_num" } },
-    { "del", { "_varName" } },
-    { "range", { "_a", "__b__", "__c__" } },
-    { "addressOf", { "_object" } },
-    { "keys", { "_dict" } },
-    { "values", { "_dict" } },
-    { "global", { "_varName", "_value" } },
-    { "recover", { "__ret__" } },
-    { "BigInteger", { "__val__" } },
-    { "exit", { "__code__" } }
-};
-
-#ifdef __linux__
-    using DylibType = void *;
-#elif defined(_WIN32)
-    using DylibType = win32::HMODULE;
-#endif
-static std::map<std::string, std::pair<std::string, void *>> dynamicLoadedSymbol;
-std::map<std::string, DylibType> dylibs;
-std::map<std::string, builtins::YanModuleDeclearation> nativeModules;
-
-struct BuiltinFunction : public FunctionBase {
-    explicit BuiltinFunction(const std::string &name) : FunctionBase(name), Object("BuiltinFunction") {}
-    std::vector<std::string> argDeclearation;
-    bool dynamicBind = false;
-    builtins::BuiltinFunctionImplementation dynamicImpl = nullptr;
-
-    RuntimeResult *Execute(std::vector<Object *> args) {
-        auto result = new RuntimeResult;
-        auto frameContext = this->GenerateNewContext();
-        auto builtinFunctionName = this->functionName;
-        builtins::BuiltinFunctionImplementation func;
-
-        if (currentCallStackDepth > 1) {
-             currentCallStackDepth--; // built-in call does not take times of max calls
-        }
-        if (!this->dynamicBind) {
-            if (builtinFuncIndexes.find(builtinFunctionName) == builtinFuncIndexes.end()) {
-                if (dynamicLoadedSymbol.find(builtinFunctionName) != dynamicLoadedSymbol.end()) {
-                    func = (RuntimeResult *(*)(Context *)) dynamicLoadedSymbol.at(builtinFunctionName).second;
-                } else {
-                    func = builtins::Invilid;
-                }
-            } else {
-                func = builtinFuncIndexes.at(builtinFunctionName);
-            }
-        } else {
-            func = this->dynamicImpl;
-        }
-        // std::cout << std::boolalpha << this->dynamicBind << std::endl;
-        assert(func != nullptr);
-
-        if (builtinFuncParamsRegistry.find(builtinFunctionName) != builtinFuncParamsRegistry.end() && this->argDeclearation.size() == 0) {
-            result->Register(this->CheckAndPopulate(builtinFuncParamsRegistry.at(builtinFunctionName), args, frameContext));
-        } else if (this->argDeclearation.size() != 0) {
-            if (this->argDeclearation.size() == 1) {
-                if (this->argDeclearation[0] == std::string("void")) {
-                    if (args.size() != 0) {
-                        result->Register((new RuntimeResult)->Failure(new RuntimeError(
-                            std::format("Function '{}' decleared as `void` should not take argument(s) [got {}]", functionName, args.size()),
-                            this->startPos, this->endPos, this->ctx
-                        )));
-                        return result;
-                    }
-                }
-            }
-            result->Register(this->CheckAndPopulate(this->argDeclearation, args, frameContext));
-        }
-        if (result->ShouldReturn()) {
-            return result;
-        }
-
-        auto returnValue = result->Register(func(frameContext));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        return result->Success(returnValue);
-    }
-
-    void Bind(const std::vector<std::string> &argDeclearation, builtins::BuiltinFunctionImplementation impl) {
-        this->dynamicBind = true;
-        this->argDeclearation = argDeclearation;
-        this->dynamicImpl = impl;
-    }
-
-    void Unbind() {
-        this->dynamicBind = false;
-        this->argDeclearation.clear();
-        this->dynamicImpl = nullptr;
-    }
-
-    RuntimeResult *CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args) override {
-        auto result = new RuntimeResult;
-        unsigned expectedMost = 0, expectedLeast = 0;
-        for (auto argName : argNames) {
-            expectedMost++;
-            if (!argName.starts_with("__") || !argName.ends_with("__")) {
-                expectedLeast++;
-            }
-        }
-
-        if (args.size() > expectedMost) {
-            return result->Failure(new TypeError(
-                std::format("Too many arguments given to function '{}' (Expected {} to {} args but got {})", this->functionName, expectedLeast, expectedMost, args.size()),
-                this->startPos, this->endPos, this->ctx
-            ));
-        } else if (args.size() < expectedLeast) {
-            return result->Failure(new TypeError(
-                std::format("Too few arguments given to function '{}' (Expected {} to {} args but got {})", this->functionName, expectedLeast, expectedMost, args.size()),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        return result->Success(nullptr);
-    }
-
-    Object *Copy() override {
-        auto copy = new BuiltinFunction(this->functionName);
-        copy->SetContext(this->ctx)->SetPos(this->startPos, this->endPos);
-        copy->argDeclearation = this->argDeclearation;
-        if (this->dynamicBind) {
-            copy->Bind(this->argDeclearation, this->dynamicImpl);
-        }
-        return copy;
-    }
-
-    inline std::string ToString() override {
-        if (!this->dynamicBind) {
-            return std::format("<builtin-function {} at {}>", this->functionName, (void *) this);
-        } else {
-            return std::format("<native-function {} at {}>", this->functionName, (void *) this);
-        }
-    }
-};
-
-YAN_C_API_START builtins::YanObject Class_Default__init__(builtins::YanContext ctx) {
-    auto self = ctx->symbols->Get("self");
-    auto requiredArgs = self->GetAttr("__ctor_args__");
-    if (requiredArgs.first->typeName == std::string("Number")) {
-        return (new RuntimeResult)->Success(Number::null);
-    } else {
-        for (const auto item : As<List>(requiredArgs.first)->elements) {
-            auto attr = As<String>(item)->s;
-            auto value = ctx->symbols->Get(attr);
-            if (!value) {
-                return (new RuntimeResult)->Failure(
-                    new TypeError(
-                        "Missing required constructor args",
-                        self->startPos, self->endPos, ctx
-                    )
-                );
-            }
-            self->SetAttr(attr, value);
-        }
-    }
-
-    return (new RuntimeResult)->Success(Number::null);
-}
-YAN_C_API_END
-
-BuiltinFunction *defaultInitializer = nullptr;
-
-
-struct BuiltinMethod : public BuiltinFunction {
-    Object *self;
-
-    static BuiltinMethod *FromBuiltinFunction(BuiltinFunction *bf, Object *self) {
-        auto m = new BuiltinMethod(bf->functionName);
-        m->SetPos(bf->startPos, bf->endPos);
-        m->SetContext(bf->ctx);
-        m->self = self;
-        m->Bind(bf->argDeclearation, bf->dynamicImpl);
-        return m;
-    }
-
-    explicit BuiltinMethod(const std::string &name)
-        : BuiltinFunction(name), Object("BuiltinMethod") {}
-
-    RuntimeResult *CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args) override {
-        auto result = new RuntimeResult;
-        if (args.size() + 1 != argNames.size()) {
-            return result->Failure(new RuntimeError(
-                std::format("Invilid arguments given to method '{}' (Expected {} but got {})", this->functionName, argNames.size() - 1, args.size()),
-                this->startPos, this->endPos, this->ctx
-            ));
-        }
-        return result->Success(nullptr);
-    }
-    
-    RuntimeResult *PopulateArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx) override {
-        if (argNames.size() == 0) {
-            return BuiltinFunction::PopulateArguments(argNames, args, execCtx);
-        }
-
-        execCtx->symbols->Set(argNames[0], this->self);
-        std::vector<std::string> remain;
-        for (int i = 1; i < argNames.size(); i++) {
-            remain.push_back(argNames[i]);
-        }
-
-        return BuiltinFunction::PopulateArguments(remain, args, execCtx);
-    }
-
-    Object *Copy() override {
-        auto copiedMethod = new BuiltinMethod(this->functionName);
-        copiedMethod->self = this->self;
-        copiedMethod->SetContext(this->ctx);
-        copiedMethod->SetPos(this->startPos, this->endPos);
-        copiedMethod->argDeclearation = this->argDeclearation;
-        if (this->dynamicBind) {
-            copiedMethod->Bind(this->argDeclearation, this->dynamicImpl);
-        }
-        return copiedMethod;
-    }
-
-    inline std::string ToString() override {
-        std::string tpName;
-        if (this->self->typeName == std::string("ClassObject")) {
-            tpName = As<ClassObject>(this->self)->className;
-        } else {
-            tpName = this->self->typeName;
-        }
-        return std::format("<bound-method {} at {} of object '{}' at {} (dynamically-binded)>", this->functionName, (void *) this, tpName, (void *) self);
-    }
-};
-
-Object *ClassObject::Instantiate(const std::vector<Object *> &args, Context *ctx, Position *st, Position *et) {
-    auto result = new RuntimeResult;
-    auto object = As<ClassObject>(this->Copy());
-    object->isProto = false;
-    auto ctor = this->GetAttr("__init__");
-    assert(ctor.first != nullptr);
-    auto unboundedCtor = As<BuiltinFunction>(ctor.first);
-    auto boundedCtor = BuiltinMethod::FromBuiltinFunction(unboundedCtor, object);
-
-    object->SetContext(ctx)->SetPos(st, et);
-    result->Register(boundedCtor->Execute(args));
-    if (result->ShouldReturn()) {
-        std::cerr << "Internal interpreter error: " << result->error->name << ": " << result->error->details << std::endl;
-        std::cerr << "Native call stack traceback:" << std::endl << RuntimeError::GetNativeCallStackInfo() << std::endl;
-        assert(false);
-    }
-    return object;
-}
-
-static std::map<std::string, BuiltinFunction *> allBuiltins {
-    { "print", nullptr },
-    { "println", nullptr },
-    { "typeof", nullptr },
-    { "readLine", nullptr },
-    { "len", nullptr },
-    { "parseInt", nullptr },
-    { "parseFloat", nullptr },
-    { "str", nullptr },
-    { "eval", nullptr },
-    { "sin", nullptr },
-    { "cos", nullptr },
-    { "tan", nullptr },
-    { "abs", nullptr },
-    { "log", nullptr },
-    { "ln", nullptr },
-    { "sqrt", nullptr },
-    { "input", nullptr },
-    { "import", nullptr },
-    { "set", nullptr },
-    { "require", nullptr },
-    { "readFile", nullptr },
-    { "writeFile", nullptr },
-    { "append", nullptr },
-    { "concat", nullptr },
-    { "remove", nullptr },
-    { "builtins", nullptr },
-    { "del", nullptr },
-    { "range", nullptr },
-    { "addressOf", nullptr },
-    { "keys", nullptr }, 
-    { "values", nullptr },
-    { "global", nullptr },
-    { "recover", nullptr },
-    { "BigInteger", nullptr },
-    { "exit", nullptr }
-};
-
-DylibType OpenDynamicLibrary(const std::string &dylib) {
-    // not implemented
-    #ifdef __linux__
-        auto descr = dlopen(std::format("./yan-{}.so", dylib).c_str(), RTLD_LAZY);
-        if (descr == nullptr) {
-            descr = dlopen(std::format("{}/yan-{}.so", builtins::GetEnvVar("native-lib-path"), dylib).c_str(), RTLD_LAZY);
-            if (descr == nullptr) {
-                std::cerr << "Fatal: Dynamic lib '" + dylib << "' opened failed: " << dlerror() << std::endl;
-                return nullptr; 
-            }
-        }
-        return descr;
-    #elif defined(_WIN32)
-        auto s = std::format(".\\yan-{}.dll", dylib).c_str();
-        auto dll = win32::LoadLibrary(s);
-        if (dll == nullptr) {
-            s = std::format("{}\\yan-{}.dll", builtins::GetEnvVar("native-lib-path"), dylib).c_str();
-            dll = win32::LoadLibrary(s);
-            if (dll == nullptr) {
-                std::cerr << "Fatal: Dynamic lib '" + dylib << "' opened failed: [WinError " << win32::GetLastError() << "]" << std::endl;
-                return nullptr;
-            }
-        }
-        return dll;
-    #else
-        return nullptr;
-    #endif
-}
-
-
-YAN_C_API_START 
-    builtins::YanObject BigInt_ToString(builtins::YanContext ctx);
-YAN_C_API_END
-
-struct BigInt : public ClassObject {
-    BigInteger value;
-    BuiltinFunction *BigInt_ToStringFunc = nullptr;
-
-    explicit BigInt(BigInteger value) : value(value), ClassObject({}) {
-        this->typeName = "BigInt";
-        this->BigInt_ToStringFunc = new BuiltinFunction("BigInt_ToString");
-        this->BigInt_ToStringFunc->Bind({ "self" }, BigInt_ToString);
-        this->SetAttr("toString", BuiltinMethod::FromBuiltinFunction(this->BigInt_ToStringFunc, this));
-    }
-
-    static RuntimeResult *CheckType(Object *other) {
-        auto result = new RuntimeResult;
-        if (other->typeName != std::string("Number") && other->typeName != std::string("BigInt") && other->typeName != std::string("String")) {
-            return result->Failure(new TypeError(
-                std::format("Invilid operation with big integer with type `{}`", other->typeName),
-                other->startPos, other->endPos, other->ctx
-            ));
-        }
-        if (other->typeName == std::string("Number")) {
-            if (!builtins::Math::HoldsInteger(As<Number>(other))) {
-                return result->Failure(new TypeError(
-                    "BigInt could not resolve floating values",
-                    other->startPos, other->endPos, other->ctx
-                ));
-            }
-            return result->Success(new Number(1));
-        }
-        if (other->typeName == std::string("BigInt")) {
-            return result->Success(new Number(2));
-        }
-        return result->Success(new Number(3));
-    }
-
-    static RuntimeResult *Create(Object *val) {
-        auto result = CheckType(val);
-        if (result->ShouldReturn()) {
-            return result;
-        }
-
-        auto v = result->value;
-        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
-            return result->Success(new BigInt(builtins::Math::GetInt(As<Number>(val))));
-        } else if (builtins::Math::GetInt(As<Number>(v)) == 2) {
-            return result->Success(new BigInt(As<BigInt>(val)->value));
-        } else {
-            return result->Success(new BigInt(As<String>(val)->s));
-        }
-    }
-
-    using ObjectWithError = std::pair<Object *, Error *>;
-    ObjectWithError AddTo(Object *other) override {
-        auto result = CheckType(other);
-        if (result->ShouldReturn()) {
-            return std::make_pair(nullptr, result->error);
-        }
-
-        auto v = result->value;
-        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
-            return std::make_pair(new BigInt(this->value + builtins::Math::GetInt(As<Number>(other))), nullptr);
-        } else {
-            return std::make_pair(new BigInt(this->value + As<BigInt>(other)->value), nullptr);
-        }
-    }
-
-    ObjectWithError SubstractedBy(Object *other) override {
-        auto result = CheckType(other);
-        if (result->ShouldReturn()) {
-            return std::make_pair(nullptr, result->error);
-        }
-
-        auto v = result->value;
-        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
-            return std::make_pair(new BigInt(this->value - builtins::Math::GetInt(As<Number>(other))), nullptr);
-        } else {
-            return std::make_pair(new BigInt(this->value - As<BigInt>(other)->value), nullptr);
-        }
-    }
-
-    ObjectWithError MultipliedBy(Object *other) override {
-        auto result = CheckType(other);
-        if (result->ShouldReturn()) {
-            return std::make_pair(nullptr, result->error);
-        }
-
-        auto v = result->value;
-        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
-            return std::make_pair(new BigInt(this->value * builtins::Math::GetInt(As<Number>(other))), nullptr);
-        } else {
-            return std::make_pair(new BigInt(this->value * As<BigInt>(other)->value), nullptr);
-        }
-    }
-
-    ObjectWithError DividedBy(Object *other) override {
-        auto result = CheckType(other);
-        if (result->ShouldReturn()) {
-            return std::make_pair(nullptr, result->error);
-        }
-
-        auto v = result->value;
-        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
-            return std::make_pair(new BigInt(this->value / builtins::Math::GetInt(As<Number>(other))), nullptr);
-        } else {
-            return std::make_pair(new BigInt(this->value / As<BigInt>(other)->value), nullptr);
-        }
-    }
-
-    ObjectWithError GetCompEquals(Object *other) override {
-        if (other->typeName != std::string("BigInt")) {
-            return std::make_pair(new Number(0), nullptr);
-        } else if (other->typeName == std::string("Number")) {
-            if (!builtins::Math::HoldsInteger(As<Number>(other))) {
-                return std::make_pair(new Number(0), nullptr);
-            }
-            return std::make_pair(new Number(this->value == builtins::Math::GetInt(As<Number>(other))), nullptr);
-        }
-        return std::make_pair(new Number(this->value == As<BigInt>(other)->value), nullptr);
-    }
-
-    ObjectWithError GetCompNequals(Object *other) override {
-        auto result = this->GetCompEquals(other);
-        if (result.second) {
-            return std::make_pair(nullptr, result.second);
-        }
-        return std::make_pair(new Number((int) !result.first->AsBool()), nullptr);
-    }
-
-    std::string ToString() override {
-        std::stringstream ss;
-        ss << this->value;
-        return ss.str();
-    }
-
-    Object *Copy() override {
-        auto c = new BigInt(this->value);
-        return c; 
-    }
-};
-
-builtins::YanObject BigInt_ToString(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
-    auto self = ctx->symbols->Get("self");
-    assert(self->typeName == std::string("BigInt") && "Type mismatched: Internal interpreter error");
-    auto value = As<BigInt>(self);
-    auto v = value->value.GetInternalValue();
-    std::vector<std::string> tmp;
-    for (auto digit : v) {
-        tmp.push_back(std::to_string(digit));
-    }
-
-    std::reverse(tmp.begin(), tmp.end());
-    return result->Success(new String(Join(tmp, "")));
-}
-
-
-builtins::YanObject builtins::BigInteger(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
-    auto arg = ctx->symbols->Get("__val__");
-
-    Object *val = arg ? arg : Number::null;
-    auto r = result->Register(BigInt::Create(val));
-    if (result->ShouldReturn()) {
-        return result;
-    }
-    return result->Success(r);
-}
-
-auto LoadNativeFunctionImplementation(const std::string &dynamicLib, const std::string &name) -> RuntimeResult *(*)(Context *) {
-    #ifdef __linux__
-        void *dylib = nullptr;
-        void *symbol = nullptr;
-        if (dylibs.find(dynamicLib) == dylibs.end()) {
-            dylib = OpenDynamicLibrary(dynamicLib);
-            dylibs.insert(std::make_pair(dynamicLib, dylib));
-        } else {
-            dylib = dylibs.at(dynamicLib);
-        }
-    #elif defined(_WIN32)
-        DylibType dylib = 0;
-        void *symbol = nullptr;
-        if (dylibs.find(dynamicLib) == dylibs.end()) {
-            dylib = OpenDynamicLibrary(dynamicLib);
-            dylibs.insert(std::make_pair(dynamicLib, dylib));
-        } else {
-            dylib = dylibs.at(dynamicLib);
-        }
-    #endif
-
-    assert(dylib != nullptr);
-    if (dynamicLoadedSymbol.find(name) == dynamicLoadedSymbol.end()) {
-        #ifdef __linux__
-            symbol = dlsym(dylib, name.c_str());
-            if (symbol == nullptr) {
-                std::cerr << "Fatal: Error locating symbol '" + name << "' in dynamic lib '" + dynamicLib + "': " << dlerror() << std::endl;
-                return nullptr;
-            }
-        #elif defined(_WIN32)
-            symbol = reinterpret_cast<void *>(win32::GetProcAddress(dylib, name.c_str()));
-             if (symbol == nullptr) {
-                std::cerr << "Fatal: Error locating symbol '" + name << "' in dynamic lib '" + dynamicLib + "': " << std::format("[WinError {}]", win32::GetLastError()) << std::endl;
-                return nullptr;
-            }
-        #endif
-        dynamicLoadedSymbol.insert(std::make_pair(name, std::make_pair(dynamicLib, symbol)));
-    }
-    if (nativeModules.find(dynamicLib) == nativeModules.end()) {
-        #ifdef __linux__
-            symbol = dlsym(dylib, "YanModule_OnLoad");
-            if (symbol == nullptr) {
-                std::cerr << "Fatal: Error locating onLoad() function of '" + dynamicLib + "'" << std::endl;
-                return nullptr;
-            }
-        #elif defined(_WIN32)
-            symbol = reinterpret_cast<void *>(win32::GetProcAddress(dylib, "YanModule_OnLoad"));
-                if (symbol == nullptr) {
-                std::cerr << "Fatal: Error locating onLoad() function of '" << dynamicLib + "': " << std::format("[WinError {}]", win32::GetLastError()) << std::endl;
-                return nullptr;
-            }
-        #endif
-        auto moduleDeclearation = ((builtins::ModuleLoaderFunc) symbol)();
-        nativeModules.insert(std::make_pair(dynamicLib, moduleDeclearation));
-    }
-
-    symbol = dynamicLoadedSymbol.at(name).second;
-    return (RuntimeResult *(*)(Context *)) symbol;
-}
-
-builtins::YanObject builtins::_LoadNativeSymbol(const std::string &mod, const std::string &symbolName, Position *st, Position *et, builtins::YanContext ctx) {
-    auto symbol = LoadNativeFunctionImplementation(mod, symbolName);
-    auto func = new BuiltinFunction(symbolName);
-    func->SetPos(st, et)->SetContext(ctx);
-    auto modDec = nativeModules.at(mod);
-    if (modDec->functionArgumentDeclearation.find(symbolName) != modDec->functionArgumentDeclearation.end()) {
-        func->argDeclearation = modDec->functionArgumentDeclearation.at(symbolName);
-    }
-    return (new RuntimeResult)->Success(func);
-}
-
-
-void InitializeBuiltins() {
-    for (auto builtinNames : builtinNames) {
-        // if (debug) {
-        //     std::cout << "[Debug Initalization] Initalizing builtin '" << builtinNames << "'" << std::endl;
-        // }
-        allBuiltins[builtinNames] = new BuiltinFunction(builtinNames);
-    }
-}
-
-void SetBuiltins(SymbolTable *global) {
-    for (auto [builtinName, o] : allBuiltins) {
-        global->Set(builtinName, o);
-    }
-}
-
-
-Interpreter::Interpreter() {
-    this->callStack = new std::vector<Context *>;
-}
-
-RuntimeResult *Interpreter::Visit(NodeBase *node, Context *ctx) {
-    switch (node->nodeType) {
-        case NodeType::Expression:
-            return this->VisitExpression(node, ctx);
-        case NodeType::Number:
-            return this->VisitNumber(node, ctx);
-        case NodeType::SingleExpression:
-            return this->VisitSingleExpression(node, ctx);
-        case NodeType::VarAccess:
-            return this->VisitVarAccessNode(node, ctx);
-        case NodeType::VarAssign:
-            return this->VisitVarAssignNode(node, ctx);
-        case NodeType::IfExpression:
-            return this->VisitIfExpressionNode(node, ctx);
-        case NodeType::ForExpression:
-            return this->VisitForExpression(node, ctx);
-        case NodeType::WhileExpression:
-            return this->VisitWhileExpression(node, ctx);
-        case NodeType::FunctionDefinition:
-            return this->VisitFunctionDefinition(node, ctx);
-        case NodeType::FunctionCall:
-            return this->VisitFunctionCall(node, ctx);
-        case NodeType::String:
-            return this->VisitString(node, ctx);
-        case NodeType::List:
-            return this->VisitList(node, ctx);
-        case NodeType::Return:
-            return this->VisitReturn(node, ctx);
-        case NodeType::Continue:
-            return this->VisitContinue(node, ctx);
-        case NodeType::Break:
-            return this->VisitBreak(node, ctx);
-        case NodeType::Subscription:
-            return this->VisitSubscription(node, ctx);
-        case NodeType::Dictionary:
-            return this->VisitDictionary(node, ctx);
-        case NodeType::Attribution:
-            return this->VisitAttribution(node, ctx);
-        case NodeType::AdvancedVarAccess:
-            return this->VisitAdvancedVarAccess(node, ctx);
-        case NodeType::NewExpression:
-            return this->VisitNewExpression(node, ctx);
-        case NodeType::AttributionCall:
-            return this->VisitAttributionCall(node, ctx);
-        case NodeType::NonlocalStatement:
-            return this->VisitNonlocal(node, ctx);
-        case NodeType::Defer:
-            return this->VisitDefer(node, ctx);
-        case NodeType::StructDefStmt:
-            return this->VisitStructDef(node, ctx);
-        case NodeType::Invilid:
-            return this->VisitEmpty(node, ctx);
-    }
-    return nullptr;
-}
-
-RuntimeResult *Interpreter::VisitExpression(NodeBase *node, Context *ctx) {
-    auto rtResult = new RuntimeResult;        
-    auto r = rtResult->Register(this->Visit(node->left, ctx));
-    if (rtResult->ShouldReturn()) {
-        return rtResult;
-    }
-    // Number *left = dynamic_cast<Number *>(r);
-
-    auto rn = rtResult->Register(this->Visit(node->right, ctx));
-    if (rtResult->ShouldReturn()) {
-        return rtResult;
-    }
-    // Number *right = dynamic_cast<Number *>(rn);        
-
-    #define ERR_RET() if (error != nullptr) return rtResult->Failure(error)
-    
-    auto op = dynamic_cast<BinaryOperationNode *>(node);
-    if (op->binaryOperator.type == TokenType::OP_Plus) {
-        auto [result, error] = r->AddTo(rn);
-        ERR_RET();
-        return rtResult->Success(result->SetPos(op->st, op->et));
-    } else if (op->binaryOperator.type == TokenType::OP_Minus) {
-        auto [result, error] = r->SubstractedBy(rn);
-        ERR_RET();   
-        return rtResult->Success(result->SetPos(op->st, op->et));
-    } else if (op->binaryOperator.type == TokenType::OP_Mul) {
-        auto [result, error] = r->MultipliedBy(rn);
-        ERR_RET();   
-        return rtResult->Success(result->SetPos(op->st, op->et));
-    } else if (op->binaryOperator.type == TokenType::OP_Div) {
-        auto [result, error] = r->DividedBy(rn);
-        ERR_RET();        
-        return rtResult->Success(result->SetPos(op->st, op->et));
-    } else if (op->binaryOperator.type == TokenType::OP_Pow) {
-        auto [result, error] = r->PoweredBy(rn);
-        ERR_RET();   
-        return rtResult->Success(result->SetPos(op->st, op->et));
-    } else if (op->binaryOperator.type == TokenType::OP_Equal) {
-        auto [result, error] = r->GetCompEquals(rn);
-        ERR_RET();    
-        return rtResult->Success(result->SetPos(op->st, op->et)); 
-    } else if (op->binaryOperator.type == TokenType::OP_Nequal) {
-        auto [result, error] = r->GetCompNequals(rn);
-        ERR_RET();   
-        return rtResult->Success(result->SetPos(op->st, op->et)); 
-    } else if (op->binaryOperator.type == TokenType::OP_Lt) {
-        auto [result, error] = r->GetCompLt(rn);
-        ERR_RET();   
-        return rtResult->Success(result->SetPos(op->st, op->et)); 
-    } else if (op->binaryOperator.type == TokenType::OP_Gt) {
-        auto [result, error] = r->GetCompGt(rn);
-        ERR_RET();   
-        return rtResult->Success(result->SetPos(op->st, op->et)); 
-    } else if (op->binaryOperator.type == TokenType::OP_Lte) {
-        auto [result, error] = r->GetCompLte(rn);
-        ERR_RET();    
-        return rtResult->Success(result->SetPos(op->st, op->et)); 
-    } else if (op->binaryOperator.type == TokenType::OP_Gte) {
-        auto [result, error] = r->GetCompGte(rn);
-        ERR_RET();   
-        return rtResult->Success(result->SetPos(op->st, op->et)); 
-    } else if (op->binaryOperator.Matches<std::string>(TokenType::Keyword, "and")) {
-        auto [result, error] = r->And(rn);
-        ERR_RET();    
-        return rtResult->Success(result->SetPos(op->st, op->et)); 
-    } else if (op->binaryOperator.Matches<std::string>(TokenType::Keyword, "or")) {
-        auto [result, error] = r->Or(rn);
-        ERR_RET();    
-        return rtResult->Success(result->SetPos(op->st, op->et)); 
-    }
-
-    return nullptr;
-}
-
-RuntimeResult *Interpreter::VisitSingleExpression(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto op = dynamic_cast<UnaryOperationNode *>(node);
-    auto o = result->Register(this->Visit(dynamic_cast<UnaryOperationNode *>(node)->node, ctx));
-    if (result->ShouldReturn()) {
-        return result;
-    }
-    if (o->typeName != "Number") {
-        return result->Failure(new TypeError(
-            std::format("Unary operation '{}' is not supported on type '{}'", op->unaryOperator.ToString(), o->typeName),
-            node->st, node->et, ctx
-        ));
-    }
-    Number *num = dynamic_cast<Number *>(o);
-    if (result->ShouldReturn()) {
-        return result;
-    }
-
-    if (dynamic_cast<UnaryOperationNode *>(node)->unaryOperator.type == TokenType::OP_Minus) {
-        auto r = num->MultipliedBy(new Number(-1));
-        if (r.second != nullptr) {
-            return result->Failure(r.second);
-        } else {
-            num = dynamic_cast<Number *>(r.first);
-        }
-    } else if (dynamic_cast<UnaryOperationNode *>(node)->unaryOperator.Matches<std::string>(TokenType::Keyword, "not")) {
-        auto r = num->Not();
-        if (r.second != nullptr) {
-            return result->Failure(r.second);
-        } else {
-            num = dynamic_cast<Number *>(r.first);
-        }
-    }
-    return result->Success(num->SetPos(op->st, op->et));
-}
-
-RuntimeResult *Interpreter::VisitVarAccessNode(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto nd = dynamic_cast<VariableAccessNode *>(node);
-    auto variableName = *(std::string *) nd->variableNameToken.value;
-    auto value = ctx->symbols->Get(variableName);
-
-    if (value == nullptr) {
-        return result->Failure(new RuntimeError(
-            std::format("'{}' is not defined", variableName),
-            nd->st, nd->et, ctx
-        ));
-    }
-
-    // Object *oldValue = value;
-    // mutable types & immutable types ? 
-    if (value->typeName != std::string("List") && value->typeName != std::string("Dictionary") && value->typeName != std::string("ClassObject")) {
-        value = value->Copy()->SetPos(nd->st, nd->et)->SetContext(ctx);
-    } else {
-        value = value->SetPos(nd->st, nd->et)->SetContext(ctx);
-    }
-    // delete oldValue;
-
-    return result->Success(value);
-}
-
-RuntimeResult *Interpreter::VisitVarAssignNode(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto nd = dynamic_cast<VariableAssignNode *>(node);
-    auto variableName = *(std::string *) nd->variableNameToken.value;
-    auto variableValue = result->Register(this->Visit(nd->valueNode, ctx));
-    
-    if (result->ShouldReturn()) {
-        return result;
-    }
-
-    ctx->symbols->Set(variableName, variableValue);
-    return result->Success(variableValue);
-}
-
-RuntimeResult *Interpreter::VisitNumber(NodeBase *node, Context *ctx) {
-    auto type = dynamic_cast<NumberNode *>(node)->numberToken.type;
-    auto result = new RuntimeResult;
-    Number *num = nullptr;
-    if (type == TokenType::Int) {
-        num = new Number(*((int *) (dynamic_cast<NumberNode *>(node)->numberToken.value)));
-        num->SetContext(ctx);
-    } else if (type == TokenType::Float) {
-        num = new Number(*((double *) (dynamic_cast<NumberNode *>(node)->numberToken.value)));
-        num->SetContext(ctx);            
-    }
-    return result->Success(num->SetPos(dynamic_cast<NumberNode *>(node)->st, dynamic_cast<NumberNode *>(node)->et));
-}
-
-RuntimeResult *Interpreter::VisitIfExpressionNode(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    assert(node->nodeType == NodeType::IfExpression);
-    auto ifNode = dynamic_cast<IfExpressionNode *>(node);
-    for (auto [case_, shouldReturnNull] : ifNode->cases) {
-        auto conditionValue = result->Register(this->Visit(case_.first, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        if (conditionValue->AsBool()) {
-            auto exprValue = result->Register(this->Visit(case_.second, ctx));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-            return result->Success(shouldReturnNull ? Number::null : exprValue);
-        }
-    }
-
-    if (ifNode->elseCase.first != nullptr) {
-        auto elseValue = result->Register(this->Visit(ifNode->elseCase.first, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        return result->Success(ifNode->elseCase.second ? Number::null : elseValue);
-    }
-
-    return result->Success(Number::null);
-}
-
-RuntimeResult *Interpreter::VisitForExpression(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    std::vector<Object *> elements;
-
-    assert(node->nodeType == NodeType::ForExpression);
-    auto forNode = dynamic_cast<ForExpressionNode *>(node);
-    if (!forNode->rangeBasedLoop) {
-        Object *stepValue = nullptr;
-        auto stv = result->Register(this->Visit(forNode->stvNode, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-    
-        auto etv = result->Register(this->Visit(forNode->etvNode, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-    
-        if (forNode->stepvNode != nullptr) {
-            stepValue = result->Register(this->Visit(forNode->stepvNode, ctx));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-        } else {
-            stepValue = new Number(1);
-        }
-    
-        Number *i;
-        Number *stvNum = nullptr, *etvNum = nullptr, *stepNum = nullptr;
-        if (stv->typeName == "Number" && stepValue->typeName == "Number" && etv->typeName == "Number") {
-            stvNum = dynamic_cast<Number *>(stv);
-            stepNum = dynamic_cast<Number *>(stepValue);
-            etvNum = dynamic_cast<Number *>(etv);
-            i = new Number(stvNum->value);
-        } else {
-            return result->Failure(new TypeError(
-                std::format("For-loop expects 3 number but got ({}, {}, {})", stv->typeName, stepValue->typeName, etv->typeName),
-                node->st, node->et, ctx
-            ));
-        }
-    
-        std::function<bool()> condition;
-        if (stepNum->ntype == NumberType::Int && std::get<int>(stepNum->value) >= 0) {
-            condition = [&i, &etv]() {
-                return i->GetCompLt(etv).first->AsBool();
-            };
-        } else if (stepNum->ntype == NumberType::Int) {
-            condition = [&i, &etv]() {
-                return i->GetCompGt(etv).first->AsBool();
-            };
-        } else if (stepNum->ntype == NumberType::Float && std::get<double>(stepNum->value) >= 0) {
-            condition = [&i, &etv]() {
-                return i->GetCompLt(etv).first->AsBool();
-            };
-        } else {
-            condition = [&i, &etv]() {
-                return i->GetCompGt(etv).first->AsBool();
-            };
-        }
-    
-        while (condition()) {
-            ctx->symbols->Set(*(std::string *) forNode->var.value, i);
-            i = dynamic_cast<Number *>(i->AddTo(stepValue).first);
-            auto value = result->Register(this->Visit(forNode->body, ctx));
-            if (result->ShouldReturn() && !result->shouldContinue && !result->shouldBreak) {
-                return result;
-            }
-    
-            if (result->shouldContinue) {
-                continue;
-            }
-            if (result->shouldBreak) {
-                break;
-            }
-            elements.push_back(value);
-        }
-        ctx->symbols->Remove(*(std::string *) forNode->var.value);
-        return result->Success(forNode->shouldReturnNull ? Number::null : (new List(elements))->SetContext(ctx)->SetPos(node->st, node->et));
-    } else {
-        auto iterableRaw = result->Register(this->Visit(forNode->range, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        auto iteratorRaw = iterableRaw->Iter();
-        bool iterList = true;
-        if (iterableRaw->typeName != std::string("List")) {
-            iterList = false;
-            if (iteratorRaw.second != nullptr || iteratorRaw.first == nullptr) {
-                return result->Failure(new TypeError(
-                    std::format("Object '{}' is not iterable", iterableRaw->typeName),
-                    iterableRaw->startPos, iterableRaw->endPos, ctx
-                ));
-            }
-        }
-
-        if (iterList) {
-            auto iterable = As<List>(iterableRaw);
-            for (auto &i : iterable->elements) {
-                ctx->symbols->Set(*(std::string *) forNode->var.value, i);
-                auto value = result->Register(this->Visit(forNode->body, ctx));
-                if (result->ShouldReturn() && !result->shouldContinue && !result->shouldBreak) {
-                    return result;
-                }
-        
-                if (result->shouldContinue) {
-                    continue;
-                }
-                if (result->shouldBreak) {
-                    break;
-                }
-                elements.push_back(value);
-            }
-            ctx->symbols->Remove(*(std::string *) forNode->var.value);
-            return result->Success(forNode->shouldReturnNull ? Number::null : (new List(elements))->SetContext(ctx)->SetPos(node->st, node->et));
-        } else {
-            auto iterator = iteratorRaw.first;
-            std::pair<Object *, Error *> iterResultTmp { nullptr, nullptr };
-            iterResultTmp = iterator->Next();
-            while (iterResultTmp.second == nullptr) {
-                ctx->symbols->Set(*(std::string *) forNode->var.value, iterResultTmp.first);
-                auto value = result->Register(this->Visit(forNode->body, ctx));
-                if (result->ShouldReturn() && !result->shouldContinue && !result->shouldBreak) {
-                    return result;
-                }
-        
-                if (result->shouldContinue) {
-                    continue;
-                }
-                if (result->shouldBreak) {
-                    break;
-                }
-                elements.push_back(value);
-                iterResultTmp = iterator->Next();                      
-            }
-            ctx->symbols->Remove(*(std::string *) forNode->var.value);
-            delete iterator;
-            if (iterResultTmp.second->name != "StopIteration") {
-                return result->Failure(iterResultTmp.second);
-            }          
-            return result->Success(forNode->shouldReturnNull ? Number::null : (new List(elements))->SetContext(ctx)->SetPos(node->st, node->et));              
-        }
-    }
-}
-
-RuntimeResult *Interpreter::VisitWhileExpression(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto whileNode = dynamic_cast<WhileExpressionNode *>(node);
-
-    while (true) {
-        auto cond = result->Register(this->Visit(whileNode->conditionNode, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        if (!cond->AsBool()) {
-            break;
-        }
-        auto value = result->Register(this->Visit(whileNode->body, ctx));
-
-        if (result->ShouldReturn() && !result->shouldContinue && !result->shouldBreak) {
-            return result;
-        }
-        if (result->shouldContinue) {
-            continue;
-        }
-        if (result->shouldBreak) {
-            break;
-        }
-    }
-    return result->Success(Number::null);
-}
-
-RuntimeResult *Interpreter::VisitFunctionDefinition(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto funcDefNode = dynamic_cast<FunctionDefinitionNode *>(node);
-    auto funcBody = funcDefNode->body;
-    std::vector<std::string> parameters;
-    Function *function;
-
-    for (auto param : funcDefNode->parameters) {
-        parameters.push_back(*(std::string *) param.value);
-    }
-
-    if (funcDefNode->fun.type != TokenType::Invilid) {
-        function = dynamic_cast<Function *>((new Function(*(std::string *) funcDefNode->fun.value, funcBody, parameters, funcDefNode->shouldAutoReturn))->SetContext(ctx)->SetPos(node->st, node->et));
-        ctx->symbols->Set(*(std::string *) funcDefNode->fun.value, function);
-    } else {
-        function = dynamic_cast<Function *>((new Function(funcBody, parameters, funcDefNode->shouldAutoReturn))->SetContext(ctx)->SetPos(node->st, node->et));    
-    }
-
-    for (auto &fv : funcDefNode->cellVars) {
-        function->cellVars.push_back(*(std::string *) fv->freeVar.value);
-    }
-
-        // FixMe: Fix REPEAT Code
-    if (ctx->parent != nullptr) {
-        for (auto &fv : funcDefNode->freeVars) {
-            auto fvName = *(std::string *) fv->freeVar.value;
-            auto fvValue = ctx->symbols->Get(fvName);
-            if (fvValue == nullptr) {
-                return result->Failure(new RuntimeError(
-                    std::format("'{}' is not a valid freevar", fvName),
-                    fv->st, fv->et, ctx
-                ));
-            }
-            function->closureVarsTable->Set(fvName, fvValue);
-        }
-    }
-    return result->Success(function);
-}
-
-RuntimeResult *Interpreter::VisitFunctionCall(NodeBase *node, Context *ctx) {
-    if (overflowCount >= INVILID_OVERFLOW_TOLERANCE) {
-        std::cerr << "Fatal: Stack corrupted" << std::endl;
-        std::cerr << "[Native Stack Info]" << std::endl;
-        std::cerr << RuntimeError::GetNativeCallStackInfo() << std::endl;
-        assert(false);
-    }
-
-    auto result = new RuntimeResult;
-    auto funcCallNode = dynamic_cast<FunctionCallNode *>(node);
-    std::vector<Object *> args;
-    currentCallStackDepth++;
-    if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
-        currentCallStackDepth = 0;
-        overflowCount++;    
-        return result->Failure(new RuntimeError(
-            std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
-            node->st, node->et, ctx
-        ));
-    }
-    
-    // if (ctx->interpreter) {
-    //     ctx->interpreter->callStack->push_back(ctx);
-    // }
-        
-    auto functionTarget = result->Register(this->Visit(funcCallNode->target, ctx));
-    if (result->ShouldReturn()) {
-        return result;
-    }
-    // functionTarget = functionTarget->Copy()->SetPos(node->st, node->et)->SetContext(ctx);
-    // functionTarget = functionTarget->Copy()->SetPos(node->st, node->et);
-    functionTarget = functionTarget->Copy();
-    
-    for (auto &arg : funcCallNode->arguments) {
-        args.push_back(result->Register(this->Visit(arg, ctx)));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-    }
-    
-    // if (functionTarget->typeName != "Function" && functionTarget->typeName != "BuiltinFunction" && functionTarget->typeName != "Method" && functionTarget->typeName != "ClassObject" && functionTarget->typeName != std::string("BuiltinMethod")) {
-    //     return result->Failure(new TypeError(
-    //         std::format("'{}' object is not callable", functionTarget->typeName),
-    //         node->st, node->et, ctx
-    //      ));
-    // } else {
-    Object *returnValue;
-    if (functionTarget->typeName == "Function") {
-        auto target = dynamic_cast<Function *>(functionTarget);
-        auto returnValueTmp = result->Register(target->Execute(args));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        returnValue = returnValueTmp;
-    } else if (functionTarget->typeName == "BuiltinFunction") {
-        auto returnValueTmp = result->Register((dynamic_cast<BuiltinFunction *>(functionTarget))->Execute(args));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        returnValue = returnValueTmp;
-    // } else if (functionTarget->typeName == "ClassObject") {
-    //     auto [ctor, error] = dynamic_cast<ClassObject *>(functionTarget)->GetAttr("__init__");
-    //     if (error != nullptr) {
-    //         return result->Failure(new TypeError(
-    //             std::format("Prototype of object '{}' has no constructor", As<ClassObject>(functionTarget)->className),
-    //             node->st, node->et, ctx
-    //         ));
-    //     }
-    //     if (ctor->typeName != "Function") {
-    //         return result->Failure(new TypeError(
-    //             "Constructor is not callable",
-    //             node->st, node->et, ctx
-    //         ));
-    //     }
-    //     auto returnValueTmp = functionTarget->Copy();
-    //     auto boundedCtor = Method::FromFunction(As<Function>(ctor), returnValueTmp, "__init__");
-    //     boundedCtor->SetPos(node->st, node->et)->SetContext(ctx);
-    //     result->Register(boundedCtor->Execute(args));
-    //     if (result->ShouldReturn()) {
-    //         return result;
-    //     }
-    //     As<ClassObject>(returnValueTmp)->isProto = false;
-    //     returnValue = returnValueTmp;
-    } else if (functionTarget->typeName == "ClassObject") {
-        return result->Success(functionTarget);
-    } else {
-        if (functionTarget->typeName == "Method") {
-            auto returnValueTmp = result->Register((dynamic_cast<Method *>(functionTarget))->Execute(args));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-            returnValue = returnValueTmp;
-        } else if (functionTarget->typeName == std::string("BuiltinMethod")) {
-            auto returnValueTmp = result->Register((dynamic_cast<BuiltinFunction *>(functionTarget))->Execute(args));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-            returnValue = returnValueTmp;
-        } else {
-            auto returnValueTmp = result->Register((functionTarget->Execute(args)));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-            returnValue = returnValueTmp;
-        }
-    }
-    
-    currentCallStackDepth--;
-    return result->Success(returnValue->Copy()->SetPos(node->st, node->et)->SetContext(ctx));
-    // }
-}
-
-RuntimeResult *Interpreter::VisitNonlocal(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto nlNode = dynamic_cast<NonlocalStatementNode *>(node);
-    auto fvName = *(std::string *) nlNode->freeVar.value;
-    auto fvValue = ctx->nonlocals->Get(fvName);
-
-    if (fvValue == nullptr) {
-        return result->Failure(new RuntimeError(
-            std::format("'{}' is not a valid cellvar", fvName),
-            node->st, node->et, ctx
-        ));
-    }
-    ctx->symbols->Set(fvName, fvValue);
-    return result->Success(Number::null);
-}
-
-RuntimeResult *Interpreter::VisitString(NodeBase *node, Context *ctx) {
-    return (new RuntimeResult)->Success(
-        (new String(*(std::string *) (dynamic_cast<StringNode *>(node)->stringToken.value)))->SetContext(ctx)->SetPos(node->st, node->et)
-    );
-}
-
-RuntimeResult *Interpreter::VisitList(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    std::vector<Object *> elements;
-    auto elementNodes = dynamic_cast<ListNode *>(node);
-
-    for (auto elementNode : elementNodes->elements) {
-        elements.push_back(result->Register(this->Visit(elementNode, ctx)));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-    }
-    if (elementNodes->subscripting == nullptr) {
-        return result->Success((new List(elements))->SetContext(ctx)->SetPos(node->st, node->et));
-    } else {
-        auto idx = result->Register(this->Visit(elementNodes->subscripting, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        if (idx->typeName != "Number") {
-            return result->Failure(new TypeError(
-                "List subsciption takes an number", 
-                idx->startPos, idx->endPos, ctx
-            ));
-        }
-        auto indexNum = As<Number>(idx);
-        if (!builtins::Math::HoldsInteger(indexNum)) {
-            return result->Failure(new TypeError(
-                "List subsciption takes an integer", 
-                idx->startPos, idx->endPos, ctx
-            ));
-        }
-
-        auto indexReal = builtins::Math::GetInt(indexNum);
-        if (indexReal < 0) {
-            return result->Failure(new TypeError(
-                "List subsciption takes an non-negative integer", 
-                idx->startPos, idx->endPos, ctx
-            ));
-        }
-        if (indexReal > elements.size() - 1) {
-            return result->Failure(new RuntimeError(
-                std::format("List index out of range ({} > max: {})", indexReal, elements.size() - 1),
-                node->st, node->et, ctx
-            ));
-        }
-        if (elementNodes->newVal == nullptr) {
-            if (indexReal < elements.size() && indexReal >= 0) {
-                return result->Success(elements[indexReal]);
-            }
-            return result->Failure(new RuntimeError(
-                "List index out of range",
-                node->st, node->et, ctx
-            ));
-        } else {
-            return result->Failure(new ValueError(
-                "Assignment to literal",
-                node->st, node->et, ctx
-            ));
-        }
-    }
-}
-
-RuntimeResult *Interpreter::VisitDictionary(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto dictNode = dynamic_cast<DictionaryNode *>(node);
-    bool isClass = false;
-    bool hasCtor = false;
-    std::map<Object *, Object *> dict;
-    for (auto &[k, v] : dictNode->elements) {
-        auto kvalue = result->Register(this->Visit(k, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        if (kvalue->typeName == "String") {
-            if (As<String>(kvalue)->s == "__cls__") {
-                isClass = true;
-            } else if (As<String>(kvalue)->s == "__init__") {
-                hasCtor = true;
-            }
-        }
-        auto vvalue = result->Register(this->Visit(v, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        dict.insert(std::make_pair(kvalue, vvalue));
-    }
-
-    if (isClass && !hasCtor) {
-        return result->Failure(new TypeError(
-            "Prototype of object '{}' should have a '__init__' as its constructor",
-            node->st, node->et, ctx
-        ));
-    }
-
-    if (!isClass) {
-        return result->Success((new Dictionary(dict))->SetPos(node->st, node->et)->SetContext(ctx));
-    } else {
-        auto cls = new ClassObject(dict);
-        cls->SetPos(node->st, node->et)->SetContext(ctx);
-        result->Register(cls->BuildClass());
-        if (result->ShouldReturn()) {
-            return result;
-        }
-        return result->Success(cls);
-    }
-}
-
-Number *Number::null = new Number(0);
-
-RuntimeResult *Interpreter::VisitReturn(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto returnNode = dynamic_cast<ReturnStatementNode *>(node);
-    // if (ctx->symbols->Get(ctx->ctxLabel) == nullptr) {
-    //     return result->Failure(new RuntimeError(
-    //         "'return' outside a user-defined function",
-    //         node->st, node->et, ctx
-    //     ));
-    // }
-    Object *value = nullptr;
-    if (returnNode->nodeToReturn != nullptr) {
-        value = result->Register(this->Visit(returnNode->nodeToReturn, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-    } else {
-        value = Number::null;
-    }
-    return result->SuccessReturn(value);
-}
-
-RuntimeResult *Interpreter::VisitContinue(NodeBase *node, Context *ctx) {
-    return (new RuntimeResult)->SuccessContinue();
-}
-
-RuntimeResult *Interpreter::VisitBreak(NodeBase *node, Context *ctx) {
-    return (new RuntimeResult)->SuccessBreak();
-}
-
-RuntimeResult *Interpreter::VisitSubscription(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto subNode = dynamic_cast<SubscriptionNode *>(node);
-    auto var = result->Register(this->Visit(subNode->target, ctx));
-    if (result->ShouldReturn()) {
-        return result;
-    }
-    auto indexValue = result->Register(this->Visit(subNode->index, ctx));
-    if (result->error != nullptr) {
-        return result;
-    }
-    
-    if (subNode->assignment == nullptr) {
-        auto v = var->Subsciption(indexValue);
-        if (v.second != nullptr) {
-            auto err = v.second;
-            err->st = node->st;
-            err->et = node->et;
-            return result->Failure(err);
-        }
-        if (subNode->calls.find(0) == subNode->calls.end()) {   
-            if (subNode->subIndexes.size() == 0) {
-                return result->Success(v.first);
-            }
-        } else {
-            std::vector<Object *> args;
-            for (auto &&argNode : subNode->calls[0]) {
-                auto argValue = result->Register(this->Visit(argNode, ctx));
-                if (result->ShouldReturn()) {
-                    return result;
-                }
-                args.push_back(argValue);
-            }
-            auto ret = result->Register(v.first->Execute(args));
-            if (result->ShouldReturn()) {
-                result->error->st = node->st;
-                result->error->et = node->et;
-                return result;
-            }
-
-            if (subNode->subIndexes.size() == 0) {
-                return result->Success(ret);
-            }
-        }
-        
-        Object *tmp = v.first;
-        int index = 1;
-        for (auto i : subNode->subIndexes) {
-            auto sv = result->Register(this->Visit(i, ctx));
-            auto subsciptionLayerResult = tmp->Subsciption(sv);
-            if (subsciptionLayerResult.second != nullptr) {
-                auto err = subsciptionLayerResult.second;
-                err->st = node->st;
-                err->et = node->et;
-                return result->Failure(err);
-            }
-            if (subNode->calls.find(index) == subNode->calls.end()) {
-                tmp = subsciptionLayerResult.first->SetContext(ctx)->SetPos(node->st, node->et);;
-            } else {
-                std::vector<Object *> args;
-                for (auto &&argNode : subNode->calls[index]) {
-                    auto argValue = result->Register(this->Visit(argNode, ctx));
-                    if (result->ShouldReturn()) {
-                        return result;
-                    }
-                    args.push_back(argValue);
-                }
-
-                tmp = result->Register(subsciptionLayerResult.first->Execute(args));
-                if (result->ShouldReturn()) {
-                    result->error->st = node->st;
-                    result->error->et = node->et;
-                    return result;
-                }
-            }
-        
-            index++;
-        }
-        return result->Success(tmp->SetContext(ctx)->SetPos(node->st, node->et));        
-    } else {        
-        auto newValue = result->Register(this->Visit(subNode->assignment, ctx));
-        if (result->error != nullptr) {
-            return result;
-        }
-
-        if (subNode->subIndexes.size() == 0 && subNode->calls.find(0) != subNode->calls.end()) {
-            return result->Failure(new RuntimeError(
-                "Unable to assign a new value to a function return value (rvalue)",
-                node->st, node->et, ctx
-            ));
-        }
-
-        if (subNode->calls.find(subNode->subIndexes.size()) != subNode->calls.end()) {
-            return result->Failure(new RuntimeError(
-                "Unable to assign a new value to a function return value (rvalue)",
-                node->st, node->et, ctx
-            ));
-        }
-
-        if (subNode->subIndexes.size() == 0) {
-            auto status = var->SubsciptionAssignment(indexValue, newValue);
-            if (status.second != nullptr) {
-                auto err = status.second;
-                err->st = node->st;
-                err->et = node->et;
-                return result->Failure(err);
-            }
-            return result->Success(Number::null);
-        } else {
-            auto v = var->Subsciption(indexValue);
-            if (v.second != nullptr) {
-                auto err = v.second;
-                err->st = node->st;
-                err->et = node->et;
-                return result->Failure(err);
-            }
-            if (subNode->subIndexes.size() == 0) {
-                return result->Success(v.first);
-            }
-            Object *tmp = v.first;
-
-            int index = 1;
-            for (unsigned i = 0; i < subNode->subIndexes.size() - 1; i++) {
-                auto sv = result->Register(this->Visit(subNode->subIndexes[i], ctx));
-                auto subsciptionLayerResult = tmp->Subsciption(sv);
-                if (subsciptionLayerResult.second != nullptr) {
-                    auto err = subsciptionLayerResult.second;
-                    err->st = node->st;
-                    err->et = node->et;
-                    return result->Failure(err);
-                }
-                if (subNode->calls.find(index) == subNode->calls.end()) {
-                    tmp = subsciptionLayerResult.first;
-                } else {
-                    std::vector<Object *> args;
-                    for (auto &&argNode : subNode->calls[index]) {
-                        auto argValue = result->Register(this->Visit(argNode, ctx));
-                        if (result->ShouldReturn()) {
-                            return result;
-                        }
-                        args.push_back(argValue);
-                    }
-
-                    tmp = result->Register(subsciptionLayerResult.first->Execute(args));
-                    if (result->ShouldReturn()) {
-                        result->error->st = node->st;
-                        result->error->et = node->et;
-                        return result;
-                    }
-                }
-                index++;
-            }
-
-            auto lastIndex = result->Register(this->Visit(subNode->subIndexes[subNode->subIndexes.size() - 1], ctx));
-            if (result->error != nullptr) {
-                return result;
-            }
-            auto status = tmp->SubsciptionAssignment(lastIndex, newValue);
-            if (status.second != nullptr) {
-                auto err = status.second;
-                err->st = node->st;
-                err->et = node->et;
-                return result->Failure(err);
-            }
-            return result->Success(Number::null);
-        }
-    }
-}
-
-RuntimeResult *Interpreter::VisitAttribution(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto attrNode = dynamic_cast<AttributionNode *>(node);
-    auto var = result->Register(this->Visit(attrNode->target, ctx));
-    if (result->ShouldReturn()) {
-        return result;
-    }
-    auto attr = *(std::string *) attrNode->attr.value;
-    auto calls = attrNode->calls;
-    
-    auto TryGenerateMethod = [=, &result](Object *v, Object *self, const std::string attr) -> Object * {
-        if (v->typeName == "Function") {
-            if (As<Function>(v)->parameters.size() > 0) {
-                if (As<Function>(v)->parameters[0] == "self" || As<Function>(v)->parameters[0] == "this") {
-                    std::string pa {};
-                    if (self->typeName == std::string("ClassObject")) {
-                        pa = As<ClassObject>(self)->className;
-                    } else if (self->typeName == std::string("Dictionary")) {
-                        pa = "<anonymous>";
-                    }
-                    auto method = Method::FromFunction(As<Function>(v), self, pa + '.' + attr)->SetPos(node->st, node->et)->SetContext(ctx);    
-                    return method; 
-                }
-            }       
-        }
-        return v;
-    };
-
-    if (attrNode->assignment == nullptr) {
-        Object *v;
-        if (calls.find(0) != calls.end()) {
-            auto va = var->GetAttr(attr);
-            if (va.first == nullptr) {
-                return result->Failure(va.second);
-            }
-            (va.first)->SetContext(ctx)->SetPos(node->st, node->et);
-            ctx->symbols->Set(std::format("__@attrCall_{}__", *(std::string *) attrNode->attr.value), 
-                TryGenerateMethod(va.first, var, attr));
-            v = result->Register(this->Visit(calls[0], ctx));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-            v = v->SetContext(ctx)->SetPos(node->st, node->et);
-            if (attrNode->subAttrs.size() == 0) {
-                return result->Success(v);
-            }
-        } else {
-            auto vp = var->GetAttr(attr);
-            v = vp.first;        
-            if (vp.second != nullptr) {
-                auto err = vp.second;
-                err->st = node->st;
-                err->et = node->et;
-                ((RuntimeError *) err)->SetContext(ctx);
-                return result->Failure(err);
-            }
-
-            if (attrNode->subAttrs.size() == 0) {
-                if (vp.first->typeName == std::string("Function")) {
-                    if (As<Function>(vp.first)->parameters.size() > 0) {
-                        if (As<Function>(vp.first)->parameters[0] == "self" || As<Function>(vp.first)->parameters[0] == "this") {
-                            auto method = Method::FromFunction(As<Function>(vp.first), var, attr);    
-                            return result->Success(method); 
-                        }
-                    }       
-                }
-                return result->Success(vp.first->SetContext(ctx)->SetPos(node->st, node->et));
-            }
-        }
-
-        Object *tmp = v;
-        Object *self = nullptr;
-        std::string ls {};
-        int callId = 1;
-        for (auto i : attrNode->subAttrs) {
-            auto subsciptionLayerResult = tmp->GetAttr(*(std::string *) i.value);
-            if (subsciptionLayerResult.second != nullptr) {
-                auto err = subsciptionLayerResult.second;
-                err->st = node->st;
-                err->et = node->et;
-                ((RuntimeError *) err)->SetContext(ctx);
-                return result->Failure(err);
-            }
-            if (calls.find(callId) != calls.end()) {
-                (subsciptionLayerResult.first)->SetContext(ctx)->SetPos(node->st, node->et);
-                ctx->symbols->Set(std::format("__@attrCall_{}__", *(std::string *) i.value), 
-                    TryGenerateMethod(subsciptionLayerResult.first, tmp, *(std::string *) i.value));
-                auto layerResult = result->Register(this->Visit(calls[callId], ctx));
-                if (result->ShouldReturn()) {
-                    return result;
-                }
-                tmp = layerResult->SetContext(ctx)->SetPos(node->st, node->et);
-                
-            } else {
-                ls = *(std::string *) attrNode->subAttrs[attrNode->subAttrs.size() - 1].value;
-                if (*(std::string *) i.value == ls) {
-                    self = tmp;
-                }
-                tmp = subsciptionLayerResult.first->SetContext(ctx)->SetPos(node->st, node->et);
-            }
-            callId++;
-        }
-        // if (tmp->typeName == "Function") {
-        //    if (As<Function>(tmp)->parameters[0] == "self" || As<Function>(tmp)->parameters[0] == "this") {
-        //         auto method = Method::FromFunction(As<Function>(tmp), self, ls);    
-        //         return result->Success(method); 
-        //     }    
-        // }
-        return result->Success(tmp->SetContext(ctx)->SetPos(node->st, node->et));  
-    } else {
-        Object *v;
-        if (attrNode->calls.find(0) != attrNode->calls.end() && attrNode->subAttrs.empty()) {
-            return result->Failure(new RuntimeError(
-                "Unable to assign a new value to a function return value (rvalue)",
-                node->st, node->et, ctx
-            ));
-        }
-
-        if (attrNode->calls.find(attrNode->subAttrs.size()) != attrNode->calls.end()) {
-            return result->Failure(new RuntimeError(
-                "Unable to assign a new value to a function return value (rvalue)",
-                node->st, node->et, ctx
-            ));
-        }
-        
-        auto expr = result->Register(this->Visit(attrNode->assignment, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-
-        if (attrNode->calls.find(0) != attrNode->calls.end()) {
-            auto va = var->GetAttr(attr);
-            if (va.first == nullptr) {
-                return result->Failure(va.second);
-            }
-            (va.first)->SetContext(ctx)->SetPos(node->st, node->et);
-            ctx->symbols->Set(std::format("__@attrCall_{}__", *(std::string *) attrNode->attr.value), 
-                TryGenerateMethod(va.first, var, attr));
-            v = result->Register(this->Visit(calls[0], ctx));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-            v = v->SetContext(ctx)->SetPos(node->st, node->et);
-            if (attrNode->subAttrs.size() == 0) {
-                return result->Success(v);
-            }
-        } else {
-            auto val = result->Register(this->Visit(attrNode->assignment, ctx));
-            if (result->ShouldReturn()) {
-                result->error->st = node->st;
-                result->error->et = node->et;
-                return result;
-            }
-            auto vp = var->SetAttr(attr, val);
-            v = vp.first;        
-            if (vp.second != nullptr) {
-                auto err = vp.second;
-                err->st = node->st;
-                err->et = node->et;
-                ((RuntimeError *) err)->SetContext(ctx);
-                return result->Failure(err);
-            }
-
-            if (attrNode->subAttrs.size() == 0) {
-                if (vp.first->typeName == std::string("Function")) {
-                    if (As<Function>(vp.first)->parameters.size() > 0) {
-                        if (As<Function>(vp.first)->parameters[0] == "self" || As<Function>(vp.first)->parameters[0] == "this") {
-                            auto method = Method::FromFunction(As<Function>(vp.first), var, attr);    
-                            return result->Success(method); 
-                        }
-                    }       
-                }
-                return result->Success(vp.first->SetContext(ctx)->SetPos(node->st, node->et));
-            }
-        }
-        
-        if (attrNode->subAttrs.size() != 0) {
-            Object *tmp = v;
-            Object *self = nullptr;
-            std::string ls {};
-            int callId = 1;
-            for (auto i : attrNode->subAttrs) {
-                auto subsciptionLayerResult = tmp->GetAttr(*(std::string *) i.value);
-                if (subsciptionLayerResult.second != nullptr) {
-                    auto err = subsciptionLayerResult.second;
-                    err->st = node->st;
-                    err->et = node->et;
-                   ((RuntimeError *) err)->SetContext(ctx);            
-                    return result->Failure(err);
-                }
-                if (calls.find(callId) != calls.end()) {
-                    ctx->symbols->Set(std::format("__@attrCall_{}__", *(std::string *) i.value), 
-                        TryGenerateMethod(subsciptionLayerResult.first, tmp, *(std::string *) i.value));
-                    auto layerResult = result->Register(this->Visit(calls[callId], ctx));
-                    if (result->ShouldReturn()) {
-                        return result;
-                    }
-                    tmp = layerResult;
-                } else {
-                    ls = *(std::string *) attrNode->subAttrs[attrNode->subAttrs.size() - 1].value;
-                    if (*(std::string *) i.value == ls) {
-                        self = tmp;
-                    }
-                    tmp = subsciptionLayerResult.first;
-                }
-                callId++;
-            }
-
-            auto r = self->SetAttr(*(std::string *) attrNode->subAttrs[attrNode->subAttrs.size() - 1].value, expr);
-            if (r.second != nullptr) {
-                auto err = r.second;
-                err->st = node->st;
-                err->et = node->et;
-                ((RuntimeError *) err)->SetContext(ctx);
-                return result->Failure(err);
-            }
-            return result->Success(Number::null);
-        } else {
-            auto rv = var->SetAttr(attr, expr);
-            if (rv.second != nullptr) {
-                auto err = rv.second;
-                err->st = node->st;
-                err->et = node->et;
-                ((RuntimeError *) err)->SetContext(ctx);
-                return result->Failure(err);
-            }
-            return result->Success(Number::null);
-        }
-    }
-}
-
-RuntimeResult *Interpreter::VisitAttributionCall(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto callNode = dynamic_cast<AttributionCallNode *>(node);
-    std::vector<Object *> args;
-
-    auto callv = std::format("__@attrCall_{}__", *(std::string *) dynamic_cast<VariableAccessNode *>(callNode->call->target)->variableNameToken.value);
-    auto o = ctx->symbols->Get(callv);
-    if (o == nullptr) {
-        std::cerr << "Internal interpreter error: Couldn't get attribution call" << std::endl;
-        std::cerr << "Native call stack traceback:" << std::endl << RuntimeError::GetNativeCallStackInfo() << std::endl;
-        assert(false);
-    }
-
-    currentCallStackDepth++;
-    if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
-        std::cout << currentCallStackDepth << std::endl;
-        currentCallStackDepth = 0;
-        return result->Failure(new RuntimeError(
-            std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
-            node->st, node->et, ctx
-        ));
-    }
-
-     for (auto &arg : callNode->call->arguments) {
-        auto v1 = result->Register(this->Visit(arg, ctx));
-        if (v1 != nullptr) {
-            v1->SetPos(node->st, node->et)->SetContext(ctx);
-        }
-        args.push_back(v1);
-        if (result->ShouldReturn()) {
-            result->error->st = node->st;
-            result->error->et = node->et;
-            ((RuntimeError *) result->error)->SetContext(ctx);
-            return result;
-        }
-    }
-
-    auto v = result->Register(o->Execute(args));
-    if (result->ShouldReturn()) {
-        return result;
-    }
-    
-    ctx->symbols->Remove(callv);
-    currentCallStackDepth--;
-    return result->Success(v->SetContext(ctx)->SetPos(node->st, node->et));
-}
-
-RuntimeResult *Interpreter::VisitAdvancedVarAccess(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto avNode = dynamic_cast<AdvancedVarAccessNode *>(node);
-    Object *tmp = nullptr;
-
-    for (auto &accessNode : avNode->advancedAccess) {        
-        tmp = result->Register(this->Visit(accessNode, ctx));
-        if (result->ShouldReturn()) {
-            return result;
-        }
-    }
-    return result->Success(tmp->SetContext(ctx)->SetPos(node->st, node->et)); 
-}
-
-RuntimeResult *Interpreter::VisitNewExpression(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    auto newNode = dynamic_cast<NewExprNode *>(node);
-    std::vector<Object *> args;
-    currentCallStackDepth++;
-    if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
-        currentCallStackDepth = 0;
-        return result->Failure(new RuntimeError(
-            std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
-            node->st, node->et, ctx
-        ));
-    }
-    
-    if (newNode->newExpr->nodeType == NodeType::FunctionCall) {
-         for (auto &arg : dynamic_cast<FunctionCallNode *>(newNode->newExpr)->arguments) {
-            args.push_back(result->Register(this->Visit(arg, ctx)));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-        }
-    }
-
-    if (newNode->newExpr->nodeType == NodeType::AdvancedVarAccess) {
-        auto access = dynamic_cast<AdvancedVarAccessNode *>(newNode->newExpr)->advancedAccess;
-        auto call = access[access.size() - 1];
-        if (call->nodeType != NodeType::Attribution) {
-            // std::cerr << "Fatal: Interpreter state error [While instantiating objects: 'invilid node']" << std::endl;
-            // std::cerr << "Native call stack traceback:" << std::endl << RuntimeError::GetNativeCallStackInfo() << std::endl;        
-            // assert(false); 
-            return result->Failure(new RuntimeError(
-                "Invilid access for object prototypes: without attribute access",
-                call->st, call->et, ctx
-            ));
-        }
-
-        auto caller = dynamic_cast<AttributionNode *>(call)->calls;
-        if (caller.size() > 1) {
-            // std::cerr << "Fatal: Interpreter state error [While instantiating objects: 'invalid call']" << std::endl;
-            // std::cerr << "Native call stack traceback:" << std::endl << RuntimeError::GetNativeCallStackInfo() << std::endl;        
-            // assert(false);
-            return result->Failure(new RuntimeError(
-                "Invilid access for object prototypes: with dynamic function call",
-                call->st, call->et, ctx
-            ));
-        } else if (caller.size() == 0) {
-            goto instantiate;
-        }
-
-        std::vector<int> positions;
-        for (const auto &[idx, call] : caller) {
-            positions.emplace_back(idx);
-        }
-
-        // get the last call
-        AttributionCallNode *nd = dynamic_cast<AttributionCallNode *>(caller[*std::max_element(positions.begin(), positions.end())]);
-        
-        for (auto &arg : nd->call->arguments) {
-            args.push_back(result->Register(this->Visit(arg, ctx)));
-            if (result->ShouldReturn()) {
-                return result;
-            }
-        }
-
-        for (auto n : dynamic_cast<AdvancedVarAccessNode *>(newNode->newExpr)->advancedAccess) {
-            if (n->nodeType == NodeType::Attribution) {
-                dynamic_cast<AttributionNode *>(n)->calls.clear();
-            }
-        }
-    }
-
-instantiate:
-    auto functionTarget = result->Register(this->Visit(newNode->newExpr, ctx));
-
-    if (result->ShouldReturn()) {
-        return result;
-    }
-    if (functionTarget->typeName != std::string("ClassObject")) {
-        return result->Failure(new TypeError(
-            "Keyword 'new' requires a constructor call",
-            functionTarget->startPos, functionTarget->endPos, ctx
-        ));
-    }
-
-    auto [ctor, error] = dynamic_cast<ClassObject *>(functionTarget)->GetAttr("__init__");
-    if (error != nullptr) {
-        return result->Failure(new TypeError(
-            std::format("Prototype of object '{}' has no constructor", As<ClassObject>(functionTarget)->className),
-            node->st, node->et, ctx
-        ));
-    }
-    if (ctor->typeName != std::string("Function") && ctor->typeName != std::string("BuiltinFunction") && ctor->typeName != std::string("BuiltinMethod")) {
-        return result->Failure(new TypeError(
-            "Constructor is not callable",
-            node->st, node->et, ctx
-        ));
-    }
-    auto returnValueTmp = functionTarget->Copy();
-    // auto returnValueTmp = functionTarget;
-    Object *boundedCtor = nullptr; 
-    if (ctor->typeName == std::string("Function")) {
-        boundedCtor = Method::FromFunction(As<Function>(ctor), returnValueTmp, std::format("{}.__init__", dynamic_cast<ClassObject *>(functionTarget)->className));
-    } else if (ctor->typeName == std::string("BuiltinFunction")) {
-        if (As<BuiltinFunction>(ctor)->dynamicImpl == nullptr) {
-            return result->Failure(new RuntimeError(
-                "Failed to construct object with invilid native constructor",
-                node->st, node->et, ctx
-            ));    
-        }
-        boundedCtor = BuiltinMethod::FromBuiltinFunction(As<BuiltinFunction>(ctor), returnValueTmp);
-    } else {
-        boundedCtor = ctor;
-        // TODO: Deprecated & danger operation note: Modification to linked object of a bounded method
-        As<BuiltinMethod>(boundedCtor)->self = returnValueTmp;
-    }
-    // boundedCtor->SetPos(node->st, node->et)->SetContext(ctx);
-    boundedCtor->SetPos(node->st, node->et);
-    result->Register(boundedCtor->Execute(args));
-    if (result->ShouldReturn()) {
-        result->error->st = node->st;
-        result->error->et = node->et;
-        return result->Failure(result->error);
-    }
-    As<ClassObject>(returnValueTmp)->isProto = false;
-    auto returnValue = returnValueTmp;
-    return result->Success(returnValue);
-}
-
-[[noreturn]] RuntimeResult *Interpreter::VisitEmpty(NodeBase *node, Context *ctx) {
-    std::cerr << "Fatal: Invilid node" << std::endl;
-    assert(false);
-}
-
-RuntimeResult *Interpreter::VisitDefer(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-    // auto currentFrame = ctx->symbols->Get(ctx->ctxLabel);
-    // if (currentFrame == nullptr) {
-    //     return result->Failure(new RuntimeError(
-    //         "'defer' statement outside a valid frame",
-    //         node->st, node->et, ctx
-    //     ));
-    // }
-    currentCallStackDepth++;
-    // if (currentFrame->typeName != std::string("Function") && currentFrame->typeName != std::string("Method")) {
-    //     return result->Failure(new RuntimeError(
-    //         "frame is not callable",
-    //         node->st, node->et, ctx
-    //     ));
-    // }
-
-    if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
-        currentCallStackDepth = 0;
-        return result->Failure(new RuntimeError(
-            std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
-            node->st, node->et, ctx
-        ));
-    }
-    
-    ctx->deferNodes.push_back(node);
-    return result->Success(Number::null);
-}
-
-RuntimeResult *Interpreter::VisitStructDef(NodeBase *node, Context *ctx) {
-    auto result = new RuntimeResult;
-
-    auto defNode = dynamic_cast<StructDefStmtNode *>(node);
-    auto structName = *(std::string *) defNode->structName.value;
-    
-    Object *ctorList = Number::null;
-    if (!defNode->args.empty()) {
-        std::vector<Object *> v;
-        for (const auto &p : defNode->args) {
-            v.push_back(new String(*(std::string *) p.value));
-        }
-        ctorList = new List(v);
-    }
-    
-    auto Class = new ClassObject({
-        { new String("__cls__"), new String(structName) },
-        { new String("__ctor_args__"), ctorList },
-        { new String("__init__"), Number::null }
-    });
-
-    // Here is a temproarily bind of method
-    if (defNode->args.empty()) {
-        Class->SetAttr("__init__", BuiltinMethod::FromBuiltinFunction(defaultInitializer, Class));
-    } else {
-        auto customCtor = new BuiltinFunction(std::format("{}__init__", structName));
-        std::vector<std::string> argList = { "self" };
-        for (const auto &p : defNode->args) {
-            argList.push_back(*(std::string *) p.value);
-        }
-        customCtor->Bind(argList, Class_Default__init__);
-        Class->SetAttr("__init__", BuiltinMethod::FromBuiltinFunction(customCtor, Class));
-    }
-    result->Register(Class->BuildClass());
-    if (result->ShouldReturn()) {
-        return result;
-    }
-    Class->SetPos(node->st, node->et)->SetContext(ctx);
-    ctx->symbols->Set(structName, Class);
-    return result->Success(Number::null);
-}
-
-Interpreter::~Interpreter() = default;
-
-void Initialize() {
-    srand((unsigned) time(nullptr));
-    // globalSymbolTable->Set("null", new Number(0));
-    globalSymbolTable->Set("false", new Number(0));
-    globalSymbolTable->Set("true", new Number(1));
-    globalSymbolTable->Set("pass", Number::null);
-    // globalSymbolTable->Set("pi", new Number(3.141592653589793238462));
-    globalSymbolTable->Set("null", Number::null);
-    InitializeBuiltins();
-    SetBuiltins(globalSymbolTable);
-
-    builtins::AllocEnvVars();
-    builtins::RestoreEnvVar();
-
-    defaultInitializer = new BuiltinFunction("_default__init__");
-    defaultInitializer->Bind({ "self" }, Class_Default__init__);
-}
-
-bool startAsShell = false;
-
-void Interprete(const std::string &file, const std::string &text, InterpreterStartMode mode, const std::string &frameId, Context *parent, Position *parentEntry) {
-    auto lexer = new Lexer(file, ToWideString(text));
-    auto result = lexer->MakeTokens();
-    if (result.second != nullptr) {
-        std::cerr << result.second->ToString() << std::endl;
-        return;
-    }
-    // if (debug) {
-    //     std::cout << "[DEBUG] Tokens: ";
-    //     PrintSequence(result.first);
-    //     std::cout << std::endl;    
-    // }
-
-    auto parser = new Parser(result.first);
-    auto parseResult = parser->Parse();
-    if (parseResult->err != nullptr) {
-        std::cerr << parseResult->err->ToString() << std::endl;
-        return;       
-    } 
-    // if (debug) {
-    //     std::cout << "[DEBUG] AST: " << parseResult->ast->ToString() << std::endl;    
-    // }
-
-    auto interpreter = new Interpreter();
-    Context *context;
-    if (mode != InterpreterStartMode::Evaluation) {
-        context = new Context("<module>");
-        context->symbols = globalSymbolTable;    
-        context->interpreter = interpreter;
-    } else {
-        context = new Context(frameId);
-        context->parent = parent;
-        context->symbols = globalSymbolTable;
-        context->parentEntry = parentEntry;
-    }
-    auto n = interpreter->Visit(parseResult->ast, context);
-    if (n->error != nullptr) {
-        if (n->cause == nullptr) {
-            std::cerr << n->error->ToString() << std::endl;
-            return; 
-        } else {
-            std::cerr << n->cause->ToString() << std::endl;
-            if (n->extraInfo == "") {
-                std::cerr << std::endl << "Above exception is the direct cause of the following exception: " << std::endl << std::endl;
-            } else {
-                std::cerr << std::endl << n->extraInfo << std::endl << std::endl;
-            }
-            std::cerr << n->error->ToString() << std::endl;
-            return;
-        }
-    }
-
-    if (n->value != nullptr) {
-        if (n->value->typeName == "String") {
-            // It may be impossible to reach here ...
-            dynamic_cast<String *>(n->value)->Representation();
-        } else {
-            int resultCount = std::get<int>(As<Number>(n->value->Len().first)->value);
-            if (resultCount == 1) {
-                if (mode == InterpreterStartMode::Repl) {
-                    auto o = As<List>(n->value)->elements[0];
-                    if (o->typeName == std::string("String")) {
-                        std::cout << "= ";
-                        As<String>(o)->Representation();
-                    } else {
-                        std::cout << "= " << o->ToString() << std::endl;
-                    }
-                } else if (mode == InterpreterStartMode::Evaluation && startAsShell) {
-                    auto o = As<List>(n->value)->elements[0];
-                    if (o->typeName == std::string("String")) {
-                        std::cout << std::format("[@{}]= ", frameId);
-                        As<String>(o)->Representation(); 
-                    } else {
-                        std::cout << std::format("[@{}]= ", frameId) << o->ToString() << std::endl;                    
-                    }
-                } else if (mode == InterpreterStartMode::Evaluation && !startAsShell) {
-                    auto o = As<List>(n->value)->elements[0];
-                    if (o->typeName == std::string("String")) {
-                        As<String>(o)->Representation();
-                    } else {
-                        std::cout << As<List>(n->value)->elements[0]->ToString() << std::endl;
-                    }
-                }
-            } else {
-                for (int i = 0; i < resultCount; i++) {
-                    if (mode == InterpreterStartMode::Repl) {
-                        auto o = As<List>(n->value)->elements[i];
-                        if (o->typeName == std::string("String")) {
-                            std::cout << std::format("[#{}]= ", i + 1);
-                            As<String>(o)->Representation(); 
-                        } else {
-                            std::cout << std::format("[#{}]= ", i + 1) << o->ToString() << std::endl;                    
-                        }
-                        // std::cout << std::format("[#{}]= ", i + 1) << As<List>(n->value)->elements[i]->ToString() << std::endl;
-                    } else if (mode == InterpreterStartMode::Evaluation && startAsShell) {
-                        auto o = As<List>(n->value)->elements[i];
-                        if (o->typeName == std::string("String")) {
-                            std::cout << std::format("[#{}, @{}]= ", i + 1, frameId);
-                            As<String>(o)->Representation(); 
-                        } else {
-                            std::cout << std::format("[#{}, @{}]= ", i + 1, frameId) << o->ToString() << std::endl;                    
-                        }
-                        // std::cout << std::format("[#{}, @{}]= ", i + 1, frameId) << As<List>(n->value)->elements[i]->ToString() << std::endl;
-                    } else if (mode == InterpreterStartMode::Evaluation && !startAsShell) {
-                        auto o = As<List>(n->value)->elements[i];
-                        if (o->typeName == std::string("String")) {
-                            As<String>(o)->Representation(); 
-                        } else {
-                            std::cout << o->ToString() << std::endl;                    
-                        }
-                        // std::cout << As<List>(n->value)->elements[i]->ToString() << std::endl;
-                    }
-                }
-            }
-        }
-    }
-
-    if (mode != InterpreterStartMode::Evaluation) {
-        for (auto r : contextResultCache) {
-            delete r;
-        }
-        contextResultCache.clear();
-    }
-    
-    delete lexer;
-    delete parser;
-    delete interpreter;
-}
-
-void CopyCommandLineArgs(int argc, char **argv, InterpreterStartMode mode, SymbolTable *dest) {
-    auto args = new List({});
-    assert(mode != InterpreterStartMode::Evaluation);
-    // if (debug) {
-    //     std::cout << "[DEBUG] Applying command line args to the global symbol table" << std::endl;
-    // }
-    for (int i = 1; i < argc; i++) {
-        args->elements.push_back(new String(std::string(argv[i])));
-    } 
-    dest->Set("args", args);
-}
-
-void Finalize() {
-    delete globalSymbolTable;
-
-    for (auto [builtinName, builtin] : allBuiltins) {
-        delete builtin;
-    }
-
-    for (auto [_, dylib] : dylibs) {
-        #ifdef __linux__
-            auto moduleFinalizer = dlsym(dylib, "Yan_OnDestroy");
-            if (moduleFinalizer != nullptr) {
-                ((void (*)()) moduleFinalizer)();
-            }
-            dlclose(dylib);
-        #elif defined(_WIN32)
-            auto moduleFinalizer = win32::GetProcAddress(dylib, "Yan_OnDestroy");
-            if (moduleFinalizer != nullptr) {
-                ((void (*)()) moduleFinalizer)();
-            }
-            win32::FreeLibrary(dylib);
-        #endif
-    }
-
-    for (auto [_, mod] : nativeModules) {
-        delete mod;
-    }
-
-    delete envVars;
-}
-
-void InterpreteFile(const std::string &filename) {
-    std::ifstream ifs;
-    std::ostringstream buf;
-    ifs.open(filename, std::ios::in);
-    if (!ifs.is_open()) {
-        std::cerr << std::format("Fatal: Couldn't open script: '{}'", filename) << std::endl;
-        return;
-    }
-    buf << ifs.rdbuf();
-    auto script = buf.str();
-
-    Interprete(filename, script, InterpreterStartMode::File);
-}
+﻿#include <utility>
+#ifdef _MSC_VER
+    #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#define YAN_C_API_START extern "C" {
+#define YAN_C_API_END }
+#define YAN_CONTEXT_DECORATION(current) ctx->ctxLabel = std::format("@{}." #current " (aka '{}')", moduleName, ctx->ctxLabel)
+#define YAN_METHOD_CONTEXT_DECORATION(name) ctx->ctxLabel = std::format("{}.{}", this->className, name)
+// deprecated macro
+#define YAN_INITIALIZE_CALL_STACK_INFO() 
+// deprecated 
+
+#define RESET "\033[0m"
+#define BLACK "\033[30m"  /* Black */
+#define RED "\033[31m"    /* Red */
+#define GREEN "\033[32m"  /* Green */
+#define YELLOW "\033[33m" /* Yellow */
+#define BLUE "\033[34m"   /* Blue */
+#define PURPLE "\033[35m" /* Purple */
+#define CYAN "\033[36m"   /* Cyan */
+#define WHITE "\033[37m"  /* White */
+#define BOLD_WHITE "\033[1;37m"
+
+#define NORMAL() (std::cout << RESET)
+#define INFO() (std::cout << GREEN)
+#define WARN() (std::cout << YELLOW)
+#define ERROR() (std::cout << RED)
+#define DEBUG() (std::cout << CYAN)
+
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <format>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <cassert>
+#include <functional>
+#include <variant>
+#include <cmath>
+#include <map>
+#include <deque>
+#include <unordered_map>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <locale>
+#include <codecvt>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+#include <array>
+#include <string_view>
+#include <bit>
+#include <climits>
+
+
+const char *YAN_LANG_VERSION = "2.0";
+const char *TOKEN_TYPE_TAGS[] {"Int", "Float", "OP_Plus", "OP_Minus", "OP_Mul", "OP_Div", "OP_Pow", 
+                            "Lparen", "Rparen", "LSquare", "RSquare", "Identifier", "Keyword", 
+                            "OP_Eq", "OP_Equal", "OP_Nequal", "OP_Lt", "OP_Gt", "OP_Lte", "OP_Gte", "Comma", "Arrow", "String", "Newline", "Dot", "Colon", "LStart", "RStart",
+                             "Invilid", "EOF"};
+const std::string EOF_ = "EOF";
+constexpr std::string_view KEYWORDS[] {
+    "var", "and", "or", "not", "if", "elif", "then", "else", "for", "while", "step", "to", "function", "end", "return", "continue", "break", "in", "new", "nonlocal",
+    "defer", "struct"
+};
+
+// Escape sequences of string literals: the character after the backslash and the character it stands for
+constexpr std::pair<char, char> ESCAPED_CHARACTERS[] {
+    { 'n', '\n' }, { 't', '\t' }, { 'b', '\b' }, { 'r', '\r' },
+    { '\'', '\'' }
+};
+
+const std::map<std::string, std::string> REVERSED_ESCAPE_CHARACTERS = [] {
+    std::map<std::string, std::string> reversed;
+    for (auto [escape, character] : ESCAPED_CHARACTERS) {
+        reversed[std::string(1, character)] = std::string(1, escape);
+    }
+    return reversed;
+}();
+
+#if defined(__LP64__) || defined(_WIN64)
+    const char *platformInfo = "AMD64";
+#else
+    const char *platformInfo = "i386";
+#endif
+
+#ifdef __clang__
+    const std::string compilerInfo =  std::format("[Clang {}.{}.{} ({})]", __clang_major__, __clang_minor__, __clang_patchlevel__, platformInfo);
+#endif
+
+#ifdef __GNUC__
+    #ifndef __clang__
+    const std::string compilerInfo = std::format("[GCC {}.{} ({})]", __GNUC__, __GNUC_PATCHLEVEL__, platformInfo);
+    #endif
+#endif
+
+#ifdef _MSC_VER
+    const std::string compilerInfo = std::format("[MSC v.{} ({})]", _MSC_VER, platformInfo);
+#endif
+
+#ifdef _WIN32
+    namespace win32 {
+        #include <windows.h>
+        #include <dbghelp.h>
+    }
+    const char *platform = "win32";
+#elif defined(__linux__)
+    #include <dlfcn.h>
+    #include <execinfo.h>
+    #include <cxxabi.h> 
+    const char *platform = "linux";
+#elif defined(__APPLE__)
+    const char *platform = "darwin"
+#else
+    const char *platform = "unknown";
+#endif
+
+const std::string compilationTimeStamp = std::format("({}, {})", __DATE__, __TIME__);
+bool debug = false;
+const long MAX_CALLSTACK_DEPTH = 50;
+static long currentCallStackDepth = 0;
+unsigned overflowCount = 0;
+const unsigned INVILID_OVERFLOW_TOLERANCE = 10;
+
+
+class BigInteger {
+    using size_t = std::size_t;
+
+public:
+    std::vector<int> GetInternalValue() {
+        return num;
+    }
+
+private:
+    static const int BASE = 100000000;
+    static const int WIDTH = 8;
+    bool sign;
+    size_t length;
+    std::vector<int> num;
+
+    void CutLeadingZero() {
+        while (num.back() == 0 && num.size() != 1) {
+            num.pop_back();
+        }
+    }
+
+    void SetLength() {
+        this->CutLeadingZero();
+        int tmp = num.back();
+        if (tmp == 0) {
+            length = 1;
+        } else {
+            length = (num.size() - 1) * 8;
+            while (tmp > 0) {
+                ++length;
+                tmp /= 10;
+            }
+        }
+    }
+
+public:
+    BigInteger(int n = 0) { *this = n; }
+    BigInteger(long long n) { *this = n; }
+    BigInteger(const char *n) { *this = n; }
+    BigInteger(const BigInteger &n) { *this = n; }
+    BigInteger(const std::string &n) { *this = n; }
+
+    const BigInteger& operator=(int n) {
+         *this = (long long)n;
+        return *this;
+    }
+
+    const BigInteger& operator=(long long n) {
+        num.clear();
+        if (n == 0) {
+            num.push_back(0);
+        }
+        if (n >= 0) {
+            sign = true;
+        } else if (n == LONG_LONG_MIN) {
+            *this = "-9223372036854775808";
+            return *this;
+        } else if (n < 0) {
+            sign = false;
+            n = -n;
+        }
+
+        while (n != 0) {
+            num.push_back(n % BASE);
+            n /= BASE;
+        }
+        this->SetLength();
+        return *this;
+    }
+
+    const BigInteger& operator=(const char *n) {
+        int len = strlen(n);
+        int tmp = 0;
+        int ten = 1;
+        int stop = 0;
+        num.clear();
+        sign = (n[0] != '-');
+        if (!sign) {
+            stop = 1;
+        }
+        for (int i = len; i > stop; --i) {
+            tmp += (n[i - 1] - '0') * ten;
+            ten *= 10;
+            if ((len - i) % 8 == 7) {
+                num.push_back(tmp);
+                tmp = 0;
+                ten = 1;
+            }
+        }
+        if ((len - stop) % WIDTH != 0) {
+            num.push_back(tmp);
+        }
+        SetLength();
+        return *this;
+    }
+
+    const BigInteger &operator=(const std::string &n) {
+        *this = n.c_str();
+        return *this;
+    }
+
+    const BigInteger& operator=(const BigInteger &n) {
+        num = n.num;
+        sign = n.sign;
+        length = n.length;
+        return *this;
+    }
+
+    size_t size() const { return this->length; }
+    BigInteger e(size_t n) const {
+        int tmp = n % 8;
+        BigInteger ans;
+        ans.length = n + 1;
+        n /= 8;
+
+        while (ans.num.size() <= n) {
+            ans.num.push_back(0);
+        }
+        ans.num[n] = 1;
+        while (tmp--) {
+            ans.num[n] *= 10;
+        }
+        return ans * (*this);
+    }
+
+    BigInteger abs() const {
+        BigInteger ans(*this);
+        ans.sign = true;
+        return ans;
+    }
+
+    const BigInteger& operator+() const {
+        return *this;
+    }
+
+    friend BigInteger operator+(const BigInteger &a, const BigInteger &b) {
+        if (!b.sign) {
+            return a - (-b);
+        }
+        if (!a.sign) {
+            return b - (-a);
+        }
+        BigInteger ans;
+        int carry = 0;
+        int aa, bb;
+        size_t lena = a.num.size();
+        size_t lenb = b.num.size();
+        size_t len = std::max(lena, lenb);
+        ans.num.clear();
+
+        for (size_t i = 0; i < len; ++i) {
+            if (lena <= i) {
+                aa = 0;
+            } else {
+                aa = a.num[i];
+            }
+            if (lenb <= i) {
+                bb = 0;
+            } else {
+                bb = b.num[i];
+            }
+            ans.num.push_back((aa + bb + carry) % BigInteger::BASE);
+            carry = (aa + bb + carry) / BigInteger::BASE;
+        }
+        if (carry > 0) {
+            ans.num.push_back(carry);
+        }
+        ans.SetLength();
+        return ans;
+    }
+
+    const BigInteger& operator+=(const BigInteger &n) {
+        *this = *this + n;
+        return *this;
+    }
+
+    const BigInteger& operator++() {
+        *this = *this + 1;
+        return *this;
+    }
+
+    BigInteger operator++(int) {
+        BigInteger ans(*this);
+        *this = *this + 1;
+        return ans;
+    }
+
+    BigInteger operator-() const {
+        BigInteger ans(*this);
+        if(ans != 0) {
+            ans.sign = !ans.sign;
+        }
+        return ans;
+    }
+
+    friend BigInteger operator-(const BigInteger &a, const BigInteger &b) {
+        if(!b.sign) {
+            return a + (-b);
+        }
+        if(!a.sign) {
+            return -((-a) + b);
+        }
+        if(a < b) {
+            return -(b - a);
+        }
+
+        BigInteger ans;
+        int carry = 0;
+        int aa, bb;
+        size_t lena = a.num.size();
+        size_t lenb = b.num.size();
+        size_t len = std::max(lena, lenb);
+        ans.num.clear();
+
+        for (size_t i = 0; i < len; ++i) {
+            aa = a.num[i];
+            if (i >= lenb) {
+                bb = 0;
+            } else {
+                bb = b.num[i];
+            }
+            ans.num.push_back((aa - bb - carry + BigInteger::BASE) % BigInteger::BASE);
+            if (aa < bb + carry) {
+                carry = 1;
+            } else {
+                carry = 0;
+            }
+        }
+     
+        ans.SetLength();
+        return ans;
+    }
+
+    const BigInteger& operator-=(const BigInteger &n) {
+        *this = *this - n;
+        return *this;
+    }
+
+    const BigInteger& operator--() {
+        *this = *this - 1;
+        return *this;
+    }
+
+    BigInteger operator--(int) {
+        BigInteger ans(*this);
+        *this = *this - 1;
+        return ans;
+    }
+
+    friend BigInteger operator*(const BigInteger &a, const BigInteger &b) {
+        size_t lena = a.num.size();
+        size_t lenb = b.num.size();
+        std::vector<long long> ansLL;
+        for (size_t i = 0; i < lena; ++i) {
+            for (size_t j = 0; j < lenb; ++j) {
+                if (i + j >= ansLL.size()) {
+                    ansLL.push_back((long long)a.num[i] * (long long)b.num[j]);
+                } else {
+                    ansLL[i + j] += (long long)a.num[i] * (long long)b.num[j];
+                }
+            }
+        }
+
+        while (ansLL.back() == 0 && ansLL.size() != 1) {
+            ansLL.pop_back();
+        }
+        size_t len = ansLL.size();
+        long long carry = 0;
+        long long tmp;
+        BigInteger ans;
+        ans.sign = (ansLL.size() == 1 && ansLL[0] == 0) || (a.sign == b.sign);
+        ans.num.clear();
+        for (size_t i = 0; i < len; ++i) {
+            tmp = ansLL[i];
+            ans.num.push_back((tmp + carry) % BigInteger::BASE);
+            carry = (tmp + carry) / BigInteger::BASE;
+        }
+        if (carry > 0) {
+            ans.num.push_back(carry);
+        }
+        ans.SetLength();
+        return ans;
+    }
+
+    const BigInteger& operator*=(const BigInteger &n) {
+        *this = *this * n;
+        return *this;
+    }
+
+    friend BigInteger operator/(const BigInteger &a, const BigInteger &b) {
+        BigInteger aa(a.abs());
+        BigInteger bb(b.abs());
+        if (aa < bb) {
+            return 0;
+        }
+        char *str = new char[aa.size() + 1];
+        memset(str, 0, sizeof(char) * (aa.size() + 1));
+        BigInteger tmp;
+        int lena = aa.length;
+        int lenb = bb.length;
+        for (int i = 0; i <= lena - lenb; ++i) {
+            tmp = bb.e(lena - lenb - i);
+            while(aa >= tmp) {
+                ++str[i];
+                aa = aa - tmp;
+            }
+            str[i] += '0';
+        }
+
+        BigInteger ans(str);
+        delete[] str;
+        ans.sign = (ans == 0 || a.sign == b.sign);
+        return ans;
+    }
+
+    const BigInteger& operator/=(const BigInteger &n) {
+        *this = *this / n;
+        return *this;
+    }
+
+    friend BigInteger operator%(const BigInteger &a, const BigInteger &b) {
+        return a - a / b * b;
+    }
+
+    const BigInteger& operator%=(const BigInteger &n) {
+        *this = *this - *this / n * n;
+        return *this;
+    }
+
+    friend bool operator<(const BigInteger &a, const BigInteger &b) {
+        if (a.sign && !b.sign) {
+            return false;
+        } else if (!a.sign && b.sign) {
+            return true;
+        } else if (a.sign && b.sign) {
+            if (a.length < b.length) {
+                return true;
+            } else if (a.length > b.length) {
+                return false;
+            } else {
+                size_t lena = a.num.size();
+                for (int i = lena - 1; i >= 0; --i) {
+                    if (a.num[i] < b.num[i]) {
+                        return true;
+                    } else if (a.num[i] > b.num[i]) {
+                        return false;
+                    }
+                }
+                return false;
+            }
+        } else {
+            return -b < -a;
+        }
+    }
+    
+    friend bool operator<=(const BigInteger &a, const BigInteger &b) {
+        return !(b < a);
+    }
+
+    friend bool operator>(const BigInteger &a, const BigInteger &b) {
+        return b < a;
+    }
+
+    friend bool operator>=(const BigInteger &a, const BigInteger &b) {
+        return !(a < b);
+    }
+
+    friend bool operator==(const BigInteger &a, const BigInteger &b) {
+        return !(a < b) && !(b < a);
+    }
+
+    friend bool operator!=(const BigInteger &a, const BigInteger &b) {
+        return (a < b) || (b < a);
+    }
+
+    friend bool operator||(const BigInteger &a, const BigInteger &b) {
+        return a != 0 || b != 0;
+    }
+
+    friend bool operator&&(const BigInteger &a, const BigInteger &b) {
+        return a != 0 && b != 0;
+    }
+
+    bool operator!() {
+        return *this == 0;
+    }
+
+    friend std::ostream& operator<<(std::ostream &out, const BigInteger &n) {
+         size_t len = n.num.size();
+        if(!n.sign) {
+            out << '-';
+        }
+        out << n.num.back();
+        for(int i = len - 2; i >= 0; --i) {
+            out << std::setw(BigInteger::WIDTH) << std::setfill('0') << n.num[i];
+        }
+        return out;
+    }
+
+    friend std::istream& operator>>(std::istream &in, BigInteger &n) {
+        std::string str;
+        in >> str;
+        size_t len = str.length();
+        size_t i, start = 0;
+        if(str[0] == '-') {
+            start = 1;
+        }
+        if(str[start] == '\0') {
+            return in;
+        }
+        for(i = start; i < len; ++i) {
+            if(str[i] < '0' || str[i] > '9') {
+                return in;
+            }
+        }
+        n = str.c_str();
+        return in;
+    }
+};
+
+
+enum class TokenType {
+    Int,
+    Float, 
+    OP_Plus,
+    OP_Minus,
+    OP_Mul,
+    OP_Div,
+    OP_Pow,
+    Lparen,
+    Rparen,
+    LSquare,
+    RSquare,
+    Identifier,
+    Keyword,
+    OP_Eq,
+    OP_Equal,
+    OP_Nequal,
+    OP_Lt,
+    OP_Gt,
+    OP_Lte,
+    OP_Gte,
+    Comma,
+    Arrow,
+    String,
+    NewLine,
+    Dot,
+    Colon,
+    LStart,
+    RStart,
+    Invilid,
+    __EOF__
+};
+
+const std::vector<TokenType> NUMERIC_TOKEN_TYPES { TokenType::Int, TokenType::Float };
+const std::vector<TokenType> OPERANDS { TokenType::OP_Mul, TokenType::OP_Div, TokenType::OP_Plus, TokenType::OP_Minus };
+
+
+inline std::wstring ToWideString(const std::string& input) {
+    try {
+        std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+        return converter.from_bytes(input);
+    } catch (std::range_error &re) {
+        std::cerr << "Fatal: Input string '" << input << "' contains invilid character(s)" << std::endl;
+        return L"0";
+    }
+}
+
+inline std::string ToByteString(const std::wstring& input) {
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+    return converter.to_bytes(input);
+}
+
+
+std::string DemangleSymbol(const char *symbol) {
+    #ifdef __linux__
+    const std::unique_ptr<char, decltype(&free)> demangled(abi::__cxa_demangle(symbol, 0, 0, 0), &free);
+    if (demangled) {
+        return demangled.get();
+    }
+    else {
+        return symbol;
+	}
+    #else
+        return std::string(symbol);
+    #endif
+}
+
+
+template<typename T>
+concept StringAble = requires(T t) {
+    t.ToString();
+};
+
+
+template<StringAble T>
+inline void PrintSequence(const std::vector<T> &seq) {
+    std::cout << "[";
+    for (int i = 0; i < seq.size(); i++) {
+        std::cout << seq[i].ToString();
+        if (i + 1 != seq.size()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]";
+}
+
+template<StringAble T>
+inline void PrintSequence(const std::vector<T *> &seq) {
+    std::cout << "[";
+    for (int i = 0; i < seq.size(); i++) {
+        std::cout << seq[i]->ToString();
+        if (i + 1 != seq.size()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]";
+}
+
+template<typename T>
+inline std::string StringifySequence(const std::vector<T *> &seq) {
+    std::string result = "[";
+    for (int i = 0; i < seq.size(); i++) {
+        result += seq[i]->ToString();
+        if (i + 1 != seq.size()) {
+            result += ", ";
+        }
+    }
+    result += "]";
+    return result;
+}
+
+inline std::string StringifyStringSequence(const std::vector<std::string> &seq) {
+    std::string result = "[";
+    for (int i = 0; i < seq.size(); i++) {
+        result += seq[i];
+        if (i + 1 != seq.size()) {
+            result += ", ";
+        }
+    }
+    result += "]";
+    return result;
+}
+
+
+struct Position;
+
+// One compilation of a source text: the text itself and the positions of its tokens.
+// Positions do not count references, the descriptor is retained by whatever may outlive the compilation (its tokens,
+// and objects, frames and errors through `PositionRef`); when the last holder is gone the buffers are dropped
+struct SourceFile final {
+    unsigned id;
+    std::string filename, content;
+    std::vector<Position> positions;
+    long refCount;
+
+    explicit SourceFile(unsigned id, const std::string &fn, const std::string &text) :
+        id(id), filename(fn), content(text), refCount(0) {}
+
+    inline void Retain() {
+        this->refCount++;
+    }
+
+    inline void Release() {
+        if (--this->refCount <= 0) {
+            // Keep the (small) descriptor alive for stale lookups and reuse, drop the buffers
+            this->refCount = 0;
+            std::string().swap(this->content);
+            std::vector<Position>().swap(this->positions);
+            std::vector<std::size_t>().swap(this->lineStarts);
+        }
+    }
+
+    inline bool Alive() const {
+        return this->refCount > 0;
+    }
+
+    // Returns the content of line `ln` (0-based), throws std::out_of_range if there is no such line
+    std::string GetLine(int ln) {
+        if (this->lineStarts.empty()) {
+            this->lineStarts.push_back(0);
+            for (std::size_t i = 0; i < this->content.size(); i++) {
+                if (this->content[i] == '\n') {
+                    this->lineStarts.push_back(i + 1);
+                }
+            }
+        }
+        if (ln < 0 || ln >= (int) this->lineStarts.size()) {
+            throw std::out_of_range(std::format("line {} is out of range", ln));
+        }
+        auto begin = this->lineStarts[ln];
+        auto end = ln + 1 < (int) this->lineStarts.size() ? this->lineStarts[ln + 1] - 1 : this->content.size();
+        return this->content.substr(begin, end - begin);
+    }
+
+private:
+    std::vector<std::size_t> lineStarts;
+};
+
+class SourceRegistry final {
+public:
+    // Returns the descriptor of a new compilation of `content`. Descriptors nobody holds anymore are reused for the
+    // same filename, so compiling the same file (or `eval` code) again and again does not grow the registry
+    static SourceFile *Open(const std::string &filename, const std::string &content) {
+        auto &candidates = SourceRegistry::index[filename];
+        for (auto file : candidates) {
+            if (!file->Alive()) {
+                file->content = content;
+                return file;
+            }
+        }
+        auto file = new SourceFile(SourceRegistry::files.size(), filename, content);
+        SourceRegistry::files.push_back(file);
+        candidates.push_back(file);
+        return file;
+    }
+
+    static inline SourceFile *Get(unsigned id) {
+        return id < SourceRegistry::files.size() ? SourceRegistry::files[id] : nullptr;
+    }
+
+    static inline std::size_t Count() {
+        return SourceRegistry::files.size();
+    }
+
+private:
+    static inline std::vector<SourceFile *> files;
+    static inline std::unordered_map<std::string, std::vector<SourceFile *>> index;
+};
+
+struct Position {
+    int index, line, column;
+    SourceFile *source;
+
+    Position(int idx, int ln, int col, SourceFile *src) :
+    index(idx), line(ln), column(col), source(src) {}
+
+    inline const std::string &Filename() const {
+        static const std::string unknown = "<unknown>";
+        return this->source != nullptr ? this->source->filename : unknown;
+    }
+
+    inline const std::string &FileContent() const {
+        static const std::string empty;
+        return this->source != nullptr ? this->source->content : empty;
+    }
+
+    inline Position *Advance(const std::wstring &ch = L"") {
+        this->index++;
+        this->column++;
+        if (ch == L"\n") {
+            this->line++;
+            this->column = 0;
+        }
+        return this;
+    }
+
+    inline Position *Copy() {
+        return new Position(*this);
+    }
+
+    inline std::string ToString() {
+        return std::format("Position(line:{}, col:{}) [{}:{}]", this->line + 1, this->column, this->Filename(), this->index);
+    }
+};
+
+// A Position kept by something which may outlive its compilation (objects, frames, errors).
+// Holding it retains the source, and with it the token positions of that compilation
+class PositionRef final {
+public:
+    PositionRef(Position *pos = nullptr) : pos(pos) {
+        PositionRef::Retain(pos);
+    }
+
+    PositionRef(const PositionRef &other) : PositionRef(other.pos) {}
+
+    PositionRef &operator=(const PositionRef &other) {
+        return *this = other.pos;
+    }
+
+    PositionRef &operator=(Position *pos) {
+        if (PositionRef::SourceOf(pos) != PositionRef::SourceOf(this->pos)) {
+            PositionRef::Retain(pos);
+            PositionRef::Release(this->pos);
+        }
+        this->pos = pos;
+        return *this;
+    }
+
+    ~PositionRef() {
+        PositionRef::Release(this->pos);
+    }
+
+    inline operator Position *() const {
+        return this->pos;
+    }
+
+    inline Position *operator->() const {
+        return this->pos;
+    }
+
+    inline Position &operator*() const {
+        return *this->pos;
+    }
+
+private:
+    static inline SourceFile *SourceOf(Position *pos) {
+        return pos != nullptr ? pos->source : nullptr;
+    }
+
+    static inline void Retain(Position *pos) {
+        if (auto source = PositionRef::SourceOf(pos)) {
+            source->Retain();
+        }
+    }
+
+    static inline void Release(Position *pos) {
+        if (auto source = PositionRef::SourceOf(pos)) {
+            source->Release();
+        }
+    }
+
+    Position *pos;
+};
+
+
+struct SymbolTable;
+struct NodeBase;
+class Interpreter;
+SymbolTable *globalSymbolTable;
+
+struct Context final {
+    std::string ctxLabel;
+    Context *parent;
+    PositionRef parentEntry;
+    SymbolTable *symbols;
+    SymbolTable *global;
+    SymbolTable *nonlocals;
+    std::vector<NodeBase *> deferNodes;
+    Interpreter *interpreter;
+    bool external;
+    Context *exFrame;
+    // Set once something outlives the call and still refers to the frame, keeps it out of the frame pool
+    bool captured;
+
+    explicit Context(const std::string &ctxName, Context *parent = nullptr, Position *parentEntry = nullptr) {
+        this->Reset(ctxName, parent, parentEntry);
+    }
+
+    // Prepares the context for a new frame, pooled frames are reset instead of reallocated
+    void Reset(const std::string &ctxName, Context *parent, Position *parentEntry) {
+        this->ctxLabel = ctxName;
+        this->parent = parent;
+        this->parentEntry = parentEntry;
+        this->interpreter = (parent && parent->interpreter) ? parent->interpreter : nullptr;
+        this->deferNodes.clear();
+        this->external = false;
+        this->exFrame = nullptr;
+        this->captured = false;
+        this->SetGlobalSymbolTable(globalSymbolTable);
+    }
+
+    // A frame referenced from a function defined in it or a loaded module also keeps its callers alive
+    void Capture() {
+        for (auto c = this; c != nullptr && !c->captured; c = c->parent) {
+            c->captured = true;
+        }
+    }
+
+    void SetGlobalSymbolTable(SymbolTable *st) {
+        this->global = st;
+    }
+    
+    inline void SetExternal(bool e) {
+        this->external = e;
+    }
+};
+
+struct Token {
+    void *value;
+    TokenType type;
+    Position *st;
+    Position *et;
+
+    Token() : value(nullptr), type(TokenType::Invilid), st(nullptr), et(nullptr) {}
+    explicit Token(TokenType t, void *v = nullptr, Position *st = nullptr, Position *et = nullptr) : 
+        type(t), value(v), st(st), et(et) {
+            if (st != nullptr) {
+                this->st = st->Copy();
+                this->et = st->Copy();
+                this->et->Advance();
+            }
+            if (et != nullptr) {
+                this->et = et->Copy();
+            }
+        }
+
+    // Makes a token which refers to a payload and positions owned by a TokenBuffer, nothing is copied
+    static inline Token View(TokenType t, void *v, Position *st, Position *et) {
+        Token tk;
+        tk.type = t;
+        tk.value = v;
+        tk.st = st;
+        tk.et = et;
+        return tk;
+    }
+
+    inline std::string ToString() const {
+        auto tokenTypeName = TOKEN_TYPE_TAGS[static_cast<int>(this->type)];
+        if (this->value != nullptr) {
+            if (this->type == TokenType::Int) {
+                return std::format("{}: {} ({})", tokenTypeName, this->value, *(long *) this->value);
+            } else if (this->type == TokenType::Float) {
+                return std::format("{}: {} ({})", tokenTypeName, this->value, *(double *) this->value);
+            } else if (this->type == TokenType::Identifier || this->type == TokenType::Keyword) {
+                return std::format("{}: {} ('{}')", tokenTypeName, this->value, *(std::string *) this->value);
+            } else if (this->type == TokenType::String) {
+                return std::format("{}: {} ('{}')", tokenTypeName, this->value, *(std::string *) this->value);
+            }
+        }
+        return std::string(tokenTypeName);
+    }
+
+    template<typename VT>
+    bool Matches(TokenType tt, const VT &value) {
+        return this->type == tt && (*(VT *) this->value) == value;
+    }
+
+    bool Matches(TokenType tt) {
+        return this->type == tt;
+    }
+};
+
+using Tokens = std::vector<Token>;
+
+// Packed token stream of one compilation.
+// Kinds, payloads and positions are stored in parallel arrays; numbers are kept inline and identifiers / string literals
+// are interned in a per-buffer string table, so a whole file is tokenized with a handful of allocations.
+// `Token`s handed out by `At()` are views into the buffer, which therefore has to outlive the AST built from it
+class TokenBuffer final {
+public:
+    union Payload {
+        long intValue;
+        double floatValue;
+        const std::string *stringValue;
+    };
+
+    // Token positions are stored in `source`, which stays alive as long as anything still refers to one of them
+    explicit TokenBuffer(SourceFile *source) : source(source) {
+        this->source->Retain();
+    }
+
+    TokenBuffer(const TokenBuffer &) = delete;
+    TokenBuffer &operator=(const TokenBuffer &) = delete;
+
+    ~TokenBuffer() {
+        this->source->Release();
+    }
+
+    inline void Reserve(std::size_t n) {
+        this->types.reserve(n);
+        this->payloads.reserve(n);
+        this->source->positions.reserve(n * 2);
+    }
+
+    inline void Push(TokenType type, Payload payload, const Position &st, const Position &et) {
+        this->types.push_back(type);
+        this->payloads.push_back(payload);
+        this->source->positions.push_back(st);
+        this->source->positions.push_back(et);
+    }
+
+    inline void Push(TokenType type, const Position &st, const Position &et) {
+        this->Push(type, Payload { .stringValue = nullptr }, st, et);
+    }
+
+    // Returns the unique copy of `s` owned by this buffer
+    const std::string *Intern(std::string_view s) {
+        auto it = this->stringIndex.find(s);
+        if (it != this->stringIndex.end()) {
+            return it->second;
+        }
+        auto &stored = this->strings.emplace_back(s);
+        this->stringIndex.emplace(std::string_view(stored), &stored);
+        return &stored;
+    }
+
+    inline std::size_t Size() const {
+        return this->types.size();
+    }
+
+    inline TokenType TypeAt(std::size_t i) const {
+        return this->types[i];
+    }
+
+    Token At(std::size_t i) {
+        void *value = nullptr;
+        switch (this->types[i]) {
+            case TokenType::Int:
+                value = &this->payloads[i].intValue;
+                break;
+            case TokenType::Float:
+                value = &this->payloads[i].floatValue;
+                break;
+            case TokenType::Identifier:
+            case TokenType::Keyword:
+            case TokenType::String:
+                value = (void *) this->payloads[i].stringValue;
+                break;
+            default:
+                break;
+        }
+        return Token::View(this->types[i], value, &this->source->positions[i * 2], &this->source->positions[i * 2 + 1]);
+    }
+
+private:
+    std::vector<TokenType> types;
+    std::vector<Payload> payloads;
+    SourceFile *source;
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, const std::string *> stringIndex;
+};
+
+std::string SubReplace(const std::string &resource_str, const std::string &sub_str, const std::string &new_str) {
+    std::string dst_str = resource_str;
+    std::string::size_type pos = 0;
+
+    while((pos = dst_str.find(sub_str)) != std::string::npos) {
+        dst_str.replace(pos, sub_str.length(), new_str);
+    }
+    return dst_str;
+}
+
+template<typename T>
+static inline bool Contains(const std::vector<T> &c, const T &v) {
+    for (auto e : c) {
+        if (v == e) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline std::vector<std::string> Split(const std::string &str, const std::string &splitter) {
+    std::vector<std::string> tokens;
+    // if (str != splitter && str.length() >= splitter.length()) {
+    //     char *src = new char[str.length() + 1];
+    //     strcpy(src, str.c_str());
+
+    //     char *token = strtok(src, splitter.c_str());
+    //     tokens.push_back(std::string(token));
+    //     while (true) {
+    //         token = strtok(nullptr, splitter.c_str());
+    //         if (token == nullptr) {
+    //             break;
+    //         }
+    //         tokens.push_back(std::string(token));
+    //     }
+    //     return tokens;
+    // } else {
+    //     tokens.push_back(str);
+    //     return tokens;
+    // }
+    if (str != splitter && str.length() >= splitter.length()) {
+        std::wstring wsplitter = ToWideString(splitter);        
+        std::wstring wstr = ToWideString(str);
+        wstr += wsplitter;
+
+        std::size_t pos = wstr.find(wsplitter);
+        int step = wsplitter.length();
+
+        while (pos != wstr.npos) {
+            std::wstring temp = wstr.substr(0, pos);
+            tokens.emplace_back(ToByteString(temp));
+            wstr = wstr.substr(pos + step, wstr.length());
+            pos = wstr.find(wsplitter);
+        
+        }
+        return tokens;
+    } else {
+        tokens.push_back(str);
+        return tokens;
+    }
+}
+
+std::string Join(const std::vector<std::string> &tokens, const std::string &splitter) {
+    std::stringstream ss;
+    int index = 1;
+    for (const auto &token : tokens) {
+        ss << token;
+        if (index != tokens.size()) {
+            ss << splitter;
+        }
+        index++;
+    }
+    return ss.str();
+}
+
+
+
+class Error {
+public:
+    Error(const std::string &name, const std::string &details, Position *st = nullptr, Position *et = nullptr) 
+    : name(name), details(details), st(st), et(et) {}
+ 
+    #define deprecated 
+    [[deprecated]] static std::string StringWithArrow(const std::string &s, Position *st, Position *et, int offset = 2, char ch = '^') {
+        if (st == nullptr || et == nullptr) {
+            return std::format("\n  {} (internal)", s);
+        }
+        std::string result;
+        int indexStart = std::max((int) s.rfind("\n", 0, st->index), 0);
+        int indexEnd = s.find("\n", indexStart + 1);
+        indexEnd = indexEnd < 0 ? s.length() : indexEnd;
+        int lineCount = et->line - st->line + 1;
+        
+        for (int line = 0; line < lineCount; line++) {
+            auto ln = s.substr(indexStart, indexEnd - indexStart);
+            auto columnStart = line == 0 ? st->column : 0;
+            auto columnEnd = line == lineCount - 1 ? et->column : ln.length() - 1;
+
+            result += ln + '\n';
+            result += std::string(columnStart + offset, ' ') + std::string(columnEnd - columnStart, ch);
+
+            indexStart = indexEnd;
+            indexEnd = s.find("\n", indexStart + 1);
+            indexEnd = indexEnd < 0 ? s.length() : indexEnd;
+        }
+        return SubReplace(result, "\t", "");
+    }
+
+    virtual std::string ToString() {
+        // Fix code line display
+        // auto content = Error::StringWithArrow(Split(this->st->fileContent, "\n")[this->st->line], this->st, this->et);
+        return std::format("File \"{}\", line {}\n  {}: {}", this->st->Filename(), this->st->line + 1, this->name, this->details);
+    }
+
+public:
+    std::string name;
+    std::string details;
+    PositionRef st;
+    PositionRef et;
+};
+
+struct Context;
+
+class IllegalCharacterError final : public Error {
+public:
+    IllegalCharacterError(const std::string &details, Position *st, Position *et) : 
+        Error("IllegalCharacterError", details, st, et) {}
+};
+
+class SyntaxError final : public Error {
+public:
+    SyntaxError(const std::string &details, Position *st, Position *et) : 
+        Error("SyntaxError", details, st, et) {}
+};
+
+class RuntimeError : public Error {
+public:
+    RuntimeError(const std::string &details, Position *st, Position *et, Context *ctx = nullptr) : 
+        Error("RuntimeError", details, st, et) {
+            this->ctx = ctx;
+        }
+    
+    RuntimeError(const std::string& errName, const std::string& details, Position *st, Position *et, Context *ctx = nullptr) :
+        Error(errName, details, st, et) {
+        this->ctx = ctx;
+    }
+
+    virtual std::string GenerateTraceBack() {
+        std::string result = "Stack Traceback:\n";
+        auto pos = this->st;
+        auto rt = this->ctx;
+        if (rt == nullptr || pos == nullptr) {
+            return "Stack Traceback:\n  [U] ?? (not avalible)";
+        }
+        while (rt != nullptr) {
+            // result += std::format("  at {}  [{}:{}] <+{}>\n", rt->ctxLabel, pos->filename, pos->line + 1, (void *) pos);
+            result += std::format("  at {}{}{} [{}{}{}:{}:{}]\n", CYAN, rt->ctxLabel, RESET, YELLOW, pos->Filename(), RESET, pos->line + 1, pos->column + 1);
+            pos = rt->parentEntry;
+            rt = rt->parent;
+        }
+        result = result.substr(0, result.length() - 1);
+
+        return result;
+    }
+
+    virtual std::string ToString() override {
+        // auto content = Error::StringWithArrow(Split(this->st->fileContent, "\n")[this->st->line], this->st, this->et);        
+        // Fix me: Error content display
+        auto basicErrorInfo = std::format("{}: {}", this->name, this->details);
+        auto traceback = this->GenerateTraceBack();
+        if (!this->st || !this->et) {
+            return std::format("{}{}{}\n {}", RED, basicErrorInfo, RESET, traceback);
+        }
+        try {
+            if (this->st->source == nullptr) {
+                throw std::out_of_range("source is not attached");
+            }
+            auto possibleSource = ToWideString(this->st->source->GetLine(this->st->line));
+            std::wstringstream wss;
+            const auto red = ToWideString(RED);
+            const auto reset = ToWideString(RESET);
+            int col = 0;
+
+            for (auto c : possibleSource) {
+                if (col == this->st->column - 1) {
+                    wss << ToWideString(RED);
+                }
+
+                if (this->et->line == this->st->line && col == this->et->column) {
+                    wss << ToWideString(RESET);
+                }
+                wss << c;
+                col++;
+            }
+            possibleSource = wss.str() + reset;
+            return std::format("{}{}{}\n  (Possibly related source: `{}{}{}`)\n{}", RED, basicErrorInfo, RESET, BOLD_WHITE, ToByteString(possibleSource), RESET, traceback);    
+        } catch (std::exception &e) {
+            return std::format("{}{}{}\n  {}{}{}\n{}", RED, basicErrorInfo, RESET, BOLD_WHITE, "(Source is not avaliable)", RESET, traceback);
+        }
+    }
+
+    static std::string GetNativeCallStackInfo(bool demangle = true, bool colored = true) {
+    #ifdef __linux__
+        std::stringstream ss;
+        void* addresses[256];
+        const int n = backtrace(addresses, std::extent<decltype(addresses)>::value);
+        const std::unique_ptr<char*, decltype(&free)> symbols(backtrace_symbols(addresses, n), &free);
+        for (int i = 0; i < n; i++) {
+            char *symbol = symbols.get()[i];
+            char *end = symbol;
+
+            // demangle 
+            if (demangle) {
+                int p = 0;
+                int q = 0;
+                while (*end) {
+                    ++end;
+                }
+                while (end != symbol && *end != '+') {
+                    --end;
+                }
+                char *begin = end;
+                while (begin != symbol && *begin != '(') {
+                    --begin;
+                }
+
+                if (begin != symbol) {
+                    auto str1 = std::string(symbol, ++begin - symbol);
+                    *end++ = '\0';
+                    std::string result = str1 + DemangleSymbol(begin) + '+' + end;
+                    ss << "#" << i + 1 << ": " << result << std::endl;
+                }
+                else {
+                    ss << "#" << i + 1 << ": " << symbol << std::endl;
+                }
+            } else {
+                ss << "#" << i + 1 << ": " << symbol << std::endl;
+            }
+        }
+        
+        auto r = ss.str();
+        std::stringstream rs;
+        for (auto &&c : std::move(r)) {
+            rs << c;            
+            if (colored) {
+                if (c == '(') {
+                    rs << CYAN;
+                } else if (c == ')') {
+                    rs << RESET;
+                } else if (c == '[') {
+                    rs << GREEN;
+                } else if(c == ']') {
+                    rs << RESET;
+                }
+            } 
+        }
+        return rs.str();
+    #else 
+        return "[Platform not supported]";
+    #endif
+    }
+
+    inline Context *GetContext() {
+        return this->ctx;
+    }
+
+    inline void SetContext(Context *ctx) {
+        this->ctx = ctx;
+    }
+
+private:
+    Context *ctx;
+};
+
+class TypeError : public RuntimeError {
+public:
+    explicit TypeError(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) :
+        RuntimeError("TypeError", details, st, et, ctx) {}
+};
+
+class ValueError : public RuntimeError {
+public:
+    explicit ValueError(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) :
+        RuntimeError("ValueError", details, st, et, ctx) {}
+};
+
+class OSError : public RuntimeError {
+public:
+    explicit OSError(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) : 
+        RuntimeError("OSError", details, st, et, ctx) {}
+};
+
+class Panic : public RuntimeError {
+public:
+    explicit Panic(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) :
+        RuntimeError("Panic", details, st, et, ctx) {}
+};
+
+class AttributeError : public RuntimeError {
+public:
+    explicit AttributeError(const std::string& details, Position* st, Position* et, Context* ctx = nullptr) :
+        RuntimeError("AttributeError", details, st, et, ctx) {}
+};
+
+class StopIteration : public RuntimeError {
+public:
+    explicit StopIteration() : StopIteration(nullptr, nullptr, nullptr) {}
+    explicit StopIteration(Position *st, Position *et, Context *ctx) :
+        RuntimeError("StopIteration", "",  st, et, ctx) {}
+};
+
+
+// Character classes used by the lexer, indexed by the raw (UTF-8) byte.
+// Every byte >= 0x80 belongs to a multibyte sequence and is treated as a part of an identifier
+enum CharClass : unsigned char {
+    CC_Space = 1 << 0,
+    CC_Separator = 1 << 1,
+    CC_Digit = 1 << 2,
+    CC_Operator = 1 << 3,
+    // Characters which terminate an identifier
+    CC_IdentifierStop = 1 << 4
+};
+
+constexpr std::array<unsigned char, 256> MakeCharClassTable() {
+    std::array<unsigned char, 256> table {};
+    for (unsigned char c : std::string_view(" \t")) {
+        table[c] |= CC_Space | CC_IdentifierStop;
+    }
+    for (unsigned char c : std::string_view("\n;")) {
+        table[c] |= CC_Separator;
+    }
+    table['\n'] |= CC_IdentifierStop;
+    for (unsigned char c = '0'; c <= '9'; c++) {
+        table[c] |= CC_Digit;
+    }
+    for (unsigned char c : std::string_view(" %&|\\+-*/^:[]{}()'=><!,;.?#@\"~`")) {
+        table[c] |= CC_Operator | CC_IdentifierStop;
+    }
+    return table;
+}
+
+constexpr std::array<unsigned char, 256> CHAR_CLASSES = MakeCharClassTable();
+
+// Length of an UTF-8 sequence by its leading byte (stray continuation bytes count as 1)
+constexpr std::array<unsigned char, 256> MakeUtf8LengthTable() {
+    std::array<unsigned char, 256> table {};
+    for (int c = 0; c < 256; c++) {
+        table[c] = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+    }
+    return table;
+}
+
+constexpr std::array<unsigned char, 256> UTF8_SEQUENCE_LENGTH = MakeUtf8LengthTable();
+
+// Character an escape sequence stands for by the byte after the backslash, 0 if it is not an escape
+constexpr std::array<char, 256> MakeEscapeTable() {
+    std::array<char, 256> table {};
+    for (auto [escape, character] : ESCAPED_CHARACTERS) {
+        table[(unsigned char) escape] = character;
+    }
+    return table;
+}
+
+constexpr std::array<char, 256> ESCAPE_TABLE = MakeEscapeTable();
+
+// Perfect hash for the keyword set: (length * 8 + first + last) mod 64 is collision-free for KEYWORDS,
+// which is checked at compile time below
+namespace keyword_hash {
+    constexpr std::size_t SLOTS = 64;
+
+    constexpr std::size_t Hash(std::string_view s) {
+        return (s.size() * 8 + (unsigned char) s.front() + (unsigned char) s.back()) % SLOTS;
+    }
+
+    constexpr std::array<std::string_view, SLOTS> MakeTable() {
+        std::array<std::string_view, SLOTS> table {};
+        for (auto kw : KEYWORDS) {
+            table[Hash(kw)] = kw;
+        }
+        return table;
+    }
+
+    constexpr std::array<std::string_view, SLOTS> TABLE = MakeTable();
+
+    constexpr bool IsCollisionFree() {
+        for (auto kw : KEYWORDS) {
+            if (TABLE[Hash(kw)] != kw) {
+                return false;
+            }
+        }
+        return true;
+    }
+    static_assert(IsCollisionFree(), "keyword hash has collisions, adjust keyword_hash::Hash");
+
+    constexpr bool IsKeyword(std::string_view s) {
+        return !s.empty() && TABLE[Hash(s)] == s;
+    }
+}
+
+
+class Lexer final {
+public:
+    explicit Lexer(const std::string &filename, const std::string &source) : 
+    text(source), filename(filename), cursor(0), pos(new Position(0, 0, 0, SourceRegistry::Open(filename, source))), tokens(nullptr) {
+        this->pos->source->Retain();
+    }
+
+    explicit Lexer(const std::string &filename, const std::wstring &t) : Lexer(filename, ToByteString(t)) {}
+
+    static inline long ParseInt(const std::string &numStr) {
+        std::istringstream is(numStr);
+        long num;
+        is >> num;
+        return num;
+    }
+
+    static inline std::pair<long, Error *> ParseIntWithError(const std::string &numStr, Position *st, Position *et) {
+        for (auto c : numStr) {
+            if (!isdigit(c)) {
+                return std::make_pair((long) 0, new Error(
+                    "ParseError",
+                    "Invilid characters in integer",
+                    st, et
+                ));
+            }
+        }
+        return std::make_pair(ParseInt(numStr), nullptr);
+    }
+
+    static inline std::pair<long, Error *> ParseFloatWithError(const std::string &numStr, Position *st, Position *et) {
+        for (auto c : numStr) {
+            if (!isdigit(c)) {
+                return std::make_pair((long) 0, new Error(
+                    "ParseError",
+                    "Invilid characters in a floating point number",
+                    st, et
+                ));
+            }
+        }
+        return std::make_pair(ParseFloat(numStr), nullptr);
+    }
+
+    static inline double ParseFloat(const std::string &numStr) {
+        std::istringstream is(numStr);
+        double num;
+        is >> num;
+        return num;
+    }
+
+    inline unsigned char Current() const {
+        return (unsigned char) this->text[this->cursor];
+    }
+
+    inline bool AtEnd() const {
+        return this->cursor >= this->text.size();
+    }
+
+    inline bool HasClass(unsigned char cls) const {
+        return !this->AtEnd() && (CHAR_CLASSES[this->Current()] & cls);
+    }
+
+    inline bool Is(char c) const {
+        return !this->AtEnd() && this->text[this->cursor] == c;
+    }
+
+    // Moves over one (possibly multibyte) character, positions count characters rather than bytes
+    void Advance() {
+        if (this->AtEnd()) {
+            this->pos->Advance();
+            return;
+        }
+        auto c = this->Current();
+        this->cursor = std::min(this->text.size(), this->cursor + UTF8_SEQUENCE_LENGTH[c]);
+        this->pos->index++;
+        this->pos->column++;
+        if (c == '\n') {
+            this->pos->line++;
+            this->pos->column = 0;
+        }
+    }
+
+    inline std::string_view CurrentCharacter() const {
+        if (this->AtEnd()) {
+            return EOF_;
+        }
+        return std::string_view(this->text).substr(this->cursor, UTF8_SEQUENCE_LENGTH[this->Current()]);
+    }
+
+    void MakeNumber() {
+        std::string numberString;
+        int dots = 0; // floating or integer
+        auto posStart = *this->pos;
+
+        while (this->HasClass(CC_Digit) || this->Is('.')) {
+            if (this->Is('.')) {
+                if (dots == 1) {
+                    break;
+                }
+                dots++;
+            }
+            numberString += this->text[this->cursor];
+            this->Advance();
+        }
+
+        if (dots == 0) {
+            this->tokens->Push(TokenType::Int, { .intValue = std::strtol(numberString.c_str(), nullptr, 10) }, posStart, *this->pos);
+        } else {
+            this->tokens->Push(TokenType::Float, { .floatValue = std::strtod(numberString.c_str(), nullptr) }, posStart, *this->pos);
+        }
+    }
+
+    void MakeIdentifier() {
+        auto posStart = *this->pos;
+        auto begin = this->cursor;
+
+        while (!this->AtEnd() && !(CHAR_CLASSES[this->Current()] & CC_IdentifierStop)) {
+            this->Advance();
+        }
+
+        auto identifier = std::string_view(this->text).substr(begin, this->cursor - begin);
+        auto isKeyword = keyword_hash::IsKeyword(identifier);
+        this->tokens->Push(isKeyword ? TokenType::Keyword : TokenType::Identifier, { .stringValue = this->tokens->Intern(identifier) }, posStart, *this->pos);
+    }
+
+    Error *MakeNeqToken() {
+        auto posStart = *this->pos;
+        this->Advance();
+        if (this->Is('=')) {
+            this->Advance();
+            this->tokens->Push(TokenType::OP_Nequal, posStart, *this->pos);
+            return nullptr;
+        }
+        this->Advance();
+        return new SyntaxError("Expected '=' (after '!' as '!=')", posStart.Copy(), this->pos->Copy());
+    }
+
+    // Lexes `first` or, if it is followed by '=', `withEquals` (=, ==, <, <=, >, >=)
+    void MakeOptionalEqualsToken(TokenType first, TokenType withEquals) {
+        auto posStart = *this->pos;
+        TokenType tt = first;
+        this->Advance();
+        if (this->Is('=')) {
+            this->Advance();
+            tt = withEquals;
+        }
+        this->tokens->Push(tt, posStart, *this->pos);
+    }
+
+    void MakeMinusOrArrowToken() {
+        auto ttype = TokenType::OP_Minus;
+        auto posStart = *this->pos;
+        this->Advance();
+
+        if (this->Is('>')) {
+            this->Advance();
+            ttype = TokenType::Arrow;
+        }
+        this->tokens->Push(ttype, posStart, *this->pos);
+    }
+
+    bool MakeString() {
+        std::string content;
+        auto posStart = *this->pos;
+        this->Advance();
+
+        while (!this->AtEnd() && !this->Is('\'')) {
+            if (this->Is('\\')) {
+                this->Advance();
+                if (this->AtEnd()) {
+                    break;
+                }
+                auto escaped = ESCAPE_TABLE[this->Current()];
+                if (escaped != 0) {
+                    content += escaped;
+                } else {
+                    content += this->CurrentCharacter();
+                }
+            } else {
+                content += this->CurrentCharacter();
+            }
+            this->Advance();
+        }
+
+        if (this->AtEnd()) {
+            return false;
+        }
+        this->Advance();
+        this->tokens->Push(TokenType::String, { .stringValue = this->tokens->Intern(content) }, posStart, *this->pos);
+        return true;
+    }
+
+    inline void MakeSingleCharToken(TokenType tt) {
+        auto et = *this->pos;
+        et.Advance();
+        this->tokens->Push(tt, *this->pos, et);
+        this->Advance();
+    }
+
+    // Tokenizes the whole source, the returned buffer is owned by the caller
+    std::pair<TokenBuffer *, Error*> MakeTokens() {
+        this->tokens = new TokenBuffer(this->pos->source);
+        this->tokens->Reserve(this->text.size() / 4 + 1);
+        auto fail = [this](Error *err) {
+            delete this->tokens;
+            this->tokens = nullptr;
+            return std::make_pair((TokenBuffer *) nullptr, err);
+        };
+
+        while (!this->AtEnd()) {
+            auto c = this->Current();
+            auto cls = CHAR_CLASSES[c];
+            if (cls & CC_Space) {
+                this->Advance();
+            } else if (cls & CC_Separator) {
+                this->MakeSingleCharToken(TokenType::NewLine);
+            } else if (cls & CC_Digit) {
+                this->MakeNumber();
+            } else if (!(cls & CC_Operator)) {
+                this->MakeIdentifier();
+            } else {
+                switch (c) {
+                    case '+': this->MakeSingleCharToken(TokenType::OP_Plus); break;
+                    case '-': this->MakeMinusOrArrowToken(); break;
+                    case '*': this->MakeSingleCharToken(TokenType::OP_Mul); break;
+                    case '/': this->MakeSingleCharToken(TokenType::OP_Div); break;
+                    case '^': this->MakeSingleCharToken(TokenType::OP_Pow); break;
+                    case '(': this->MakeSingleCharToken(TokenType::Lparen); break;
+                    case ')': this->MakeSingleCharToken(TokenType::Rparen); break;
+                    case '[': this->MakeSingleCharToken(TokenType::LSquare); break;
+                    case ']': this->MakeSingleCharToken(TokenType::RSquare); break;
+                    case '{': this->MakeSingleCharToken(TokenType::LStart); break;
+                    case '}': this->MakeSingleCharToken(TokenType::RStart); break;
+                    case ',': this->MakeSingleCharToken(TokenType::Comma); break;
+                    case '.': this->MakeSingleCharToken(TokenType::Dot); break;
+                    case ':': this->MakeSingleCharToken(TokenType::Colon); break;
+                    case '=': this->MakeOptionalEqualsToken(TokenType::OP_Eq, TokenType::OP_Equal); break;
+                    case '<': this->MakeOptionalEqualsToken(TokenType::OP_Lt, TokenType::OP_Lte); break;
+                    case '>': this->MakeOptionalEqualsToken(TokenType::OP_Gt, TokenType::OP_Gte); break;
+                    case '\'': {
+                        auto errorPos = this->pos->Copy();
+                        if (!this->MakeString()) {
+                            return fail(new SyntaxError("Mismatched `'` in string literal", errorPos, this->pos->Copy()));
+                        }
+                        break;
+                    }
+                    case '!': {
+                        auto error = this->MakeNeqToken();
+                        if (error != nullptr) {
+                            return fail(error);
+                        }
+                        break;
+                    }
+                    case '\\':
+                        if (this->cursor + 1 >= this->text.size() || this->text[this->cursor + 1] != '\n') {
+                            return fail(new IllegalCharacterError(
+                                "Trailing characters after line continuation character",
+                                this->pos->Copy(), this->pos->Copy()
+                            ));
+                        }
+                        this->Advance();
+                        this->Advance();
+                        break;
+                    default: {
+                        auto errorChar = std::string(this->CurrentCharacter());
+                        auto errorPos = this->pos->Copy();
+                        this->Advance();
+                        return fail(new IllegalCharacterError(std::format("Found unexpected \'{}\'", errorChar), errorPos, this->pos->Copy()));
+                    }
+                }
+            }
+        }
+
+        this->MakeSingleCharToken(TokenType::__EOF__);
+        auto tokens = this->tokens;
+        this->tokens = nullptr;
+        return std::make_pair(tokens, nullptr);
+    }
+
+    ~Lexer() {
+        delete this->tokens;
+        this->pos->source->Release();
+        delete this->pos;
+    }
+
+private:
+    std::string text;
+    std::string filename;
+    std::size_t cursor;
+    Position *pos;
+    TokenBuffer *tokens;
+};
+
+// Bump allocator for the AST of one compilation unit.
+// Objects are carved out of large blocks and destroyed all at once together with the arena
+class Arena final {
+public:
+    explicit Arena(std::size_t blockSize = 32 * 1024) : blockSize(blockSize), cursor(nullptr), limit(nullptr), allocated(0) {}
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() {
+        for (auto it = this->destructors.rbegin(); it != this->destructors.rend(); it++) {
+            it->first(it->second);
+        }
+        for (auto block : this->blocks) {
+            ::operator delete(block);
+        }
+    }
+
+    void *Allocate(std::size_t size, std::size_t align) {
+        auto p = reinterpret_cast<std::uintptr_t>(this->cursor);
+        auto aligned = (p + align - 1) & ~(std::uintptr_t) (align - 1);
+        if (this->cursor == nullptr || aligned + size > reinterpret_cast<std::uintptr_t>(this->limit)) {
+            auto n = std::max(this->blockSize, size + align);
+            auto block = static_cast<char *>(::operator new(n));
+            this->blocks.push_back(block);
+            this->cursor = block;
+            this->limit = block + n;
+            aligned = (reinterpret_cast<std::uintptr_t>(block) + align - 1) & ~(std::uintptr_t) (align - 1);
+        }
+        this->cursor = reinterpret_cast<char *>(aligned + size);
+        this->allocated += size;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    template<typename T, typename ...Args>
+    T *New(Args &&...args) {
+        auto object = new (this->Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            this->destructors.emplace_back([](void *o) { static_cast<T *>(o)->~T(); }, object);
+        }
+        return object;
+    }
+
+    inline std::size_t BytesAllocated() const {
+        return this->allocated;
+    }
+
+private:
+    std::size_t blockSize;
+    char *cursor, *limit;
+    std::size_t allocated;
+    std::vector<char *> blocks;
+    std::vector<std::pair<void (*)(void *), void *>> destructors;
+};
+
+
+enum class NodeType {
+    Number,
+    Expression,
+    SingleExpression,
+    VarAccess,
+    VarAssign,
+    IfExpression,
+    ForExpression,
+    WhileExpression,
+    FunctionDefinition,
+    FunctionCall,
+    String,
+    List,
+    Return,
+    Break,
+    Continue,
+    Subscription,
+    Dictionary,
+    Attribution,
+    AdvancedVarAccess,
+    NewExpression,
+    AttributionCall,
+    SubscriptionCall,
+    NonlocalStatement,
+    Defer,
+    StructDefStmt,
+    Invilid
+};
+
+const std::vector<std::string> NODE_TYPE_TAGS { 
+    "Number", "Expression", "SingleExpression", 
+    "VarAccess", "VarAssign", "IfExpression", "ForExpression", "WhileExpression",
+    "FunctionDefinition", "FunctionCall",
+    "String", "List",
+    "Return", "Break", "Continue",
+    "Subscription",
+    "Dictionary", "Attribution", "AdvancedVarAccess", 
+    "NewExpression",
+    "AttributionCall", "SubscriptionCall",
+    "NonlocalStatement",
+    "Defer", "StructDefStmt",
+    "Invilid" 
+};
+
+
+// Operator of a unary / binary operation node, resolved once by the parser
+enum class OperatorKind {
+    None,
+    Add, Subtract, Multiply, Divide, Power,
+    Equal, NotEqual, Less, Greater, LessEqual, GreaterEqual,
+    And, Or, Not
+};
+
+inline OperatorKind OperatorKindOf(const Token &tk) {
+    switch (tk.type) {
+        case TokenType::OP_Plus: return OperatorKind::Add;
+        case TokenType::OP_Minus: return OperatorKind::Subtract;
+        case TokenType::OP_Mul: return OperatorKind::Multiply;
+        case TokenType::OP_Div: return OperatorKind::Divide;
+        case TokenType::OP_Pow: return OperatorKind::Power;
+        case TokenType::OP_Equal: return OperatorKind::Equal;
+        case TokenType::OP_Nequal: return OperatorKind::NotEqual;
+        case TokenType::OP_Lt: return OperatorKind::Less;
+        case TokenType::OP_Gt: return OperatorKind::Greater;
+        case TokenType::OP_Lte: return OperatorKind::LessEqual;
+        case TokenType::OP_Gte: return OperatorKind::GreaterEqual;
+        case TokenType::Keyword: {
+            auto &kw = *(std::string *) tk.value;
+            if (kw == "and") {
+                return OperatorKind::And;
+            } else if (kw == "or") {
+                return OperatorKind::Or;
+            } else if (kw == "not") {
+                return OperatorKind::Not;
+            }
+            return OperatorKind::None;
+        }
+        default:
+            return OperatorKind::None;
+    }
+}
+
+struct NodeBase {
+    NodeType nodeType;
+    OperatorKind op;
+    NodeBase *left, *right;
+    Position *st, *et;
+
+    explicit NodeBase(NodeType tp, NodeBase *l, NodeBase *r) :
+        nodeType(tp), op(OperatorKind::None), left(l), right(r), st(nullptr), et(nullptr) {}
+    explicit NodeBase(NodeType tp) : 
+        NodeBase(tp, nullptr, nullptr) {}    
+    explicit NodeBase() : 
+        NodeBase(NodeType::Invilid) {}
+    
+    virtual ~NodeBase() = default;
+
+    virtual inline std::string ToString() {
+        return std::format("<Node {} at {}>", NODE_TYPE_TAGS[static_cast<int>(this->nodeType)], static_cast<void *>(this));
+    }
+
+};
+
+// Every node type is implemented by exactly one struct (`T::Kind`), so the tag alone decides the downcast
+template<typename T>
+inline T *NodeCast(NodeBase *node) {
+    assert(node->nodeType == T::Kind);
+    return static_cast<T *>(node);
+}
+
+struct NumberNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Number;
+    Token numberToken;
+    explicit NumberNode(Token nt) : NodeBase(NodeType::Number), numberToken(nt) {
+        this->st = this->numberToken.st;
+        this->et = this->numberToken.et;
+    }
+
+    inline std::string ToString() override {
+        return std::format("Number({})", this->numberToken.ToString());
+    }
+};
+
+struct CompilationUnit;
+struct BinaryOperationNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Expression;
+    Token binaryOperator;
+    
+    explicit BinaryOperationNode(NodeBase *lt, Token op, NodeBase *rt) : 
+        NodeBase(NodeType::Expression, lt, rt), binaryOperator(op) {
+            this->op = OperatorKindOf(op);
+            this->st = lt->st;
+            this->et = rt->et;
+        }
+    explicit BinaryOperationNode() = default;
+
+
+    inline std::string ToString() override {
+        auto ls = this->left == nullptr ? "null" : this->left->ToString();
+        auto rs = this->right == nullptr ? "null" : this->right->ToString();
+        return std::format("BinOp({}, {}, {})", ls, this->binaryOperator.ToString(), rs);
+    } 
+
+    inline std::string Representation() {
+        return "";
+    }
+
+    ~BinaryOperationNode() = default;
+};
+
+
+struct UnaryOperationNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::SingleExpression;
+    Token unaryOperator;
+    NodeBase *node;
+    explicit UnaryOperationNode(Token op, NodeBase *node) : unaryOperator(op), node(node), NodeBase(NodeType::SingleExpression) {
+        assert(node != nullptr);
+        this->op = OperatorKindOf(op);
+        this->st = this->unaryOperator.st;
+        this->et = node->et;
+    }
+
+    inline std::string ToString() override {
+        return std::format("UnaOp({}, {})", this->unaryOperator.ToString(), this->node->ToString());
+    }
+
+    inline std::string Representation() {
+        return "<UnaryOperation>";
+    }
+
+    ~UnaryOperationNode() = default;
+};
+
+
+// Hash of an identifier, computed once for the names in the AST and once per lookup by name.
+// Deterministic across the interpreter and native modules (each of them has its own copy of the header's globals)
+inline std::size_t SymbolHash(const std::string &name) {
+    return std::hash<std::string>{}(name);
+}
+
+struct SymbolTable;
+
+// Where a variable node last found its name: valid as long as the table's version did not change
+struct SymbolCache {
+    const SymbolTable *table = nullptr;
+    std::uint32_t version = 0;
+    int entry = -1;
+};
+
+// Names a function body binds in its own frame (parameters, assignments, loop variables, nested definitions),
+// each one owns a fixed slot of the frame's symbol table. Built by `Resolver` and owned by the unit's arena
+struct FrameLayout final {
+    std::vector<std::string> names;
+    std::vector<std::size_t> hashes;
+
+    inline int IndexOf(const std::string &name, std::size_t hash) const {
+        for (std::size_t i = 0; i < this->hashes.size(); i++) {
+            if (this->hashes[i] == hash && this->names[i] == name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    inline int IndexOf(const std::string &name) const {
+        return this->IndexOf(name, SymbolHash(name));
+    }
+
+    inline int Add(const std::string &name) {
+        auto hash = SymbolHash(name);
+        auto index = this->IndexOf(name, hash);
+        if (index < 0) {
+            this->names.push_back(name);
+            this->hashes.push_back(hash);
+            return this->names.size() - 1;
+        }
+        return index;
+    }
+};
+
+struct VariableAssignNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::VarAssign;
+    NodeBase *valueNode;
+    Token variableNameToken;
+    // Frame slot of the variable inside the enclosing function, -1 when it is looked up by name
+    const FrameLayout *layout;
+    int slot;
+    std::size_t hash;
+    explicit VariableAssignNode(Token var, NodeBase *value) :
+        NodeBase(NodeType::VarAssign), valueNode(value), variableNameToken(var), layout(nullptr), slot(-1), hash(SymbolHash(*(std::string *) var.value))
+    {
+        this->st = this->variableNameToken.st;
+        this->et = this->variableNameToken.et;
+    }
+};
+
+struct VariableAccessNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::VarAccess;
+    Token variableNameToken;
+    const FrameLayout *layout;
+    int slot;
+    std::size_t hash;
+    SymbolCache cache;
+    explicit VariableAccessNode(Token var) :
+        NodeBase(NodeType::VarAccess), variableNameToken(var), layout(nullptr), slot(-1), hash(SymbolHash(*(std::string *) var.value))
+    {
+        this->st = this->variableNameToken.st;
+        this->et = this->variableNameToken.et;
+    }
+};
+
+struct ListNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::List;
+    bool isStatements;
+    
+    std::vector<NodeBase *> elements;
+    NodeBase *subscripting;
+    NodeBase *newVal;
+    explicit ListNode(const std::vector<NodeBase *> &elements, Position *st, Position *et) : elements(elements), NodeBase(NodeType::List) {
+        this->st = st;
+        this->et = et;
+        this->subscripting = nullptr;
+        this->newVal = nullptr;
+    }
+
+    explicit ListNode(const std::vector<NodeBase *> &elements, Position *st, Position *et, NodeBase *sub, NodeBase *newVal = nullptr) :
+        elements(elements), NodeBase(NodeType::List) {
+            this->st = st;
+            this->et = et;
+            this->subscripting = sub;
+            this->newVal = newVal;
+        }
+};
+
+struct StructDefStmtNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::StructDefStmt;
+    Token structName;
+    std::vector<Token> args;
+
+    explicit StructDefStmtNode(Token sn, const std::vector<Token> &args = {}) : structName(sn), NodeBase(NodeType::StructDefStmt) {
+        this->st = sn.st;
+        this->et = sn.et;
+        this->args = args;
+    }
+};
+
+struct ParseResult final {
+    Error *err;
+    NodeBase *ast;
+    std::size_t advancedCount;
+
+    explicit ParseResult() : err(nullptr), ast(nullptr), advancedCount(0) {}
+    NodeBase *Register(ParseResult *pr) {
+        this->advancedCount += pr->advancedCount;
+        if (pr->err != nullptr) {
+            this->err = pr->err;
+        }
+        return pr->ast;
+    }
+
+    void RegisterAdvance() {
+        this->advancedCount++;
+    }
+
+    NodeBase *Register(NodeBase *node) {
+        this->RegisterAdvance();
+        return node;
+    }
+
+    Token Register(Token tk) {
+        this->RegisterAdvance();
+        return tk;
+    }
+
+    ParseResult *Success(NodeBase *node) {
+        this->ast = node;
+        return this;
+    }
+
+    ParseResult *Failure(Error *err) {
+        if (this->err == nullptr || this->advancedCount == 0) {
+            this->err = err;
+        }
+        return this;
+    }
+};
+
+
+struct IfExpressionNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::IfExpression;
+    std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>> cases;
+    std::pair<NodeBase *, bool> elseCase;
+
+    explicit IfExpressionNode(std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>> &&cases, std::pair<NodeBase *, bool> elseCase)
+        : cases(cases), elseCase(elseCase), NodeBase(NodeType::IfExpression)
+    {
+        this->st = this->cases[0].first.first->st;
+        if (this->elseCase.first != nullptr) {
+            this->et = this->elseCase.first->et;
+        } else {
+            this->et = this->cases[this->cases.size() - 1].first.first->et;
+        }
+    }
+};
+
+struct WhileExpressionNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::WhileExpression;
+    NodeBase *conditionNode, *body;
+    bool shouldReturnNull;
+    explicit WhileExpressionNode(NodeBase *cond, NodeBase *body, bool shouldReturnNull) 
+        : conditionNode(cond), body(body),shouldReturnNull(shouldReturnNull), NodeBase(NodeType::WhileExpression)
+    {
+        this->st = this->conditionNode->st;
+        this->et = this->body->et;
+    }
+};
+
+struct ForExpressionNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::ForExpression;
+    bool rangeBasedLoop;
+    NodeBase *stvNode, *etvNode, *stepvNode, *body;
+    NodeBase *range;
+    Token var;
+    bool shouldReturnNull;   
+    explicit ForExpressionNode(Token var, NodeBase *stvNode, NodeBase *etvNode, NodeBase *stepvNode, NodeBase *body, bool shouldReturnNull) 
+        : var(var), stvNode(stvNode), etvNode(etvNode), stepvNode(stepvNode), body(body), shouldReturnNull(shouldReturnNull), NodeBase(NodeType::ForExpression)
+    {
+        this->st = this->var.st;
+        this->et = this->body->et;
+        this->rangeBasedLoop = false;
+    }
+
+    explicit ForExpressionNode(Token var, NodeBase *range, NodeBase *body, bool shouldReturnNull)
+        : var(var), range(range), body(body), shouldReturnNull(shouldReturnNull), NodeBase(NodeType::ForExpression)
+    {
+        this->st = this->var.st;
+        this->et = this->body->et;
+        this->rangeBasedLoop = true;
+    }
+};
+
+struct NonlocalStatementNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::NonlocalStatement;
+    Token freeVar;
+
+    explicit NonlocalStatementNode(Token freeVar) : freeVar(freeVar), NodeBase(NodeType::NonlocalStatement) {
+        this->st = freeVar.st;
+        this->et = freeVar.et;
+    }
+};
+
+struct FunctionDefinitionNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::FunctionDefinition;
+    Token fun;
+    Tokens parameters;
+    NodeBase *body;
+    std::vector<NonlocalStatementNode *> freeVars;
+    std::vector<NonlocalStatementNode *> cellVars;
+    bool shouldAutoReturn;
+    std::vector<NodeBase *> defers;
+    CompilationUnit *unit;
+    FrameLayout *layout;
+
+    explicit FunctionDefinitionNode(Token fun, Tokens parameters, NodeBase *body, bool shouldAutoReturn, CompilationUnit *unit = nullptr) :
+        NodeBase(NodeType::FunctionDefinition), fun(fun), parameters(parameters), body(body), shouldAutoReturn(shouldAutoReturn), unit(unit), layout(nullptr)
+    {
+        if (this->fun.type != TokenType::Invilid) {
+            this->st = this->fun.st;
+        } else if (this->parameters.size() > 0) {
+            this->st = this->parameters[0].st;
+        } else {
+            this->st = this->body->st;
+        }
+        this->et = this->body->et;
+    }
+
+    void SetClosure(const std::vector<NonlocalStatementNode *> &f) {
+        this->freeVars = f;
+    }
+
+    void SetCell(const std::vector<NonlocalStatementNode *> &c) {
+        this->cellVars = c;
+    }
+
+    explicit FunctionDefinitionNode(Tokens parameters, NodeBase *body) : FunctionDefinitionNode(Token(TokenType::Invilid), parameters, body, true)
+    {}
+};
+
+struct FunctionCallNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::FunctionCall;
+    std::vector<NodeBase *> arguments;
+    NodeBase *target;
+    
+    explicit FunctionCallNode(NodeBase *target, std::vector<NodeBase *> arguments) :
+        arguments(arguments), target(target), NodeBase(NodeType::FunctionCall)
+    {
+        this->st = this->target->st;
+        if (this->arguments.size() > 0) {
+            this->et = this->arguments[this->arguments.size() - 1]->et;
+        } else {
+            this->et = this->target->et;
+        }
+    }
+};
+
+
+struct StringNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::String;
+    Token stringToken;
+    explicit StringNode(Token st) : NodeBase(NodeType::String), stringToken(st) {
+        this->st = this->stringToken.st;
+        this->et = this->stringToken.et;
+    }
+    
+    inline std::string ToString() override {
+        return std::format("String({})", this->stringToken.ToString());
+    }
+};
+
+struct ReturnStatementNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Return;
+    NodeBase *nodeToReturn;
+    explicit ReturnStatementNode(NodeBase *nodeToReturn, Position *st, Position *et) :
+        nodeToReturn(nodeToReturn), NodeBase(NodeType::Return) {
+        this->st = st;
+        this->et = et;
+    }
+};
+
+struct BreakStatementNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Break;
+    explicit BreakStatementNode(Position *st, Position *et) : NodeBase(NodeType::Break) {
+        this->st = st;
+        this->et = et;
+    }
+};
+
+struct ContinueStatementNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Continue;
+    explicit ContinueStatementNode(Position *st, Position *et) : NodeBase(NodeType::Continue) {
+        this->st = st;
+        this->et = et;
+    }
+};
+
+struct SubscriptionNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Subscription;
+    NodeBase *index;
+    std::vector<NodeBase *> subIndexes;
+    std::map<int, std::vector<NodeBase *>> calls;
+    NodeBase *assignment;
+    NodeBase *target;
+    explicit SubscriptionNode(NodeBase *t, NodeBase *idxExpr, NodeBase *assignment = nullptr) :
+        target(t), index(idxExpr), assignment(assignment), NodeBase(NodeType::Subscription)
+    {
+        this->st = this->index->st;
+        if (this->assignment != nullptr) {
+            this->et = this->assignment->et;
+        } else {
+            this->et = this->index->et;
+        }
+    }
+
+    void AddSubIndex(NodeBase *nd) {
+        this->subIndexes.push_back(nd);
+    }
+
+    void SetCalls(const std::map<int, std::vector<NodeBase *>> &calls) {
+        this->calls = calls;
+    }
+};
+
+
+struct AttributionNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Attribution;
+    Token attr;
+    std::vector<Token> subAttrs;
+    std::map<int, NodeBase *> calls;
+    NodeBase *assignment;
+    NodeBase *target;
+
+    explicit AttributionNode(NodeBase *t, Token a, NodeBase *ass = nullptr) :
+        target(t), attr(a), assignment(ass), NodeBase(NodeType::Attribution) 
+    {
+        this->st = this->attr.st;
+        if (this->assignment != nullptr) {
+            this->et = this->assignment->et;
+        } else {
+            this->et = this->attr.et;
+        }
+    }
+
+    inline void SetCalls(const std::map<int, NodeBase *> &calls) {
+        this->calls = calls;
+    }
+
+    inline void SetSubAttrs(const std::vector<Token> &attrs) {
+        this->subAttrs = attrs;
+    }
+};
+
+struct AttributionCallNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::AttributionCall;
+    FunctionCallNode *call;
+    explicit AttributionCallNode(FunctionCallNode *call) : call(call), NodeBase(NodeType::AttributionCall) {
+        this->st = this->call->st;
+        this->et = this->call->et;
+    }
+};
+
+struct SubscriptionCallNode final : public NodeBase {
+    static constexpr NodeType Kind = NodeType::SubscriptionCall;
+    std::vector<NodeBase *> arguments;
+    explicit SubscriptionCallNode(std::vector<NodeBase *> arguments, Position *st, Position *et) : arguments(arguments), NodeBase(NodeType::SubscriptionCall) {
+        this->st = st;
+        this->et = et;
+    }
+};
+
+struct AdvancedVarAccessNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::AdvancedVarAccess;
+    std::vector<NodeBase *> advancedAccess;
+
+    explicit AdvancedVarAccessNode(const std::vector<NodeBase *> &aa) :
+        advancedAccess(aa), NodeBase(NodeType::AdvancedVarAccess) 
+    {
+        this->st = this->advancedAccess[0]->st;
+        this->et = this->advancedAccess[this->advancedAccess.size() - 1]->et;
+    }
+ };
+
+struct DictionaryNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Dictionary;
+    std::map<NodeBase *, NodeBase *> elements;
+    
+    explicit DictionaryNode(const std::map<NodeBase *, NodeBase *> &elements, Position *st, Position *et) 
+        : NodeBase(NodeType::Dictionary), elements(elements)
+    {
+        this->st = st;
+        this->et = et;
+    }
+};
+
+struct NewExprNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::NewExpression;
+    NodeBase *newExpr;
+
+    explicit NewExprNode(NodeBase *newE) : newExpr(newE), NodeBase(NodeType::NewExpression) {
+        this->st = newE->st;
+        this->et = newE->et;
+    }
+};
+
+struct DeferNode : public NodeBase {
+    static constexpr NodeType Kind = NodeType::Defer;
+    NodeBase *deferExpr;
+
+    explicit DeferNode(NodeBase *de, Position *st, Position *et) : NodeBase(NodeType::Defer) {
+        this->deferExpr = de;
+        this->st = st;
+        this->et = et;
+    }
+};
+
+
+class Parser final {
+public:
+    explicit Parser(CompilationUnit *unit);
+
+    explicit Parser(TokenBuffer &tks, Arena *arena, CompilationUnit *unit = nullptr) : tokens(tks), arena(arena), unit(unit), tokenIndex(-1) {        
+        this->Advance();
+        this->functionLayers = 0;
+    }
+
+    Token Advance() {
+        this->tokenIndex++;
+        this->UpdateCurrentToken();
+        return this->currentToken;
+    }
+
+    void UpdateCurrentToken() {
+        if (this->tokenIndex < (int) this->tokens.Size()) {
+            this->currentToken = this->tokens.At(this->tokenIndex);
+        }
+    }
+
+    // Whether the current token can begin an expression, decided by looking at it alone
+    bool StartsExpression() {
+        switch (this->currentToken.type) {
+            case TokenType::Int: case TokenType::Float: case TokenType::String: case TokenType::Identifier:
+            case TokenType::Lparen: case TokenType::LSquare: case TokenType::LStart:
+            case TokenType::OP_Plus: case TokenType::OP_Minus:
+                return true;
+            case TokenType::Keyword: {
+                auto &kw = *(std::string *) this->currentToken.value;
+                return kw == "var" || kw == "not" || kw == "if" || kw == "for" || kw == "while" || kw == "function" || kw == "new";
+            }
+            default:
+                return false;
+        }
+    }
+
+    bool StartsStatement() {
+        if (this->currentToken.type == TokenType::Keyword) {
+            auto &kw = *(std::string *) this->currentToken.value;
+            if (kw == "return" || kw == "nonlocal" || kw == "defer" || kw == "struct" || kw == "continue" || kw == "break") {
+                return true;
+            }
+        }
+        return this->StartsExpression();
+    }
+
+    ParseResult *Statement() {
+        auto result = this->arena->New<ParseResult>();
+        auto posStart = this->currentToken.st;
+
+        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "return")) {
+            if (this->functionLayers == 0) {
+                return result->Failure(new SyntaxError(
+                    "'return' outside a user-defined function",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+            result->RegisterAdvance();
+            this->Advance();
+            NodeBase *returnExpression = nullptr;
+            if (this->StartsExpression()) {
+                returnExpression = result->Register(this->Expr());
+                if (result->err != nullptr) {
+                    return result;
+                }
+            }
+            return result->Success(this->arena->New<ReturnStatementNode>(returnExpression, posStart, this->currentToken.et));
+        }
+
+        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "nonlocal")) {
+            if (this->functionLayers < 2) {
+                return result->Failure(new SyntaxError(
+                    "'nonlocal' outside a closure function",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+
+            this->clousureLayer = this->functionLayers;
+            result->RegisterAdvance();
+            this->Advance();
+            if (this->currentToken.type != TokenType::Identifier) {
+                return result->Failure(new SyntaxError(
+                    "Nonlocal name must be a identifier",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+            auto nd = this->arena->New<NonlocalStatementNode>(this->currentToken);
+            this->closureNodes[this->functionLayers].push_back(nd);
+            result->RegisterAdvance();
+            this->Advance();
+            return result->Success(nd);
+        } else if (this->currentToken.Matches<std::string>(TokenType::Keyword, "defer")) {
+            if (this->functionLayers == 0) {
+                return result->Failure(new SyntaxError(
+                    "'defer' outside a user-defined function",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+            result->RegisterAdvance();
+            this->Advance();
+
+            auto deferExpr = result->Register(this->Expr());
+            return result->Success(this->arena->New<DeferNode>(deferExpr, posStart, this->currentToken.st));
+        } else if (this->currentToken.Matches<std::string>(TokenType::Keyword, "struct")) {
+            result->RegisterAdvance();
+            this->Advance();
+
+            auto sn = this->currentToken;
+            if (sn.type != TokenType::Identifier) {
+                return result->Failure(new SyntaxError(
+                    "`struct` requires an identifier",
+                    sn.st, sn.et
+                ));
+            }
+            result->RegisterAdvance();
+            this->Advance();
+            if (this->currentToken.type == TokenType::LSquare) {
+                result->RegisterAdvance();
+                this->Advance();
+                Tokens ctorParams;
+                if (this->currentToken.type == TokenType::RSquare) {
+                    return result->Failure(new SyntaxError(
+                        "Empty and explicitly constructor parameters list",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                if (this->currentToken.type != TokenType::Identifier) {
+                    return result->Failure(new SyntaxError(
+                        "Constructor parameters invalid",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                ctorParams.push_back(this->currentToken);
+                result->RegisterAdvance();
+                this->Advance();
+
+                while (this->currentToken.type == TokenType::Comma) {
+                    result->RegisterAdvance();
+                    this->Advance();
+                    if (this->currentToken.type != TokenType::Identifier) {
+                     return result->Failure(new SyntaxError(
+                        "Constructor parameters invalid",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                    }
+                    ctorParams.push_back(this->currentToken);
+                    result->RegisterAdvance();
+                    this->Advance();
+                }
+
+                if (this->currentToken.type != TokenType::RSquare) {
+                    return result->Failure(new SyntaxError(
+                        "'[' mismatched",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                result->RegisterAdvance();
+                this->Advance();
+                return result->Success(this->arena->New<StructDefStmtNode>(sn, ctorParams));
+            } else {
+                return result->Success(this->arena->New<StructDefStmtNode>(sn));
+            }
+        }
+
+        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "continue")) {
+            result->RegisterAdvance();
+            this->Advance();
+            return result->Success(this->arena->New<ContinueStatementNode>(posStart, this->currentToken.et));
+        }
+    
+        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "break")) {
+            result->RegisterAdvance();
+            this->Advance();
+            return result->Success(this->arena->New<BreakStatementNode>(posStart, this->currentToken.et));
+        }
+
+        auto expr = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            // return result->Failure(new SyntaxError(
+            //     "Invilid statement", this->currentToken.st, this->currentToken.et
+            // ));
+            return result;
+        }
+        return result->Success(expr);
+    }
+
+    ParseResult *Statements() {
+        auto result = this->arena->New<ParseResult>();
+        std::vector<NodeBase *> statements;
+        auto posStart = this->currentToken.st;
+
+        while (this->currentToken.type == TokenType::NewLine) {
+            result->RegisterAdvance();
+            this->Advance();
+        }
+
+        auto statement = result->Register(this->Statement());
+        if (result->err != nullptr) {
+            return result;
+        }
+        statements.push_back(statement);
+        unsigned newLineCount = 0;
+
+        while (true) {
+            newLineCount = 0;
+            while (this->currentToken.type == TokenType::NewLine) {
+                result->RegisterAdvance();
+                this->Advance();
+                newLineCount++;
+            }
+            // Statements are separated by line breaks, a block ends at the first token which cannot start one
+            if (newLineCount == 0 || !this->StartsStatement()) {
+                break;
+            }
+            auto statementNode = result->Register(this->Statement());
+            if (result->err != nullptr) {
+                return result;
+            }
+            statements.push_back(statementNode);        
+        }
+
+        auto n = this->arena->New<ListNode>(statements, posStart, this->currentToken.et);
+        n->isStatements = true;
+        return result->Success(n);
+    }
+
+    // Operand of an operator expression: an atom followed by an optional call and the attribution chain after it.
+    // Subscription / attribution chains on identifiers are consumed by `Atom`
+    NodeBase *Postfix(ParseResult *result) {
+        auto atomNode = result->Register(this->Atom());
+        if (result->err != nullptr || this->currentToken.type != TokenType::Lparen) {
+            return atomNode;
+        }
+
+        std::vector<NodeBase *> args;
+        result->RegisterAdvance();
+        this->Advance();
+
+        if (this->currentToken.type == TokenType::Rparen) {
+            result->RegisterAdvance();
+            this->Advance();
+        } else {
+            args.push_back(result->Register(this->Expr()));
+            if (result->err != nullptr) {
+                return nullptr;
+            }
+
+            while (this->currentToken.type == TokenType::Comma) {
+                result->RegisterAdvance();
+                this->Advance();
+                args.push_back(result->Register(this->Expr()));
+                if (result->err != nullptr) {
+                    return nullptr;
+                }
+            }
+
+            if (this->currentToken.type != TokenType::Rparen) {
+                result->Failure(new SyntaxError(
+                    "Mismatched '(' while calling function (unfinished)",
+                    this->currentToken.st, this->currentToken.et
+                ));
+                return nullptr;
+            }
+
+            result->RegisterAdvance();
+            this->Advance();
+        }
+
+        auto nd = this->arena->New<FunctionCallNode>(atomNode, args);
+        if (this->currentToken.type == TokenType::Dot) {
+            return result->Register(this->Attribution(nd));
+        }
+        return nd;
+    }
+
+    // TODO: Attribute access after function call is invaild? f().a -> error [Temp solved]
+
+    ParseResult *ListSetItem() {
+        auto result = this->arena->New<ParseResult>();
+        if (this->currentToken.type != TokenType::OP_Eq) {
+            return result->Failure(new SyntaxError(
+                "Expected '=' in list-setitem", 
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+         
+        result->RegisterAdvance();
+        this->Advance();
+        auto valueExpr = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            return result;
+        }
+        return result->Success(valueExpr);
+    }
+
+    std::pair<ParseResult *, NodeBase *> ListSubscription() {
+        auto result = this->arena->New<ParseResult>();
+        if (this->currentToken.type != TokenType::LSquare) {
+            return std::make_pair(result->Failure(new SyntaxError(
+                "Expected '['", this->currentToken.st, this->currentToken.et
+            )), nullptr);
+        }
+
+        result->RegisterAdvance();
+        this->Advance();
+        auto subscriptionExpr = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            return std::make_pair(result, nullptr);
+        }
+    
+        if (this->currentToken.type != TokenType::RSquare) {
+            return std::make_pair(result->Failure(new SyntaxError(
+                "'[' mismatched in list-subsciption",
+                this->currentToken.st, this->currentToken.et
+            )), nullptr);
+        }
+        result->RegisterAdvance();
+        this->Advance();
+
+        if (this->currentToken.type == TokenType::OP_Eq) {
+            auto valueExpr = result->Register(this->ListSetItem());
+            if (result->err != nullptr) {
+                return std::make_pair(result, nullptr);
+            }
+            return std::make_pair(result->Success(subscriptionExpr), valueExpr);
+        } else {
+            return std::make_pair(result->Success(subscriptionExpr), nullptr);
+        }
+    }
+
+    ParseResult *List() {
+        auto result = this->arena->New<ParseResult>();
+        std::vector<NodeBase *> elementNodes;
+        auto posStart = this->currentToken.st;
+        if (this->currentToken.type != TokenType::LSquare) {
+            return result->Failure(new SyntaxError(
+                "Expected '[' when declaring a list",
+                posStart, this->currentToken.et
+            ));
+        }
+
+        result->RegisterAdvance();
+        this->Advance();
+
+        if (this->currentToken.type == TokenType::RSquare) {
+            result->RegisterAdvance();
+            this->Advance();
+        } else {
+            elementNodes.push_back(result->Register(this->Expr()));
+            if (result->err != nullptr) {
+                return result->Failure(new SyntaxError(
+                    "Invilid list definition",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+
+            while (this->currentToken.type == TokenType::Comma) {
+                result->RegisterAdvance();
+                this->Advance();
+                elementNodes.push_back(result->Register(this->Expr()));
+                if (result->err != nullptr) {
+                    return result;
+                }
+            }
+
+            if (this->currentToken.type != TokenType::RSquare) {
+                return result->Failure(new SyntaxError(
+                    "Mismatched ']' while giving initalizations to a list (unfinished)",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+
+            result->RegisterAdvance();
+            this->Advance();
+        }
+
+        if (this->currentToken.type == TokenType::LSquare) {
+            auto [subsciptionExprWrapper, newValue] = this->ListSubscription();
+            if (subsciptionExprWrapper->err != nullptr) {
+                return result->Failure(subsciptionExprWrapper->err);
+            }
+            auto n = this->arena->New<ListNode>(elementNodes, posStart, this->currentToken.et, subsciptionExprWrapper->ast, newValue);
+            n->isStatements = false;
+            return result->Success(n);
+        } else {
+            auto n = this->arena->New<ListNode>(elementNodes, posStart, this->currentToken.et);
+            n->isStatements = false;
+            return result->Success(n);
+        }
+    }
+
+    ParseResult *Dictionary() {
+        auto result = this->arena->New<ParseResult>();
+        std::map<NodeBase *, NodeBase *> elementNodes;
+        NodeBase *currentKey = nullptr, *currentValue = nullptr;
+        auto posStart = this->currentToken.st;
+        if (this->currentToken.type != TokenType::LStart) {
+            return result->Failure(new SyntaxError(
+                "Expected '{' when declaring a dictionary",
+                posStart, this->currentToken.et
+            ));
+        }
+        result->RegisterAdvance();
+        this->Advance();
+    
+        if (this->currentToken.type == TokenType::RStart) {
+            result->RegisterAdvance();
+            this->Advance();
+        } else {
+            currentKey = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                // return result->Failure(new SyntaxError(
+                //     "Invilid dictionary definition",
+                //     this->currentToken.st, this->currentToken.et
+                // ));
+                return result;
+            }
+            if (this->currentToken.type != TokenType::Colon) {
+                return result->Failure(new SyntaxError(
+                    "Expected ':' to seperate key and value",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+            result->RegisterAdvance();
+            this->Advance();
+            currentValue = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            elementNodes.insert(std::make_pair(currentKey, currentValue));
+
+            while (this->currentToken.type == TokenType::Comma) {
+                result->RegisterAdvance();
+                this->Advance();
+                currentKey = result->Register(this->Expr());
+                if (result->err != nullptr) {
+                    return result;
+                }
+                if (this->currentToken.type != TokenType::Colon) {
+                    return result->Failure(new SyntaxError(
+                        "Expected ':' to seperate key and value",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                result->RegisterAdvance();
+                this->Advance();
+                currentValue = result->Register(this->Expr());
+                if (result->err != nullptr) {
+                    return result;
+                }
+                elementNodes.insert(std::make_pair(currentKey, currentValue));            
+            }
+
+            if (this->currentToken.type != TokenType::RStart) {
+                return result->Failure(new SyntaxError(
+                    "Mismatched '}' while initalizing a dictionary (unfinished)",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+
+            result->RegisterAdvance();
+            this->Advance();
+        }            
+        return result->Success(this->arena->New<DictionaryNode>(elementNodes, posStart, this->currentToken.et));
+    }
+
+    std::pair<std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>>, std::pair<ParseResult *, bool>> IfExprCases(const std::string &type) {
+        auto result = this->arena->New<ParseResult>();
+        using CaseInfo = std::pair<std::pair<NodeBase *, NodeBase *>, bool>;
+        std::vector<CaseInfo> cases;
+        std::pair<ParseResult *, bool> elseCase;
+
+        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, type)) {
+            return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(new SyntaxError(
+                std::format("Expected '{}'", type), this->currentToken.st, this->currentToken.et
+            )), false));
+        }
+        result->RegisterAdvance();
+        this->Advance();
+
+        auto condition = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            return std::make_pair(decltype(cases)(), std::make_pair(result, false));
+        }
+
+        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "then")) {
+            return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(new SyntaxError(
+                "Expected 'then' in if-statement",
+                this->currentToken.st, this->currentToken.et
+            )), false));
+        }
+        result->RegisterAdvance();
+        this->Advance();
+
+        if (this->currentToken.type == TokenType::NewLine) {
+            result->RegisterAdvance();
+            auto statements = result->Register(this->Statements());
+            if (result->err != nullptr) {
+                return std::make_pair(decltype(cases)(), std::make_pair(result, false));
+            }
+
+            cases.push_back(std::make_pair(std::make_pair(condition, statements), true));
+
+            if (this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
+                result->RegisterAdvance();
+                this->Advance();
+            } else {
+                auto allCases = this->IfExprBOrC();
+                if (result->err != nullptr) {
+                    return std::make_pair(decltype(cases)(), std::make_pair(result, false));
+                }
+                auto newCases = allCases.first;
+                elseCase = allCases.second;
+                for (auto &&otherCases : newCases) {
+                    cases.push_back(otherCases);
+                }
+            }
+        } else {
+            auto statement = result->Register(this->Statement());
+            if (result->err != nullptr) {
+                return std::make_pair(decltype(cases)(), std::make_pair(result, false));
+            }
+            cases.push_back(std::make_pair(std::make_pair(condition, statement), false));
+
+            auto allCases = this->IfExprBOrC();
+            if (allCases.second.first != nullptr && allCases.second.first->err != nullptr) {
+                return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(allCases.second.first->err), false));
+            }
+            auto newCases = allCases.first;
+            elseCase = allCases.second;
+            for (auto &&otherCases : newCases) {
+                cases.push_back(otherCases);
+            }
+        }
+
+        return std::make_pair(cases, elseCase);
+    } 
+
+    std::pair<std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>>, std::pair<ParseResult *, bool>> IfExprB() {
+        return this->IfExprCases("elif"); 
+    }
+
+    std::pair<ParseResult *, bool> *IfExprC() {
+        auto result = this->arena->New<ParseResult>();
+        std::pair<ParseResult *, bool> *elseCase = nullptr;
+
+        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "else")) {
+            result->RegisterAdvance();
+            this->Advance();
+
+            if (this->currentToken.type == TokenType::NewLine) {
+                result->RegisterAdvance();
+                this->Advance();
+
+                elseCase = new std::pair<ParseResult *, bool>;                
+                auto statements = result->Register(this->Statements());
+                if (result->err != nullptr) {
+                    *elseCase = std::make_pair(nullptr, false);
+                    return elseCase;
+                }
+                *elseCase = std::make_pair(result->Success(statements), true);
+
+                if (this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
+                    result->RegisterAdvance();
+                    this->Advance();
+                } else {
+                    elseCase = new std::pair<ParseResult *, bool>;               
+                    *elseCase = std::make_pair(result->Failure(new SyntaxError(
+                        "Expected 'end' after multi-line statement",
+                        this->currentToken.st, this->currentToken.et
+                    )), false);
+                    return elseCase;
+                }
+            } else {
+                auto statement = result->Register(this->Statement());
+                if (result->err != nullptr) {
+                    elseCase = new std::pair<ParseResult *, bool>;
+                    *elseCase = std::make_pair(result, false);
+                    return elseCase;
+                }
+                elseCase = new std::pair<ParseResult *, bool>;
+                *elseCase = std::make_pair(result->Success(statement), false);
+                return elseCase;
+            }
+        }
+        return elseCase;
+    }
+
+    std::pair<std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>>, std::pair<ParseResult *, bool>> IfExprBOrC() {
+        auto result = this->arena->New<ParseResult>();
+        std::vector<std::pair<std::pair<NodeBase *, NodeBase *>, bool>> cases;
+        std::pair<ParseResult *, bool> elseCase;
+
+        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "elif")) {
+            auto allCases = this->IfExprB();
+            if (allCases.second.first) {
+                if (allCases.second.first->err != nullptr) {
+                    return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(allCases.second.first->err), false));
+                }
+            }
+            cases = allCases.first;
+            elseCase = allCases.second;
+        } else {
+            auto elseCase_ = this->IfExprC();
+            if (elseCase_ == nullptr) {
+                 return std::make_pair(cases, std::make_pair(result->Success(nullptr), false));
+            } else {
+                elseCase = *elseCase_;
+            }
+            if (elseCase.first != nullptr && elseCase.first->err != nullptr) {
+                return std::make_pair(decltype(cases)(), std::make_pair(result->Failure(elseCase.first->err), false));
+            }
+        }
+        return std::make_pair(cases, elseCase);
+    }
+
+    ParseResult *IfExpr() {
+        auto result = this->arena->New<ParseResult>();
+        auto ifExprSub = this->IfExprCases("if");
+        if (ifExprSub.second.first != nullptr && ifExprSub.second.first->err != nullptr) {
+            return result->Failure(ifExprSub.second.first->err);
+        }
+        // if (result->err != nullptr) {
+        //     return result;
+        // }
+        auto [cases, elseCase] = ifExprSub;
+        if (elseCase.first == nullptr) {
+            return result->Success(this->arena->New<IfExpressionNode>(std::move(cases), std::make_pair(nullptr, false)));
+        }
+        return result->Success(this->arena->New<IfExpressionNode>(std::move(cases), std::make_pair(elseCase.first->ast, elseCase.second)));
+    }
+
+    ParseResult *SubsciptiveAssignment() {
+        auto result = this->arena->New<ParseResult>();
+        auto valueExpr = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            return result;
+        }
+        return result->Success(valueExpr);
+    }
+
+    ParseResult *Subscription(NodeBase *target) {
+        auto result = this->arena->New<ParseResult>();
+        result->RegisterAdvance();
+        this->Advance();
+        
+        auto indexExpr = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            return result;
+        }
+
+        if (this->currentToken.type != TokenType::RSquare) {
+            return result->Failure(new SyntaxError(
+                "'[' mismatched",
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+        result->RegisterAdvance();
+        this->Advance();
+        std::map<int, std::vector<NodeBase *>> calls;
+        if (currentToken.type == TokenType::Lparen) {
+            result->RegisterAdvance();
+            this->Advance();
+            std::vector<NodeBase *> args;
+
+            if (this->currentToken.type == TokenType::Rparen) {
+                calls.insert(std::make_pair(0, args));
+                result->RegisterAdvance();
+                this->Advance();
+            } else {
+                auto arg = result->Register(this->Expr());
+                if (result->err != nullptr) {
+                    return result;
+                }
+                args.push_back(arg);
+
+                while (this->currentToken.type == TokenType::Comma) {
+                    result->RegisterAdvance();
+                    this->Advance();
+                    auto arg = result->Register(this->Expr());
+                    if (result->err != nullptr) {
+                        return result;
+                    }
+                    args.push_back(arg);
+                }
+
+                if (this->currentToken.type != TokenType::Rparen) {
+                    return result->Failure(new SyntaxError(
+                        "Mismatched ')' in function call",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                calls.insert(std::make_pair(0, args));
+                result->RegisterAdvance();
+                this->Advance();
+            }
+        }
+
+        std::vector<NodeBase *> subNodes;
+        int index = 1;
+        while (this->currentToken.type == TokenType::LSquare) {
+            result->RegisterAdvance();
+            this->Advance();
+            auto subNode = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            subNodes.push_back(subNode);
+            if (this->currentToken.type != TokenType::RSquare) {
+                return result->Failure(new SyntaxError(
+                    "'[' mismatched",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+            result->RegisterAdvance();
+            this->Advance();
+
+            if (currentToken.type == TokenType::Lparen) {
+                result->RegisterAdvance();
+                this->Advance();
+                std::vector<NodeBase *> args;
+
+                if (this->currentToken.type == TokenType::Rparen) {
+                    calls.insert(std::make_pair(index, args));
+                } else {
+                    auto arg = result->Register(this->Expr());
+                    if (result->err != nullptr) {
+                        return result;
+                    }
+                    args.push_back(arg);
+
+                    while (this->currentToken.type == TokenType::Comma) {
+                        result->RegisterAdvance();
+                        this->Advance();
+                        auto arg = result->Register(this->Expr());
+                        if (result->err != nullptr) {
+                            return result;
+                        }
+                        args.push_back(arg);
+                    }
+
+                    if (this->currentToken.type != TokenType::Rparen) {
+                        return result->Failure(new SyntaxError(
+                            "Mismatched ')' in function call",
+                            this->currentToken.st, this->currentToken.et
+                        ));
+                    }
+                    calls.insert(std::make_pair(index, args));
+                }
+                result->RegisterAdvance();
+                this->Advance();
+            }
+            index++;
+        }
+
+        // result->RegisterAdvance();
+        // this->Advance();
+
+        if (this->currentToken.type == TokenType::OP_Eq) {
+            result->RegisterAdvance();
+            this->Advance();
+            auto valueExpr = result->Register(this->SubsciptiveAssignment());
+            if (result->err != nullptr) {
+                return result;
+            }
+            auto sn = this->arena->New<SubscriptionNode>(target, indexExpr, valueExpr);
+            for (auto node : subNodes) {
+                sn->AddSubIndex(node);
+            }
+            sn->SetCalls(calls);
+            return result->Success(sn);
+        }
+        auto sn = this->arena->New<SubscriptionNode>(target, indexExpr);
+        for (auto node : subNodes) {
+            sn->AddSubIndex(node);
+        }
+        sn->SetCalls(calls);
+        return result->Success(sn);
+    }
+
+    ParseResult *Attribution(NodeBase *varAccess) {
+        auto result = this->arena->New<ParseResult>();
+        result->RegisterAdvance();
+        this->Advance();
+        if (this->currentToken.type != TokenType::Identifier) {
+            return result->Failure(new SyntaxError(
+                "Expected an identifier", 
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+        auto attr = this->currentToken;
+        result->RegisterAdvance();
+        this->Advance();
+        std::vector<Token> attrs;
+        std::map<int, NodeBase *> calls;
+
+        int attributionIndex = 0;
+        while (this->currentToken.type == TokenType::Dot || this->currentToken.type == TokenType::Lparen) {
+
+            if (this->currentToken.type == TokenType::Lparen) {
+                // The callee is the name right before '('
+                auto token = this->tokens.At(this->tokenIndex - 1);
+                result->RegisterAdvance();
+                this->Advance();
+                std::vector<NodeBase *> args;
+
+                if (this->currentToken.type == TokenType::Rparen) {
+                    result->RegisterAdvance();
+                    this->Advance();
+                } else {
+                    args.push_back(result->Register(this->Expr()));
+                    if (result->err != nullptr) {
+                        // return result->Failure(new SyntaxError(
+                        //     "Invilid function call",
+                        //     this->currentToken.st, this->currentToken.et
+                        // ));
+                        return result;
+                    }
+    
+                    while (this->currentToken.type == TokenType::Comma) {
+                        result->RegisterAdvance();
+                        this->Advance();
+                        args.push_back(result->Register(this->Expr()));
+                        if (result->err != nullptr) {
+                            return result;
+                        }
+                    }
+    
+                    if (this->currentToken.type != TokenType::Rparen) {
+                        return result->Failure(new SyntaxError(
+                            "Mismatched '(' while calling function (unfinished)",
+                            this->currentToken.st, this->currentToken.et
+                        ));
+                    }
+    
+                    result->RegisterAdvance();
+                    this->Advance();
+                }
+                calls.insert(std::make_pair(
+                    attributionIndex,
+                    this->arena->New<AttributionCallNode>(this->arena->New<FunctionCallNode>(this->arena->New<VariableAccessNode>(token), args))
+                ));
+            } else {
+                result->RegisterAdvance();
+                this->Advance();
+
+                if (this->currentToken.type == TokenType::Identifier) {
+                    attrs.push_back(this->currentToken);
+                } else {
+                    return result->Failure(new SyntaxError(
+                        "Invilid attribute access", 
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                result->RegisterAdvance();
+                this->Advance();
+                attributionIndex++;            
+            }
+        }
+
+        if (this->currentToken.type == TokenType::OP_Eq) {
+            result->RegisterAdvance();
+            this->Advance();
+            auto assExpr = result->Register(this->AttributionAssignment());
+            if (result->err != nullptr) {
+                return result;
+            } 
+            auto an = this->arena->New<AttributionNode>(varAccess, attr, assExpr);
+            an->SetCalls(calls);
+            if (attrs.size() > 0) {
+                an->SetSubAttrs(attrs);
+            }
+            return result->Success(an);
+        }
+        auto an = this->arena->New<AttributionNode>(varAccess, attr);
+        an->SetCalls(calls);
+        if (attrs.size() > 0) {
+            an->SetSubAttrs(attrs);
+        }
+        return result->Success(an);
+    }
+
+    ParseResult *AttributionAssignment() {
+        auto result = this->arena->New<ParseResult>();
+        auto valueExpr = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            return result;
+        }
+        return result->Success(valueExpr);
+    }
+
+    ParseResult *Atom() {
+        auto result = this->arena->New<ParseResult>();
+        auto token = this->currentToken;
+
+        if (Contains(NUMERIC_TOKEN_TYPES, token.type)) {
+            result->Register(this->Advance());
+            return result->Success(this->arena->New<NumberNode>(token));
+        } else if (token.type == TokenType::String) {
+            result->RegisterAdvance();
+            this->Advance();
+            return result->Success(this->arena->New<StringNode>(token));
+        } else if (token.type == TokenType::Identifier) {
+            result->Register(this->Advance());
+            std::vector<NodeBase *> varSubAccess;
+            NodeBase *prev = this->arena->New<VariableAccessNode>(token);
+            while (this->currentToken.type == TokenType::LSquare || this->currentToken.type == TokenType::Dot) {
+                if (this->currentToken.type == TokenType::LSquare) {
+                    auto subNode = result->Register(this->Subscription(prev));
+                    if (result->err != nullptr) {
+                        return result;
+                    } 
+                    prev = subNode;
+                    varSubAccess.push_back(subNode);
+                } else if (this->currentToken.type == TokenType::Dot) {
+                    auto subNode = result->Register(this->Attribution(prev));
+                    if (result->err != nullptr) {
+                        return result;
+                    }
+                    prev = subNode;
+                    varSubAccess.push_back(subNode);
+                }
+            }
+            if (varSubAccess.size() > 0) {
+                return result->Success(this->arena->New<AdvancedVarAccessNode>(varSubAccess));
+            }
+            
+            return result->Success(this->arena->New<VariableAccessNode>(token));
+        } else if (token.type == TokenType::Lparen) {
+            result->Register(this->Advance());
+            auto expr = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            if (this->currentToken.type == TokenType::Rparen) {
+                result->Register(this->Advance());
+                return result->Success(expr);
+            } else {
+                return result->Failure(new SyntaxError(
+                    "Expected ')'",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+        } else if (token.type == TokenType::LSquare) {
+            auto list = result->Register(this->List());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(list);
+        } else if (token.type == TokenType::LStart) {
+            auto dict = result->Register(this->Dictionary());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(dict);
+        } else if (token.Matches<std::string>(TokenType::Keyword, "if")) {
+            auto ifExpression = result->Register(this->IfExpr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(ifExpression);
+        } else if (token.Matches<std::string>(TokenType::Keyword, "for")) {
+            auto forExpression = result->Register(this->ForExpr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(forExpression);
+        } else if (token.Matches<std::string>(TokenType::Keyword, "while")) {
+            auto whileExpression = result->Register(this->WhileExpr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(whileExpression);
+        } else if (token.Matches<std::string>(TokenType::Keyword, "function")) {
+            auto functionDefinition = result->Register(this->FunctionDefinition());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(functionDefinition);
+        } else if (token.Matches<std::string>(TokenType::Keyword, "new")) {
+            auto newExpr = result->Register(this->NewExpr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(newExpr);
+        } else if (token.type == TokenType::__EOF__ && this->RealSize() == 1) {
+            return result->Success(this->arena->New<ListNode>(std::vector<NodeBase *>(), this->currentToken.st, this->currentToken.et));
+        }
+
+        return result->Failure(new SyntaxError(
+            "Invilid syntax", token.st, token.et
+        ));
+    }
+
+    inline unsigned RealSize() {
+        unsigned size = 0;
+        for (std::size_t i = 0; i < this->tokens.Size(); i++) {
+            size += (int) (this->tokens.TypeAt(i) != TokenType::NewLine);
+        }
+        return size;
+    }
+
+    ParseResult *NewExpr() {
+        auto result = this->arena->New<ParseResult>();
+        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "new")) {
+            return result->Failure(new SyntaxError("Expected 'new'", this->currentToken.st, this->currentToken.et));
+        }
+        result->RegisterAdvance();
+        this->Advance();
+
+        auto newExpr = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            return result;
+        }
+        return result->Success(this->arena->New<NewExprNode>(newExpr));
+    }
+
+    ParseResult *ForExpr() {
+        auto result = this->arena->New<ParseResult>();
+        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "for")) {
+            return result->Failure(new SyntaxError(
+                "Expected 'for'",
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+
+        result->RegisterAdvance();
+        this->Advance();
+
+        if (this->currentToken.type != TokenType::Identifier) {
+            return result->Failure(new SyntaxError(
+                "Expected an identifier in for-statement",
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+
+        auto loopVariable = this->currentToken;
+        result->RegisterAdvance();
+        this->Advance();
+
+        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "in")) {
+            result->RegisterAdvance();
+            this->Advance();
+
+            auto range = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                return result;
+            }
+
+            if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "then")) {
+                return result->Failure(new SyntaxError(
+                    "Expected 'then' after identifier in range-based for-loop",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+            result->RegisterAdvance();
+            this->Advance();
+
+            if (this->currentToken.type == TokenType::NewLine) {
+                result->RegisterAdvance();
+                this->Advance();
+
+                auto body = result->Register(this->Statements());
+                if (result->err != nullptr) {
+                    return result;
+                }
+
+                if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
+                    return result->Failure(new SyntaxError(
+                        "Expected 'end' after multi-line statement",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                result->RegisterAdvance();
+                this->Advance();
+
+                return result->Success(this->arena->New<ForExpressionNode>(
+                    loopVariable, range, body, true
+                ));
+            }
+
+            auto body = result->Register(this->Statement());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(this->arena->New<ForExpressionNode>(
+                loopVariable, range, body, false
+            ));
+
+        } else if (this->currentToken.type == TokenType::OP_Eq) {
+            result->RegisterAdvance();
+            this->Advance();
+
+            auto startValue = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                return result;
+            }
+
+            if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "to")) {
+                return result->Failure(new SyntaxError(
+                    "Expected 'to' after the start of the initial expression in for-statement",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+
+            result->RegisterAdvance();
+            this->Advance();
+            auto endValue = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                return result;
+            }
+
+            NodeBase *stepValue = nullptr;
+            if (this->currentToken.Matches<std::string>(TokenType::Keyword, "step")) {
+                result->RegisterAdvance();
+                this->Advance();
+
+                stepValue = result->Register(this->Expr());
+                if (result->err != nullptr) {
+                    return result;
+                }
+            }
+
+            if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "then")) {
+                return result->Failure(new SyntaxError(
+                    "Expected 'then' after the end of the initial expression or 'step' in for-statement",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+            result->RegisterAdvance();
+            this->Advance();
+
+            if (this->currentToken.type == TokenType::NewLine) {
+                result->RegisterAdvance();
+                this->Advance();
+
+                auto body = result->Register(this->Statements());
+                if (result->err != nullptr) {
+                    return result;
+                }
+
+                if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
+                    return result->Failure(new SyntaxError(
+                        "Expected 'end' after multi-line statement",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                result->RegisterAdvance();
+                this->Advance();
+
+                return result->Success(this->arena->New<ForExpressionNode>(
+                    loopVariable, startValue, endValue, stepValue, body, true
+                ));
+            }
+
+            auto body = result->Register(this->Statement());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(this->arena->New<ForExpressionNode>(
+                loopVariable, startValue, endValue, stepValue, body, false
+            ));
+        } else {
+            return result->Failure(new SyntaxError(
+                "Expected '=' (initialization for loop var) or 'in' (range-based loop) in for-stmt",
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+    }
+
+    ParseResult *WhileExpr() {
+        auto result = this->arena->New<ParseResult>();
+
+        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "while")) {
+            return result->Failure(new SyntaxError(
+                "Expected 'while'",
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+
+        result->RegisterAdvance();
+        this->Advance();
+        auto condition = result->Register(this->Expr());
+        if (result->err != nullptr) {
+            return result;
+        }
+
+        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "then")) {
+            return result->Failure(new SyntaxError(
+                "Expected 'then' after condition expression of while-statement",
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+
+        result->RegisterAdvance();
+        this->Advance();
+
+         if (this->currentToken.type == TokenType::NewLine) {
+            result->RegisterAdvance();
+            this->Advance();
+
+            auto body = result->Register(this->Statements());
+            if (result->err != nullptr) {
+                return result;
+            }
+
+            if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
+                return result->Failure(new SyntaxError(
+                    "Expected 'end' after multi-line statement",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+            result->RegisterAdvance();
+            this->Advance();
+
+            return result->Success(this->arena->New<WhileExpressionNode>(condition, body, true));
+         }
+
+        auto body = result->Register(this->Statement());
+        if (result->err != nullptr) {
+            return result;
+        }
+        return result->Success(this->arena->New<WhileExpressionNode>(condition, body, false));
+    }
+
+    ParseResult *Expr() {
+        auto result = this->arena->New<ParseResult>();
+        if (this->currentToken.Matches<std::string>(TokenType::Keyword, "var")) {
+            result->Register(this->Advance());
+            if (this->currentToken.type != TokenType::Identifier) {
+                return result->Failure(new SyntaxError(
+                    "Expected an identifier",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+
+            auto variableName = this->currentToken;
+            result->Register(this->Advance());
+
+            if (this->currentToken.type != TokenType::OP_Eq) {
+                return result->Failure(new SyntaxError(
+                    "Expected '='",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+
+            result->Register(this->Advance());
+            auto expResult = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            return result->Success(this->arena->New<VariableAssignNode>(variableName, expResult));
+        }
+
+        auto node = this->Operation(result, BP_None);
+        if (result->err != nullptr) {
+            return result;
+        }
+        return result->Success(node);
+    }
+
+    // How tightly an infix operator binds its operands, higher binds tighter
+    enum BindingPower : int {
+        BP_None = 0,
+        BP_Logic = 10,      // and, or, not
+        BP_Compare = 20,    // ==, !=, <, >, <=, >=
+        BP_Sum = 30,        // +, -
+        BP_Product = 40,    // *, /
+        BP_Power = 50       // ^ (right associative)
+    };
+
+    static BindingPower InfixBindingPower(const Token &tk) {
+        switch (tk.type) {
+            case TokenType::OP_Plus: case TokenType::OP_Minus:
+                return BP_Sum;
+            case TokenType::OP_Mul: case TokenType::OP_Div:
+                return BP_Product;
+            case TokenType::OP_Pow:
+                return BP_Power;
+            case TokenType::OP_Equal: case TokenType::OP_Nequal: case TokenType::OP_Lt:
+            case TokenType::OP_Gt: case TokenType::OP_Lte: case TokenType::OP_Gte:
+                return BP_Compare;
+            case TokenType::Keyword: {
+                auto &kw = *(std::string *) tk.value;
+                return kw == "and" || kw == "or" || kw == "not" ? BP_Logic : BP_None;
+            }
+            default:
+                return BP_None;
+        }
+    }
+
+    // Precedence climbing over unary / binary operators, every operator with a binding power above `minBp`
+    // is folded into the returned node. The whole expression shares one `ParseResult` and never rewinds
+    NodeBase *Operation(ParseResult *result, int minBp) {
+        auto token = this->currentToken;
+        NodeBase *left;
+
+        if (token.type == TokenType::OP_Plus || token.type == TokenType::OP_Minus) {
+            // Unary sign binds looser than '^': -a ^ b => -(a ^ b)
+            result->Register(this->Advance());
+            auto operand = this->Operation(result, BP_Power - 1);
+            if (result->err != nullptr) {
+                return nullptr;
+            }
+            left = this->arena->New<UnaryOperationNode>(token, operand);
+        } else if (minBp < BP_Compare && token.Matches<std::string>(TokenType::Keyword, "not")) {
+            // 'not' negates a whole comparison, but is not accepted as an operand of one
+            result->RegisterAdvance();
+            this->Advance();
+            auto operand = this->Operation(result, BP_Logic);
+            if (result->err != nullptr) {
+                return nullptr;
+            }
+            left = this->arena->New<UnaryOperationNode>(token, operand);
+        } else {
+            left = this->Postfix(result);
+            if (result->err != nullptr) {
+                return nullptr;
+            }
+        }
+
+        while (true) {
+            auto bp = InfixBindingPower(this->currentToken);
+            if (bp <= minBp) {
+                break;
+            }
+            auto operationToken = this->currentToken;
+            result->Register(this->Advance());
+            auto rightNode = this->Operation(result, bp == BP_Power ? bp - 1 : bp);
+            if (result->err != nullptr) {
+                return nullptr;
+            }
+            left = this->arena->New<BinaryOperationNode>(left, operationToken, rightNode);
+        }
+        return left;
+    }
+
+    ParseResult *FunctionDefinition() {
+        auto result = this->arena->New<ParseResult>();
+        // deprecated:  this->insideAFunction = true;
+        this->functionLayers++;
+        this->closureNodes.insert(std::make_pair(this->functionLayers, std::vector<NonlocalStatementNode *>()));
+        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "function")) {
+            return result->Failure(new SyntaxError(
+                "Expected 'function'", this->currentToken.st, this->currentToken.et
+            ));
+        }
+
+        result->RegisterAdvance();
+        this->Advance();
+        Token funcNameToken;
+        if (this->currentToken.type == TokenType::Identifier) {
+            funcNameToken = this->currentToken;
+            result->RegisterAdvance();
+            this->Advance();
+
+            if (this->currentToken.type != TokenType::Lparen) {
+                return result->Failure(new SyntaxError(
+                    "Expected '(' after function name",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+        } else {
+            funcNameToken = Token(TokenType::Invilid);
+             if (this->currentToken.type != TokenType::Lparen) {
+                return result->Failure(new SyntaxError(
+                    "Expected an identifier or '(' after 'function'",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+        }
+
+        result->RegisterAdvance();
+        this->Advance();
+        Tokens args;
+
+        if (this->currentToken.type == TokenType::Identifier) {
+            args.push_back(this->currentToken);
+            result->RegisterAdvance();
+            this->Advance();
+
+            while (this->currentToken.type == TokenType::Comma) {
+                result->RegisterAdvance();
+                this->Advance();
+
+                if (this->currentToken.type != TokenType::Identifier) {
+                    return result->Failure(new SyntaxError(
+                        "Expected an identifier after ',' in parameter list",
+                        this->currentToken.st, this->currentToken.et
+                    ));
+                }
+                args.push_back(this->currentToken);
+                result->RegisterAdvance();
+                this->Advance();
+            }
+
+            if (this->currentToken.type != TokenType::Rparen) {
+                return result->Failure(new SyntaxError(
+                    "Mismatched '(' found in the end of the parameter list (unfinished)",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+        } else {
+            if (this->currentToken.type != TokenType::Rparen) {
+                return result->Failure(new SyntaxError(
+                    "Expected ')'",
+                    this->currentToken.st, this->currentToken.et
+                ));
+            }
+        }
+        
+        result->RegisterAdvance();
+        this->Advance();
+        if (this->currentToken.type == TokenType::Arrow) {
+            result->RegisterAdvance();
+            this->Advance();
+    
+            auto bodyNode = result->Register(this->Expr());
+            if (result->err != nullptr) {
+                return result;
+            }
+            auto fd = this->arena->New<FunctionDefinitionNode>(funcNameToken, args, bodyNode, true, this->unit);
+            this->functionLayers--;
+            return result->Success(fd);
+        }
+
+        if (this->currentToken.type != TokenType::NewLine) {
+            return result->Failure(new SyntaxError(
+                    "Expected '->' or new-lines after parameter list in function definition",
+                    this->currentToken.st, this->currentToken.et
+            ));
+        }
+
+        result->RegisterAdvance();
+        this->Advance();
+
+        auto body = result->Register(this->Statements());
+        if (result->err != nullptr) {
+            return result;
+        }
+
+        if (!this->currentToken.Matches<std::string>(TokenType::Keyword, "end")) {
+            return result->Failure(new SyntaxError(
+                "Expected 'end' after multi-line statement",
+                this->currentToken.st, this->currentToken.et
+            ));
+        }
+        result->RegisterAdvance();
+        this->Advance();
+
+        assert(functionLayers > 0);
+        auto fsd = this->arena->New<FunctionDefinitionNode>(funcNameToken, args, body, false, this->unit);
+        
+        if (this->functionLayers == this->closureNodes.size()) {
+            fsd->SetClosure(this->closureNodes[this->functionLayers]);
+            fsd->SetCell({});
+        } else if (this->functionLayers == 1) {
+            if (closureNodes.find(2) != closureNodes.end()) {
+                fsd->SetCell(this->closureNodes[2]);
+            } else {
+                fsd->SetCell({});
+            }
+            fsd->SetClosure({});
+        } else {
+            fsd->SetClosure(this->closureNodes[this->functionLayers]);
+            fsd->SetCell(this->closureNodes[this->functionLayers + 1]);
+        }
+
+        this->functionLayers--;
+        return result->Success(fsd);
+    }
+
+    ParseResult *Parse() {
+        auto result = this->Statements();
+        if (result->err == nullptr && this->currentToken.type != TokenType::__EOF__) {
+            return result->Failure(new SyntaxError("Unexpected end of input", this->currentToken.st, this->currentToken.et));
+        }
+        return result;
+    }
+
+private:
+    Token currentToken;
+    TokenBuffer &tokens;
+    Arena *arena;
+    CompilationUnit *unit;
+    int tokenIndex;
+    bool insideAFunction; // deprecated
+    int functionLayers;
+    int clousureLayer;
+    std::map<int, std::vector<NonlocalStatementNode *>> closureNodes;
+};
+
+// Binds the variables of every function body to slots of its frame. Only a function's own locals are resolved:
+// frames chain to the caller's symbols, so any other name is still looked up by name when it is accessed
+class Resolver final {
+public:
+    explicit Resolver(Arena *arena) : arena(arena), layout(nullptr) {}
+
+    void Resolve(NodeBase *node) {
+        if (node == nullptr) {
+            return;
+        }
+        switch (node->nodeType) {
+            case NodeType::Expression:
+                this->Resolve(node->left);
+                this->Resolve(node->right);
+                break;
+            case NodeType::SingleExpression:
+                this->Resolve(NodeCast<UnaryOperationNode>(node)->node);
+                break;
+            case NodeType::VarAccess: {
+                auto nd = NodeCast<VariableAccessNode>(node);
+                if (this->layout != nullptr) {
+                    nd->layout = this->layout;
+                    nd->slot = this->layout->IndexOf(*(std::string *) nd->variableNameToken.value);
+                }
+                break;
+            }
+            case NodeType::VarAssign: {
+                auto nd = NodeCast<VariableAssignNode>(node);
+                this->Resolve(nd->valueNode);
+                if (this->layout != nullptr) {
+                    nd->layout = this->layout;
+                    nd->slot = this->layout->IndexOf(*(std::string *) nd->variableNameToken.value);
+                }
+                break;
+            }
+            case NodeType::IfExpression: {
+                auto nd = NodeCast<IfExpressionNode>(node);
+                for (auto &[c, _] : nd->cases) {
+                    this->Resolve(c.first);
+                    this->Resolve(c.second);
+                }
+                this->Resolve(nd->elseCase.first);
+                break;
+            }
+            case NodeType::ForExpression: {
+                auto nd = NodeCast<ForExpressionNode>(node);
+                if (nd->rangeBasedLoop) {
+                    this->Resolve(nd->range);
+                } else {
+                    this->Resolve(nd->stvNode);
+                    this->Resolve(nd->etvNode);
+                    this->Resolve(nd->stepvNode);
+                }
+                this->Resolve(nd->body);
+                break;
+            }
+            case NodeType::WhileExpression: {
+                auto nd = NodeCast<WhileExpressionNode>(node);
+                this->Resolve(nd->conditionNode);
+                this->Resolve(nd->body);
+                break;
+            }
+            case NodeType::FunctionDefinition:
+                this->ResolveFunction(NodeCast<FunctionDefinitionNode>(node));
+                break;
+            case NodeType::FunctionCall: {
+                auto nd = NodeCast<FunctionCallNode>(node);
+                this->Resolve(nd->target);
+                for (auto arg : nd->arguments) {
+                    this->Resolve(arg);
+                }
+                break;
+            }
+            case NodeType::List: {
+                auto nd = NodeCast<ListNode>(node);
+                for (auto element : nd->elements) {
+                    this->Resolve(element);
+                }
+                this->Resolve(nd->subscripting);
+                this->Resolve(nd->newVal);
+                break;
+            }
+            case NodeType::Return:
+                this->Resolve(NodeCast<ReturnStatementNode>(node)->nodeToReturn);
+                break;
+            case NodeType::Subscription: {
+                auto nd = NodeCast<SubscriptionNode>(node);
+                this->Resolve(nd->target);
+                this->Resolve(nd->index);
+                for (auto sub : nd->subIndexes) {
+                    this->Resolve(sub);
+                }
+                for (auto &[_, args] : nd->calls) {
+                    for (auto arg : args) {
+                        this->Resolve(arg);
+                    }
+                }
+                this->Resolve(nd->assignment);
+                break;
+            }
+            case NodeType::Dictionary:
+                for (auto &[k, v] : NodeCast<DictionaryNode>(node)->elements) {
+                    this->Resolve(k);
+                    this->Resolve(v);
+                }
+                break;
+            case NodeType::Attribution: {
+                auto nd = NodeCast<AttributionNode>(node);
+                this->Resolve(nd->target);
+                for (auto &[_, call] : nd->calls) {
+                    this->Resolve(call);
+                }
+                this->Resolve(nd->assignment);
+                break;
+            }
+            case NodeType::AdvancedVarAccess:
+                for (auto access : NodeCast<AdvancedVarAccessNode>(node)->advancedAccess) {
+                    this->Resolve(access);
+                }
+                break;
+            case NodeType::NewExpression:
+                this->Resolve(NodeCast<NewExprNode>(node)->newExpr);
+                break;
+            case NodeType::AttributionCall:
+                this->Resolve(NodeCast<AttributionCallNode>(node)->call);
+                break;
+            case NodeType::SubscriptionCall:
+                for (auto arg : NodeCast<SubscriptionCallNode>(node)->arguments) {
+                    this->Resolve(arg);
+                }
+                break;
+            case NodeType::Defer:
+                this->Resolve(NodeCast<DeferNode>(node)->deferExpr);
+                break;
+            default:
+                break;
+        }
+    }
+
+private:
+    Arena *arena;
+    FrameLayout *layout;
+
+    void ResolveFunction(FunctionDefinitionNode *nd) {
+        auto enclosing = this->layout;
+        if (enclosing != nullptr && nd->fun.type != TokenType::Invilid) {
+            enclosing->Add(*(std::string *) nd->fun.value);
+        }
+
+        this->layout = nd->layout = this->arena->New<FrameLayout>();
+        for (auto &param : nd->parameters) {
+            auto &name = *(std::string *) param.value;
+            this->layout->Add(name);
+            if (name.size() > 2 && name.starts_with("_") && name.ends_with("_") && !name.starts_with("__") && !name.ends_with("__")) {
+                // Mutable argument, bound as `x` and `$x` inside the body
+                auto stripped = name.substr(1, name.size() - 2);
+                this->layout->Add(stripped);
+                this->layout->Add("$" + stripped);
+            }
+        }
+        this->Declare(nd->body);
+        this->Resolve(nd->body);
+        this->layout = enclosing;
+    }
+
+    // Collects the names the body assigns in its own frame, nested function bodies have their own layouts
+    void Declare(NodeBase *node) {
+        if (node == nullptr) {
+            return;
+        }
+        switch (node->nodeType) {
+            case NodeType::Expression:
+                this->Declare(node->left);
+                this->Declare(node->right);
+                break;
+            case NodeType::SingleExpression:
+                this->Declare(NodeCast<UnaryOperationNode>(node)->node);
+                break;
+            case NodeType::VarAssign: {
+                auto nd = NodeCast<VariableAssignNode>(node);
+                this->layout->Add(*(std::string *) nd->variableNameToken.value);
+                this->Declare(nd->valueNode);
+                break;
+            }
+            case NodeType::IfExpression: {
+                auto nd = NodeCast<IfExpressionNode>(node);
+                for (auto &[c, _] : nd->cases) {
+                    this->Declare(c.first);
+                    this->Declare(c.second);
+                }
+                this->Declare(nd->elseCase.first);
+                break;
+            }
+            case NodeType::ForExpression: {
+                auto nd = NodeCast<ForExpressionNode>(node);
+                this->layout->Add(*(std::string *) nd->var.value);
+                if (nd->rangeBasedLoop) {
+                    this->Declare(nd->range);
+                } else {
+                    this->Declare(nd->stvNode);
+                    this->Declare(nd->etvNode);
+                    this->Declare(nd->stepvNode);
+                }
+                this->Declare(nd->body);
+                break;
+            }
+            case NodeType::WhileExpression: {
+                auto nd = NodeCast<WhileExpressionNode>(node);
+                this->Declare(nd->conditionNode);
+                this->Declare(nd->body);
+                break;
+            }
+            case NodeType::FunctionDefinition: {
+                auto nd = NodeCast<FunctionDefinitionNode>(node);
+                if (nd->fun.type != TokenType::Invilid) {
+                    this->layout->Add(*(std::string *) nd->fun.value);
+                }
+                break;
+            }
+            case NodeType::FunctionCall: {
+                auto nd = NodeCast<FunctionCallNode>(node);
+                this->Declare(nd->target);
+                for (auto arg : nd->arguments) {
+                    this->Declare(arg);
+                }
+                break;
+            }
+            case NodeType::List: {
+                auto nd = NodeCast<ListNode>(node);
+                for (auto element : nd->elements) {
+                    this->Declare(element);
+                }
+                this->Declare(nd->subscripting);
+                this->Declare(nd->newVal);
+                break;
+            }
+            case NodeType::Return:
+                this->Declare(NodeCast<ReturnStatementNode>(node)->nodeToReturn);
+                break;
+            case NodeType::NonlocalStatement:
+                this->layout->Add(*(std::string *) NodeCast<NonlocalStatementNode>(node)->freeVar.value);
+                break;
+            case NodeType::StructDefStmt:
+                this->layout->Add(*(std::string *) NodeCast<StructDefStmtNode>(node)->structName.value);
+                break;
+            default:
+                break;
+        }
+    }
+};
+
+struct Chunk;
+
+// Everything produced by compiling one source text (a script, a module, an eval string or a REPL line).
+// Nodes and parse results live in the unit's arena and are released together with it; functions defined
+// inside the unit retain it so their bodies stay valid after the unit itself is released by its creator
+struct CompilationUnit final {
+    std::string name;
+    TokenBuffer *tokens;
+    Arena arena;
+    NodeBase *ast;
+    unsigned refCount;
+    // Bytecode of the script and of its function bodies, compiled on first run by the VM engine (also arena-owned)
+    std::unordered_map<NodeBase *, Chunk *> chunks;
+
+    explicit CompilationUnit(const std::string &name) : name(name), tokens(nullptr), ast(nullptr), refCount(1) {}
+    CompilationUnit(const CompilationUnit &) = delete;
+    CompilationUnit &operator=(const CompilationUnit &) = delete;
+
+    ~CompilationUnit() {
+        delete this->tokens;
+    }
+
+    inline void Retain() {
+        this->refCount++;
+    }
+
+    inline void Release() {
+        if (--this->refCount == 0) {
+            delete this;
+        }
+    }
+
+    // Lexes and parses `code`, the returned unit holds one reference owned by the caller.
+    // On failure the unit is already released and only the error is returned
+    static std::pair<CompilationUnit *, Error *> Compile(const std::string &filename, const std::string &code) {
+        auto unit = new CompilationUnit(filename);
+        Lexer lexer(filename, code);
+        auto [tokens, err] = lexer.MakeTokens();
+        if (err != nullptr) {
+            unit->Release();
+            return std::make_pair(nullptr, err);
+        }
+        unit->tokens = tokens;
+        Parser parser(unit);
+        auto parseResult = parser.Parse();
+        if (parseResult->err != nullptr) {
+            auto parseError = parseResult->err;
+            unit->Release();
+            return std::make_pair(nullptr, parseError);
+        }
+        unit->ast = parseResult->ast;
+        Resolver(&unit->arena).Resolve(unit->ast);
+        return std::make_pair(unit, nullptr);
+    }
+};
+
+inline Parser::Parser(CompilationUnit *unit) : Parser(*unit->tokens, &unit->arena, unit) {}
+
+
+enum class NumberType { Int, Float };
+struct Object;
+
+// Outcome of evaluating a node or calling a function: a value, an error or a control-flow signal.
+// Passed around by value, the evaluator does not allocate anything to report a result
+struct RuntimeResult final {
+    Object *value;
+    Error *error;
+    Object *funcReturnValue;
+    // for loops
+    bool shouldContinue;
+    bool shouldBreak;
+    std::string_view extraInfo;
+    Error *cause;
+
+    void Reset() {
+        this->value = nullptr;
+        this->error = nullptr;
+        this->shouldContinue = false;
+        this->shouldBreak = false;
+        this->funcReturnValue = nullptr;
+        this->cause = nullptr;
+    }
+
+    RuntimeResult() {
+        this->Reset();
+    }
+
+    Object *Register(const RuntimeResult &res) {
+        // if (res.error != nullptr) {
+            this->error = res.error;
+        // }
+        this->funcReturnValue = res.funcReturnValue;
+        this->shouldContinue = res.shouldContinue;
+        this->shouldBreak = res.shouldBreak;
+        this->cause = res.cause;
+        this->extraInfo = res.extraInfo;
+        return res.value;
+    }
+
+    void SetCause(Error *err) {
+        if (err != nullptr) {
+            this->cause = err;
+        }
+    }
+
+    void ClearCause() {
+        this->cause = nullptr;
+    }
+
+    RuntimeResult &Success(Object *value) {
+        this->Reset();
+        this->value = value;
+        return *this;
+    }
+
+    RuntimeResult &SuccessReturn(Object *value) {
+        this->Reset();
+        this->funcReturnValue = value;
+        return *this;
+    }
+
+    RuntimeResult &SuccessContinue() {
+        this->Reset();
+        this->shouldContinue = true;
+        return *this;
+    }
+
+    RuntimeResult &SuccessBreak() {
+        this->Reset();
+        this->shouldBreak = true;
+        return *this;
+    }
+
+    RuntimeResult &Failure(Error *err, Error *cause = nullptr) {
+        this->Reset();
+        this->error = err;
+        this->SetCause(cause);
+        return *this; 
+    }
+
+    RuntimeResult &Failure(Error *err, Error *cause, std::string_view extra) {
+        this->Reset();
+        this->error = err;
+        this->extraInfo = extra;
+        this->SetCause(cause);
+        return *this; 
+    }
+
+    bool ShouldReturn() const {
+        return this->error != nullptr || this->shouldBreak || this->shouldContinue || this->funcReturnValue != nullptr;
+    }
+};
+
+
+// Runtime type of an object, all type checks compare tags; `typeName` is only used for display
+enum class TypeTag : std::uint8_t {
+    Object, Number, String, List, Dictionary, ClassObject, BigInt,
+    FunctionBase, Function, Method, BuiltinFunction, BuiltinMethod
+};
+
+constexpr const char *TypeTagName(TypeTag tag) {
+    switch (tag) {
+        case TypeTag::Number: return "Number";
+        case TypeTag::String: return "String";
+        case TypeTag::List: return "List";
+        case TypeTag::Dictionary: return "Dictionary";
+        case TypeTag::ClassObject: return "ClassObject";
+        case TypeTag::BigInt: return "BigInt";
+        case TypeTag::FunctionBase: return "FunctionBase";
+        case TypeTag::Function: return "Function";
+        case TypeTag::Method: return "Method";
+        case TypeTag::BuiltinFunction: return "BuiltinFunction";
+        case TypeTag::BuiltinMethod: return "BuiltinMethod";
+        default: return "Object";
+    }
+}
+
+// Where a callee is called from: the calling context and the position of the callee expression. Callees are shared
+// with the variables they are read from, so they are told where they run instead of being positioned there
+struct CallSite {
+    Context *ctx;
+    Position *st;
+    Position *et;
+    // Argument expressions of a call written in the source, null for calls made by the runtime
+    const std::vector<NodeBase *> *arguments;
+
+    CallSite(Context *ctx, Position *st, Position *et, const std::vector<NodeBase *> *arguments = nullptr) :
+        ctx(ctx), st(st), et(et), arguments(arguments) {}
+};
+
+struct Object {
+    TypeTag tag;
+    const char *typeName;
+    Context *ctx;
+    PositionRef startPos;
+    PositionRef endPos;
+
+    explicit Object(TypeTag tag) : tag(tag), typeName(TypeTagName(tag)), ctx(nullptr) {}
+    explicit Object() : Object(TypeTag::Object) {}
+
+    // Dictionaries become class objects once built, `BigInt` retags the class object it derives from
+    void SetTypeTag(TypeTag tag) {
+        this->tag = tag;
+        this->typeName = TypeTagName(tag);
+    }
+
+    virtual inline std::string ToString() {
+        return std::format("<object {} at {}>", this->typeName, static_cast<void *>(this));
+    }
+
+    virtual Object *SetContext(Context *ctx = nullptr) {
+        this->ctx = ctx;
+        if (ctx && ctx->exFrame) {
+            this->ctx->exFrame = ctx->exFrame;
+        }
+        return this;
+    }
+
+    virtual Object *Copy() {
+        // Object *o = new Object;
+        // *o = *this;
+        // return o;
+        assert(false);
+        return nullptr;
+    }
+
+    virtual Object *SetPos(Position *st = nullptr, Position *et = nullptr) {
+        this->startPos = st;
+        this->endPos = et;
+        return this;
+    }
+
+    virtual ~Object() = default;
+
+    virtual bool AsBool() {
+        return true;
+    }
+
+    virtual std::pair<Object *, Error *> AddTo(Object *other) {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "+"));
+    }
+
+    virtual std::pair<Object *, Error *> SubstractedBy(Object *other) {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "-"));
+    }
+    
+    virtual std::pair<Object *, Error *> PoweredBy(Object *other)  {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "^"));
+    }
+
+    virtual std::pair<Object *, Error *> MultipliedBy(Object *other)  {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "*"));
+    }
+
+    virtual std::pair<Object *, Error *> DividedBy(Object *other)  {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "/"));
+    }
+
+    virtual std::pair<Object *, Error *> GetCompEquals(Object *other);
+    virtual std::pair<Object *, Error *> GetCompNequals(Object *other);
+    
+    virtual std::pair<Object *, Error *> GetCompLt(Object *other) {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "<"));   
+    }
+
+    virtual std::pair<Object *, Error *> GetCompGt(Object *other) {
+        return std::make_pair(nullptr, this->IllegalOperation(other, ">"));   
+    }
+
+    virtual std::pair<Object *, Error *> GetCompLte(Object *other) {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "<="));    
+    }
+
+    virtual std::pair<Object *, Error *> GetCompGte(Object *other) {
+        return std::make_pair(nullptr, this->IllegalOperation(other, ">="));   
+    }
+
+    virtual std::pair<Object *, Error *> And(Object *other) {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "and"));      
+    }
+
+    virtual std::pair<Object *, Error *> Or(Object *other) {
+        return std::make_pair(nullptr, this->IllegalOperation(other, "or"));     
+    }
+
+    virtual std::pair<Object *, Error *> Not(Object *other) {
+         return std::make_pair(nullptr, this->IllegalOperation(nullptr, "not"));
+    }
+
+    virtual std::pair<Object *, Error *> Subsciption(Object *other) {
+        return std::make_pair(nullptr, new TypeError(
+            std::format("'{}' object is not subscriptable", this->typeName),
+            this->startPos, this->endPos, this->ctx
+        ));
+    }
+
+    virtual std::pair<Object *, Error *> SubsciptionAssignment(Object *other, Object *value) {
+        return std::make_pair(nullptr, new TypeError(
+            std::format("'{}' object cannot be assigned through subscription", this->typeName),
+            this->startPos, this->endPos, this->ctx
+        ));
+    }
+
+    virtual std::pair<Object *, Error *> Len() {
+        return std::make_pair(nullptr, new TypeError(
+            std::format("Cannot perform 'len' on object '{}'", this->typeName),
+            this->startPos, this->endPos, this->ctx
+        ));
+    }
+
+    virtual std::pair<Object *, Error *> GetAttr(const std::string &attr) {
+         return std::make_pair(nullptr, new TypeError(
+            std::format("'{}' has no user-defined attribute", this->typeName),
+            this->startPos, this->endPos, this->ctx
+        ));
+    }
+
+    virtual std::pair<Object *, Error *> SetAttr(const std::string &attr, Object *newVal) {
+        return std::make_pair(nullptr, new TypeError(
+            std::format("'{}' object has no user-defined attribute", this->typeName),
+            this->startPos, this->endPos, this->ctx
+        ));
+    }
+
+    virtual std::pair<Object *, Error *> Iter() {
+        return std::make_pair(nullptr, new TypeError(
+            std::format("'{}' object is not iterable", this->typeName),
+            this->startPos, this->endPos, this->ctx
+        ));
+    }
+
+    virtual std::pair<Object *, Error *> Next() {
+        return std::make_pair(nullptr, new TypeError(
+            std::format("'{}' object is not a iterator", this->typeName),
+            this->startPos, this->endPos, this->ctx
+        ));
+    }
+
+    virtual RuntimeResult Execute(std::vector<Object *> args, const CallSite &site) {
+        RuntimeResult result;
+        return result.Failure(new TypeError(
+            std::format("'{}' object is not callable", this->typeName),
+            site.st, site.et, site.ctx
+        ));
+    }
+
+    // Site of a call made on the object where it stands, for callees which are not read from a variable
+    CallSite Site() {
+        return CallSite { this->ctx, this->startPos, this->endPos };
+    }
+
+    virtual Error *IllegalOperation(Object *other, const std::string &operationId) {
+        Object *o = other == nullptr ? this : other;
+        return new TypeError(
+            std::format("Invilid operation '{}' between '{}' and '{}'", operationId, this->typeName, o->typeName),
+            this->startPos, this->endPos, this->ctx
+        );
+    }
+};
+
+template<typename T>
+T *As(Object *o) {
+    return dynamic_cast<T *>(o);
+}
+
+// Lists, dictionaries and class objects can be changed in place, every other value is immutable and
+// may be shared between variables, arguments and return values instead of being copied
+inline bool IsMutableValue(Object *o) {
+    return o->tag == TypeTag::List || o->tag == TypeTag::Dictionary || o->tag == TypeTag::ClassObject;
+}
+
+struct Number : public Object {
+    std::variant<int, double> value;
+    // union {
+    //     int value;
+    //     double value;
+    // };
+    NumberType ntype;
+    static Number *null;
+
+    // Small ints (the booleans 0 and 1 included) are shared by `Shared`
+    static constexpr int SharedMin = -128;
+    static constexpr int SharedMax = 1024;
+    static Number *Shared(const std::variant<int, double> &v);
+
+    
+    explicit Number(int v) : ntype(NumberType::Int), value(v), Object(TypeTag::Number) {
+        this->SetPos();
+    }
+    explicit Number(double v) : ntype(NumberType::Float), value(v), Object(TypeTag::Number) {
+        this->SetPos();
+    }
+
+    explicit Number(std::variant<int, double> v) : value(v), Object(TypeTag::Number) {
+        this->SetPos();
+        if (std::holds_alternative<int>(v)) {
+            this->ntype = NumberType::Int;
+        } else {
+            this->ntype = NumberType::Float;
+        }
+    }
+
+    explicit Number() : ntype(NumberType::Float), value(0), Object(TypeTag::Number) {}
+
+    Number *SetContext(Context *ctx = nullptr) override {
+        Object::SetContext(ctx);
+        return this;
+    } 
+
+    Number *SetPos(Position *st = nullptr, Position *et = nullptr) override {
+        Object::SetPos(st, et);
+        return this;
+    }
+
+    Number *Copy() override {
+        return (new Number(this->value))->SetPos(this->startPos, this->endPos)->SetContext(this->ctx);
+    }
+
+    // template<typename T>
+    // static bool IsSameVariant(const std::variant<int, double> &a, const std::variant<int, double> &b) {
+    //     return std::holds_alternative<T>(a) && std::holds_alternative<T>(b);
+    // }
+
+    std::pair<Object *, Error *> AddTo(Object *other) override {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '+' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Add, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "+"));
+    }
+
+    std::pair<Object *, Error *> SubstractedBy(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '-' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Subtract, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "-"));
+    }
+
+    std::pair<Object *, Error *> PoweredBy(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '^' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Power, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "^"));
+    }
+
+    std::pair<Object *, Error *> GetCompEquals(Object *other) override {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '==' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Equal, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "=="));
+    }
+
+    std::pair<Object *, Error *> GetCompNequals(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '!=' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::NotEqual, ob->value, ob->startPos, ob->endPos);
+        }
+       return std::make_pair(nullptr, Object::IllegalOperation(other, "!="));
+    }
+
+    std::pair<Object *, Error *> GetCompLt(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '<' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Less, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "<"));
+    }
+
+    std::pair<Object *, Error *> GetCompGt(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '>' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Greater, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, ">"));
+    }
+
+    std::pair<Object *, Error *> GetCompLte(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '<=' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::LessEqual, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "<="));
+    }
+    
+    std::pair<Object *, Error *> GetCompGte(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '>=' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::GreaterEqual, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, ">="));
+    }
+
+    // Applies an arithmetic, comparison or logical operator to two number payloads (`lhs` is the receiver)
+    // without allocating, returns false for a division by zero. Shared by `Number` and the VM's inline numbers
+    static bool Compute(OperatorKind op, const std::variant<int, double> &lhs, const std::variant<int, double> &rhs, std::variant<int, double> &out) {
+        if (std::holds_alternative<int>(lhs) && std::holds_alternative<int>(rhs)) {
+            int a = std::get<int>(lhs), b = std::get<int>(rhs);
+            switch (op) {
+                case OperatorKind::Add: out = a + b; return true;
+                case OperatorKind::Subtract: out = a - b; return true;
+                case OperatorKind::Multiply: out = a * b; return true;
+                case OperatorKind::Divide:
+                    if (b == 0) {
+                        return false;
+                    }
+                    out = a / b;
+                    return true;
+                case OperatorKind::Power: out = (double) pow(a, b); return true;
+                case OperatorKind::Equal: out = (int) (a == b); return true;
+                case OperatorKind::NotEqual: out = (int) (a != b); return true;
+                case OperatorKind::Less: out = (int) (a < b); return true;
+                case OperatorKind::Greater: out = (int) (a > b); return true;
+                case OperatorKind::LessEqual: out = (int) (a <= b); return true;
+                case OperatorKind::GreaterEqual: out = (int) (a >= b); return true;
+                case OperatorKind::And: out = (int) ((bool) a && (bool) b); return true;
+                case OperatorKind::Or: out = (int) ((bool) a || (bool) b); return true;
+                default: assert(false);
+            }
+        }
+        double a = std::holds_alternative<int>(lhs) ? std::get<int>(lhs) : std::get<double>(lhs);
+        double b = std::holds_alternative<int>(rhs) ? std::get<int>(rhs) : std::get<double>(rhs);
+        switch (op) {
+            case OperatorKind::Add: out = a + b; return true;
+            case OperatorKind::Subtract: out = a - b; return true;
+            case OperatorKind::Multiply: out = a * b; return true;
+            case OperatorKind::Divide:
+                if (b == 0) {
+                    return false;
+                }
+                out = a / b;
+                return true;
+            case OperatorKind::Power: out = pow(a, b); return true;
+            case OperatorKind::Equal: out = (int) (a == b); return true;
+            case OperatorKind::NotEqual: out = (int) (a != b); return true;
+            case OperatorKind::Less: out = (int) (a < b); return true;
+            case OperatorKind::Greater: out = (int) (a > b); return true;
+            // As before, '<=' and '>=' with a floating point operand compare the operands in reverse order
+            case OperatorKind::LessEqual: out = (int) (a >= b); return true;
+            case OperatorKind::GreaterEqual: out = (int) (a <= b); return true;
+            case OperatorKind::And: out = (int) ((bool) a && (bool) b); return true;
+            case OperatorKind::Or: out = (int) ((bool) a || (bool) b); return true;
+            default: assert(false);
+        }
+        return false;
+    }
+
+    std::pair<Number *, Error *> Operate(OperatorKind op, const std::variant<int, double> &other, Position *ost, Position *oet) {
+        std::variant<int, double> result;
+        if (!Number::Compute(op, this->value, other, result)) {
+            return std::make_pair(nullptr, new RuntimeError("Division by zero", ost, oet, this->ctx));
+        }
+        return std::make_pair((new Number(result))->SetContext(this->ctx), nullptr);
+    }
+
+    std::pair<Object *, Error *> And(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Logical operation 'and' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::And, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "and"));        
+    } 
+
+
+    std::pair<Object *, Error *> Or(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Logical operation 'or' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Or, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "or"));
+    } 
+
+    std::pair<Object *, Error *> MultipliedBy(Object *other) override {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '*' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Multiply, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "*"));
+    }
+
+    std::pair<Object *, Error *> DividedBy(Object *other) {
+        if (other == nullptr) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Operator '/' not supported between '{}' and null", this->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (other->tag == this->tag) {
+            auto ob = dynamic_cast<Number *>(other);
+            return this->Operate(OperatorKind::Divide, ob->value, ob->startPos, ob->endPos);
+        }
+        return std::make_pair(nullptr, Object::IllegalOperation(other, "/"));
+    }
+
+    std::pair<Object *, Error *> Not() {
+        if (this->ntype == NumberType::Float) {
+            return std::make_pair((new Number(std::get<double>(this->value) == 0.0))->SetContext(this->ctx), nullptr);
+        } else {
+            return std::make_pair((new Number(std::get<int>(this->value) == 0))->SetContext(this->ctx), nullptr);
+        }
+    }
+
+    inline std::string ToString() override {
+        if (std::holds_alternative<int>(this->value)) {
+            return std::format("{}", std::get<int>(this->value));
+        } else {
+            return std::format("{}", std::get<double>(this->value));
+        }
+    }
+
+    bool AsBool() override {
+        if (this->ntype == NumberType::Int) {
+            return std::get<int>(this->value) != 0;
+        } else {
+            return std::get<double>(this->value) != 0.0;
+        }
+    }
+
+    ~Number() {
+
+    }
+};
+
+
+// Open-addressing hash map from identifiers to values. Entries are appended to `entries` in insertion order and
+// `index` maps the hash of a name (linear probing) to its entry, removed names leave a tombstone in both
+class SymbolMap final {
+public:
+    struct Entry {
+        std::string name;
+        std::size_t hash;
+        Object *value;
+        bool removed;
+    };
+
+    inline std::size_t Size() const {
+        return this->count;
+    }
+
+    // Bumped whenever a name is added or removed (or entries move), cached entry positions are valid until then
+    inline std::uint32_t Version() const {
+        return this->version;
+    }
+
+    inline const std::vector<Entry> &Entries() const {
+        return this->entries;
+    }
+
+    inline Object *At(int entry) const {
+        return this->entries[entry].value;
+    }
+
+    // Position of `name` in `entries`, -1 if absent
+    int Find(const std::string &name, std::size_t hash) const {
+        if (this->count == 0) {
+            return -1;
+        }
+        auto mask = this->index.size() - 1;
+        for (auto i = hash & mask; ; i = (i + 1) & mask) {
+            auto e = this->index[i];
+            if (e == Empty) {
+                return -1;
+            }
+            if (e != Removed && this->entries[e].hash == hash && this->entries[e].name == name) {
+                return e;
+            }
+        }
+    }
+
+    void Insert(const std::string &name, std::size_t hash, Object *value) {
+        if (auto e = this->Find(name, hash); e >= 0) {
+            this->entries[e].value = value;
+            return;
+        }
+        if ((this->used + 1) * 4 > this->index.size() * 3) {
+            this->Rehash();
+        }
+        auto mask = this->index.size() - 1;
+        auto i = hash & mask;
+        while (this->index[i] != Empty) {
+            i = (i + 1) & mask;
+        }
+        this->index[i] = this->entries.size();
+        this->entries.push_back({ name, hash, value, false });
+        this->used++;
+        this->count++;
+        this->version++;
+    }
+
+    // Whether `entry` still binds the name hashed to `hash`, guards cached positions against a table reallocated at the same address
+    inline bool Holds(int entry, std::size_t hash) const {
+        return entry >= 0 && static_cast<std::size_t>(entry) < this->entries.size() && this->entries[entry].hash == hash && !this->entries[entry].removed;
+    }
+
+    void Erase(const std::string &name, std::size_t hash) {
+        if (this->count == 0) {
+            return;
+        }
+        auto mask = this->index.size() - 1;
+        for (auto i = hash & mask; this->index[i] != Empty; i = (i + 1) & mask) {
+            auto e = this->index[i];
+            if (e != Removed && this->entries[e].hash == hash && this->entries[e].name == name) {
+                this->index[i] = Removed;
+                this->entries[e].removed = true;
+                this->entries[e].value = nullptr;
+                this->count--;
+                this->version++;
+                return;
+            }
+        }
+    }
+
+    void Clear() {
+        if (!this->entries.empty()) {
+            this->entries.clear();
+            std::fill(this->index.begin(), this->index.end(), Empty);
+            this->used = this->count = 0;
+            this->version++;
+        }
+    }
+
+private:
+    static constexpr std::int32_t Empty = -1;
+    static constexpr std::int32_t Removed = -2;
+
+    std::vector<Entry> entries;
+    std::vector<std::int32_t> index;
+    std::size_t used = 0;   // occupied index slots, tombstones included
+    std::size_t count = 0;  // live entries
+    std::uint32_t version = 0;
+
+    // Drops removed entries and rebuilds the index, doubling it when the live entries need the room
+    void Rehash() {
+        auto capacity = std::max<std::size_t>(this->index.size(), 8);
+        while ((this->count + 1) * 2 > capacity) {
+            capacity *= 2;
+        }
+        std::erase_if(this->entries, [](const Entry &e) { return e.removed; });
+        this->index.assign(capacity, Empty);
+        auto mask = capacity - 1;
+        for (std::size_t e = 0; e < this->entries.size(); e++) {
+            auto i = this->entries[e].hash & mask;
+            while (this->index[i] != Empty) {
+                i = (i + 1) & mask;
+            }
+            this->index[i] = static_cast<std::int32_t>(e);
+        }
+        this->used = this->count;
+        this->version++;
+    }
+};
+
+struct SymbolTable final {
+    SymbolMap symbols;
+    SymbolTable *parentFieldSymbols;
+    // Frame of a function: its own locals live in `slots` (by index of `layout`) and never in `symbols`
+    const FrameLayout *layout;
+    std::vector<Object *> slots;
+
+    explicit SymbolTable() {
+        this->parentFieldSymbols = nullptr;
+        this->layout = nullptr;
+    }
+
+    explicit SymbolTable(SymbolTable *parant, const FrameLayout *layout = nullptr) {
+        this->parentFieldSymbols = parant;
+        this->layout = nullptr;
+        this->SetLayout(layout);
+    }
+
+    inline void Reset(SymbolTable *parant, const FrameLayout *layout = nullptr) {
+        this->symbols.Clear();
+        this->parentFieldSymbols = parant;
+        this->SetLayout(layout);
+    }
+
+    inline void SetLayout(const FrameLayout *layout) {
+        this->layout = layout;
+        this->slots.assign(layout != nullptr ? layout->names.size() : 0, nullptr);
+    }
+
+    inline int SlotOf(const std::string &name, std::size_t hash) const {
+        return this->layout != nullptr ? this->layout->IndexOf(name, hash) : -1;
+    }
+
+    inline Object *Get(const std::string &name) {
+        return this->Get(name, SymbolHash(name));
+    }
+
+    Object *Get(const std::string &name, std::size_t hash) {
+        for (auto st = this; st != nullptr; st = st->parentFieldSymbols) {
+            if (auto slot = st->SlotOf(name, hash); slot >= 0) {
+                if (st->slots[slot] != nullptr) {
+                    return st->slots[slot];
+                }
+                continue;
+            }
+            if (auto e = st->symbols.Find(name, hash); e >= 0) {
+                return st->symbols.At(e);
+            }
+        }
+        return nullptr;
+    }
+
+    // Lookup of a variable node: through its frame slot when the frame was laid out by `layout`,
+    // through the entry cached by the node in a module / global scope, by name otherwise
+    Object *Get(const FrameLayout *layout, int slot, const std::string &name, std::size_t hash, SymbolCache &cache) {
+        if (this->layout != nullptr) {
+            if (layout != this->layout) {
+                return this->Get(name, hash);
+            }
+            if (slot >= 0) {
+                if (this->slots[slot] != nullptr) {
+                    return this->slots[slot];
+                }
+            } else if (auto e = this->symbols.Find(name, hash); e >= 0) {
+                return this->symbols.At(e);
+            }
+            return this->parentFieldSymbols != nullptr ? this->parentFieldSymbols->Get(name, hash) : nullptr;
+        }
+        if (cache.table == this && cache.version == this->symbols.Version() && this->symbols.Holds(cache.entry, hash)) {
+            return this->symbols.At(cache.entry);
+        }
+        if (auto e = this->symbols.Find(name, hash); e >= 0) {
+            cache = { this, this->symbols.Version(), e };
+            return this->symbols.At(e);
+        }
+        return this->parentFieldSymbols != nullptr ? this->parentFieldSymbols->Get(name, hash) : nullptr;
+    }
+
+    inline void Set(const std::string &name, Object *newValue) {
+        this->Set(name, SymbolHash(name), newValue);
+    }
+
+    inline void Set(const std::string &name, std::size_t hash, Object *newValue) {
+        if (auto slot = this->SlotOf(name, hash); slot >= 0) {
+            this->slots[slot] = newValue;
+            return;
+        }
+        this->symbols.Insert(name, hash, newValue);
+    } 
+
+    inline void Set(const FrameLayout *layout, int slot, const std::string &name, std::size_t hash, Object *newValue) {
+        if (slot >= 0 && layout == this->layout) {
+            this->slots[slot] = newValue;
+            return;
+        }
+        this->Set(name, hash, newValue);
+    }
+
+    inline void Remove(const std::string &name) {
+        auto hash = SymbolHash(name);
+        if (auto slot = this->SlotOf(name, hash); slot >= 0) {
+            this->slots[slot] = nullptr;
+            return;
+        }
+        this->symbols.Erase(name, hash);
+    }
+
+    // Every binding of this table (slots and named symbols), ordered by name
+    std::vector<std::pair<std::string, Object *>> Entries() const {
+        std::vector<std::pair<std::string, Object *>> entries;
+        entries.reserve(this->symbols.Size() + this->slots.size());
+        for (auto &e : this->symbols.Entries()) {
+            if (!e.removed) {
+                entries.emplace_back(e.name, e.value);
+            }
+        }
+        for (std::size_t i = 0; i < this->slots.size(); i++) {
+            if (this->slots[i] != nullptr) {
+                entries.emplace_back(this->layout->names[i], this->slots[i]);
+            }
+        }
+        std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+        return entries;
+    }
+
+    inline std::string ToString(bool showBuiltins = true) const {
+        std::stringstream ss;
+        ss << "{\n";
+        unsigned nums = 0;
+        auto entries = this->Entries();
+        for (auto [n, v] : entries) {
+            nums++;            
+            if (!showBuiltins && v->tag == TypeTag::BuiltinFunction) {
+                if (nums == entries.size() - 1) {
+                    auto s = showBuiltins ? "" : "\n";                
+                    ss << s << "}";
+                }
+                continue;
+            }
+            ss << std::format("  [{}] \'{}\':  {} ({})", v->typeName, n, v->ToString(), (void *) v);
+            if (nums != entries.size()) {
+                ss << ",\n";
+            } else {
+                ss << "\n}";
+            }
+        }
+        return ss.str();
+    }
+};
+
+
+std::pair<Object *, Error *> Object::GetCompEquals(Object *other) {
+    if (this->tag != other->tag) {
+        return std::make_pair(new Number(0), nullptr);
+    }
+    return std::make_pair(new Number((void *) this == (void *) other), nullptr);
+    // return std::make_pair(nullptr, this->IllegalOperation(other, "=="));
+}
+
+std::pair<Object *, Error *> Object::GetCompNequals(Object *other) {
+    if (this->tag == other->tag) {
+        return std::make_pair(new Number(1), nullptr);
+    }
+    return std::make_pair(new Number((void *) this != (void *) other), nullptr);
+    // return std::make_pair(nullptr, this->IllegalOperation(other, "!="));   
+}
+
+struct String : public Object {
+    using ObjectWithError = std::pair<Object *, Error *>;
+
+    struct StringIterator : public Object {
+        std::string content;
+        std::wstring iterContent;
+        long n;
+        explicit StringIterator(const std::string &content) : content(content), n(-1) {
+            this->iterContent = ToWideString(this->content);
+        }
+
+        ObjectWithError Next() override {
+            this->n++;
+            if (n < this->iterContent.length()) {
+                auto s = ToByteString(this->iterContent.substr(n, 1));
+                return std::make_pair(new String(s), nullptr);
+            } else {
+                return std::make_pair(nullptr, new StopIteration);
+            }
+        }
+    };
+
+    static inline std::string Repeat(const std::string &s, int times) {
+        std::string result;
+        for (int i = 0; i < times; i++) {
+            result += s;
+        }
+        return result;
+    }
+
+    std::string s;
+    explicit String(const std::string &value) : s(value), Object(TypeTag::String) {}
+
+    std::pair<Object *, Error *> AddTo(Object *other) override {
+        if (other->tag == TypeTag::String) {
+            auto *o = dynamic_cast<String *>(other);
+            return std::make_pair((new String(this->s + o->s))->SetContext(this->ctx)->SetPos(this->startPos, this->endPos), nullptr);
+        } else {
+            return std::make_pair(nullptr, Object::IllegalOperation(other, "+"));
+        }
+    }
+
+    std::pair<Object *, Error *> MultipliedBy(Object *other) override {
+        if (other->tag == TypeTag::Number) {
+            auto *o = dynamic_cast<Number *>(other);
+            if (o->ntype != NumberType::Int) {
+                return std::make_pair(nullptr, new TypeError(
+                    "The right of '*' in string multiplication must be an integer",
+                    other->startPos, other->endPos, this->ctx
+                ));
+            }
+            return std::make_pair((new String(String::Repeat(this->s, std::get<int>(o->value))))->SetContext(this->ctx)->SetPos(this->startPos, this->endPos), nullptr);
+        } else {
+           return std::make_pair(nullptr, Object::IllegalOperation(other, "*"));
+        }
+    }
+
+    std::pair<Object *, Error *> GetCompEquals(Object* other) override {
+        if (other->tag == TypeTag::String) {
+            return this->s == dynamic_cast<String *>(other)->s ? std::make_pair(new Number(1), nullptr) : std::make_pair(new Number(0), nullptr);
+        } else {
+            return std::make_pair(nullptr, Object::IllegalOperation(other, "=="));
+        }
+    }
+
+    std::pair<Object *, Error *> GetCompNequals(Object* other) override {
+        if (other->tag == TypeTag::String) {
+            return this->s == dynamic_cast<String *>(other)->s ? std::make_pair(new Number(0), nullptr) : std::make_pair(new Number(1), nullptr);
+        } else {
+            return std::make_pair(nullptr, Object::IllegalOperation(other, "!="));
+        }
+    }
+
+    bool AsBool() override {
+        return this->s.size() > 0;
+    }
+
+    Object *Copy() override {
+        return (new String(this->s))->SetContext(this->ctx)->SetPos(this->startPos, this->endPos);
+    }
+
+    inline std::string ToString() override {
+        return this->s;
+    }
+
+    std::pair<Object *, Error *> Len() override {
+        return std::make_pair(new Number((int) ToWideString(this->s).length()), nullptr);
+    }
+
+    inline void Representation() {
+        std::string repr;
+        std::cout << "'";
+        std::wstring ws = ToWideString(this->s);
+        for (long i = 0; i < ws.length(); i++) {
+            auto c = ToByteString(ws.substr(i, 1));
+            if (REVERSED_ESCAPE_CHARACTERS.find(c) != REVERSED_ESCAPE_CHARACTERS.end()) {
+                std::cout << "\\";
+                std::cout << REVERSED_ESCAPE_CHARACTERS.at(c);
+                continue;
+            }
+            std::cout << c;
+        }
+        std::cout << "'" << std::endl;
+    }
+
+    inline void Representation(std::ostream &o, bool nl = false) {
+        std::string repr;
+        std::wstring ws = ToWideString(this->s);        
+        o << "'";
+        for (long i = 0; i < ws.length(); i++) {
+            auto c = ToByteString(ws.substr(i, 1));
+            if (REVERSED_ESCAPE_CHARACTERS.find(c) != REVERSED_ESCAPE_CHARACTERS.end()) {
+                o << "\\";
+                o << REVERSED_ESCAPE_CHARACTERS.at(c);
+                continue;
+            }
+            o << c;
+        }
+        o << "'";
+        if (nl) {
+            o << std::endl;
+        }
+    }
+
+    ObjectWithError Subsciption(Object *other) override {
+        if (other->tag != TypeTag::Number) {
+            return std::make_pair(nullptr, new TypeError(
+                "String index should be a number",
+                other->startPos, other->endPos, this->ctx 
+            ));
+        }
+
+        auto index = As<Number>(other);
+        if (!std::holds_alternative<int>(index->value)) {
+            return std::make_pair(nullptr, new TypeError(
+                "String index should be a positive integer",
+                other->startPos, other->endPos, this->ctx
+            ));
+        }
+
+        auto indexNum = std::get<int>(index->value);
+        auto ws = ToWideString(this->s);
+        if (indexNum < 0) {
+            return std::make_pair(nullptr, new TypeError(
+                "String index should be a positive integer",
+                other->startPos, other->endPos, this->ctx
+            ));
+        }
+
+        if (indexNum + 1 > ws.length()) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("String index out of range (maximum is {} but got {})", this->s.length() - 1, indexNum),
+                other->startPos, other->endPos, this->ctx
+            ));
+        }
+
+        return std::make_pair(new String(ToByteString(ws.substr(indexNum, 1))), nullptr);
+    }
+
+    ObjectWithError Iter() {
+        return std::make_pair(new StringIterator(this->s), nullptr);
+    }
+
+    ~String() = default;
+};
+
+
+template <>
+inline std::string StringifySequence(const std::vector<Object *> &seq) {
+    std::string result = "[";
+    for (int i = 0; i < seq.size(); i++) {
+        if (seq[i]->tag == TypeTag::String) {
+            std::ostringstream oss;
+            As<String>(seq[i])->Representation(oss);
+            result += oss.str();
+        } else {
+            result += seq[i]->ToString();
+        }
+        if (i + 1 != seq.size()) {
+            result += ", ";
+        }
+    }
+    result += "]";
+    return result;
+}
+
+
+struct List : public Object {
+    std::vector<Object *> elements;
+    using ObjectWithError = std::pair<Object *, Error *>;
+    bool isParameterPack = false;
+    bool isMutable = true;
+
+    List *AsParameterPack() { 
+        auto c = As<List>(this->Copy());
+        c->isParameterPack = true;
+        return c;
+    }
+    List *SetUnmutable(bool v = false) { this->isMutable = v; return this; }
+
+    explicit List(const std::vector<Object *> &elements) : elements(elements), Object(TypeTag::List) {}
+
+    // immutable operation for operators of list
+    ObjectWithError AddTo(Object *other) override {
+        auto copy = dynamic_cast<List *>(this->Copy());
+        copy->elements.push_back(other);
+        return std::make_pair(copy, nullptr);
+    }
+
+    ObjectWithError MultipliedBy(Object *other) override {
+        if (other->tag != TypeTag::List) {
+            return std::make_pair(nullptr, Object::IllegalOperation(other, "<list-concat '*'>"));
+        }
+        auto newList = dynamic_cast<List *>(this->Copy());
+        // for (auto e : this->elements) {
+        //     newList->elements.push_back(e);
+        // }
+        for (auto e : dynamic_cast<List *>(other)->elements) {
+            newList->elements.push_back(e);
+        }
+        return std::make_pair(newList, nullptr);
+    }
+
+    ObjectWithError SubstractedBy(Object *other) override {
+        if (other->tag != TypeTag::Number) {
+            return std::make_pair(nullptr, Object::IllegalOperation(other, "<list-remove '-'>"));
+        } else {
+            auto index = dynamic_cast<Number *>(other);
+            if (index->ntype != NumberType::Int) {
+                return std::make_pair(nullptr, new TypeError(
+                    "List index must be an integer",
+                    this->startPos, this->endPos, this->ctx
+                ));
+            } else {
+                auto indexValue = std::get<int>(index->value);      
+                auto newList = dynamic_cast<List *>(this->Copy());
+                if (indexValue < 0) {
+                    indexValue = newList->elements.size() + indexValue;
+                }
+                if (indexValue + 1 > newList->elements.size()) {
+                    return std::make_pair(nullptr, new RuntimeError(
+                        std::format("List index out of range (given {} but maximum is {})", indexValue, newList->elements.size()),
+                        this->startPos, this->endPos, this->ctx
+                    ));
+                }
+                decltype(newList->elements)::iterator it = newList->elements.begin() + indexValue;
+                newList->elements.erase(it);
+                return std::make_pair(newList, nullptr);
+            }
+        }
+    }
+
+    ObjectWithError DividedBy(Object *other) override {
+        if (other->tag != TypeTag::Number) {
+            return std::make_pair(nullptr, Object::IllegalOperation(other, "<list-access '/'>"));
+        } else {
+            auto index = dynamic_cast<Number *>(other);
+            if (index->ntype != NumberType::Int) {
+                return std::make_pair(nullptr, new TypeError(
+                    "List index must be an integer",
+                    this->startPos, this->endPos, this->ctx
+                ));
+            } else {
+                auto indexValue = std::get<int>(index->value);      
+                if (indexValue < 0) {
+                    indexValue = this->elements.size() + indexValue;
+                }
+                if (indexValue + 1 > this->elements.size() || indexValue < 0) {
+                    return std::make_pair(nullptr, new RuntimeError(
+                        std::format("List index out of range (given {} but maximum is {})", indexValue, this->elements.size()),
+                        this->startPos, this->endPos, this->ctx
+                    ));
+                }
+                return std::make_pair(this->elements[indexValue], nullptr);
+            }
+        }
+    }
+
+    ObjectWithError Subsciption(Object *other) override {
+        return this->DividedBy(other);
+    }
+
+    ObjectWithError SubsciptionAssignment(Object *other, Object *newVal) override {
+        if (other->tag != TypeTag::Number) {
+            return std::make_pair(nullptr, Object::IllegalOperation(other, "<list-access '[]'>"));
+        } else {
+            auto index = dynamic_cast<Number *>(other);
+            if (index->ntype != NumberType::Int) {
+                return std::make_pair(nullptr, new TypeError(
+                    "List index must be an integer",
+                    this->startPos, this->endPos, this->ctx
+                ));
+            } else {
+                auto indexValue = std::get<int>(index->value);      
+                if (indexValue < 0) {
+                    indexValue = this->elements.size() + indexValue;
+                }
+                if (indexValue + 1 > this->elements.size() || indexValue < 0) {
+                    return std::make_pair(nullptr, new RuntimeError(
+                        std::format("List index out of range (given {} but maximum is {})", indexValue, this->elements.size()),
+                        this->startPos, this->endPos, this->ctx
+                    ));
+                }
+                this->elements[indexValue] = newVal;
+            }
+        }
+        return std::make_pair(Number::null, nullptr);
+    }
+
+    Object *Copy() override {
+        auto copy = new List(this->elements);
+        copy->SetPos(this->startPos, this->endPos);
+        copy->SetContext(this->ctx);
+        // copy->isParameterPack = this->isParameterPack;
+        // copy->isMutable = this->isMutable;
+        return copy;
+    }
+
+     std::pair<Object *, Error *> Len() override {
+        return std::make_pair(new Number((int) this->elements.size()), nullptr);
+    }
+    
+
+    inline std::string ToString() override {
+        return StringifySequence(this->elements);
+    }
+};
+
+// Insertion-ordered hash table behind `Dictionary`: key / value pairs are appended to `entries` and `index`
+// (open addressing, linear probing) maps the hash of a key to its entry.
+// Strings, numbers and big integers are hashed and compared by value, any other key by identity
+class ObjectMap final {
+public:
+    using Entry = std::pair<Object *, Object *>;
+
+    ObjectMap() = default;
+
+    // Entries of a pointer-ordered map, kept in that order
+    explicit ObjectMap(const std::map<Object *, Object *> &mapping) {
+        for (auto &[k, v] : mapping) {
+            this->Set(k, v);
+        }
+    }
+
+    inline std::size_t size() const {
+        return this->entries.size();
+    }
+
+    inline bool empty() const {
+        return this->entries.empty();
+    }
+
+    inline std::vector<Entry>::iterator begin() { return this->entries.begin(); }
+    inline std::vector<Entry>::iterator end() { return this->entries.end(); }
+    inline std::vector<Entry>::const_iterator begin() const { return this->entries.begin(); }
+    inline std::vector<Entry>::const_iterator end() const { return this->entries.end(); }
+
+    // Position of `key` in insertion order, -1 if absent
+    int Find(Object *key) const {
+        if (this->entries.empty()) {
+            return -1;
+        }
+        auto hash = HashOf(key);
+        auto mask = this->index.size() - 1;
+        for (auto i = hash & mask; this->index[i] != Empty; i = (i + 1) & mask) {
+            auto e = this->index[i];
+            if (this->hashes[e] == hash && Equals(this->entries[e].first, key)) {
+                return e;
+            }
+        }
+        return -1;
+    }
+
+    // Same as `Find` for a string key, without allocating a `String`
+    int Find(const std::string &key) const {
+        if (this->entries.empty()) {
+            return -1;
+        }
+        auto hash = SymbolHash(key);
+        auto mask = this->index.size() - 1;
+        for (auto i = hash & mask; this->index[i] != Empty; i = (i + 1) & mask) {
+            auto e = this->index[i];
+            if (this->hashes[e] == hash && IsStringKey(this->entries[e].first, key)) {
+                return e;
+            }
+        }
+        return -1;
+    }
+
+    inline Object *At(int entry) const {
+        return this->entries[entry].second;
+    }
+
+    inline void Assign(int entry, Object *value) {
+        this->entries[entry].second = value;
+    }
+
+    // Replaces the value of an equal key (which keeps its position) or appends the pair
+    void Set(Object *key, Object *value) {
+        if (auto e = this->Find(key); e >= 0) {
+            this->entries[e].second = value;
+            return;
+        }
+        if ((this->entries.size() + 1) * 3 > this->index.size() * 2) {
+            this->Grow();
+        }
+        auto hash = HashOf(key);
+        this->Place(hash, this->entries.size());
+        this->entries.emplace_back(key, value);
+        this->hashes.push_back(hash);
+    }
+
+    static std::size_t HashOf(Object *key);
+    static bool Equals(Object *a, Object *b);
+    static bool IsStringKey(Object *key, const std::string &s);
+
+private:
+    static constexpr std::int32_t Empty = -1;
+
+    std::vector<Entry> entries;
+    std::vector<std::size_t> hashes;
+    std::vector<std::int32_t> index;
+
+    inline void Place(std::size_t hash, std::int32_t entry) {
+        auto mask = this->index.size() - 1;
+        auto i = hash & mask;
+        while (this->index[i] != Empty) {
+            i = (i + 1) & mask;
+        }
+        this->index[i] = entry;
+    }
+
+    void Grow() {
+        this->index.assign(std::max<std::size_t>(this->index.size() * 2, 8), Empty);
+        for (std::size_t e = 0; e < this->entries.size(); e++) {
+            this->Place(this->hashes[e], static_cast<std::int32_t>(e));
+        }
+    }
+};
+
+std::string StringifyMapping(const ObjectMap &mapping, std::string prefIgnore = "", std::string suffIgnore = "") {
+    std::string result = "{";
+    int i = 0;
+    for (auto &[k, v] : mapping) {
+        std::string str = "";
+        if (prefIgnore != "") {
+            if (k->ToString().starts_with(prefIgnore)) {
+                i++;
+                continue;
+            }
+        }        
+        if (suffIgnore != "") {
+            if (k->ToString().ends_with(suffIgnore)) {
+                i++;
+                continue;
+            }
+        }
+        if (k->tag == TypeTag::String) {
+            str = std::string("'") + k->ToString() + std::string("'");
+        } else {
+            str = k->ToString();
+        }
+        result += str;
+        result += ": ";
+        if (v->tag == TypeTag::String) {
+            str = std::string("'") + v->ToString() + std::string("'");
+        } else {
+            str = v->ToString();
+        }
+        result += str;
+        if (i + 1 != mapping.size()) {
+            result += ", ";
+        }
+        i++;
+    }
+    return result + "}";
+}
+
+
+struct Dictionary : public Object {
+    ObjectMap elements;
+    using ObjectWithError = std::pair<Object *, Error *>;
+
+    explicit Dictionary(const std::map<Object *, Object *> &elements) : Object(TypeTag::Dictionary), elements(elements) {}
+    explicit Dictionary(ObjectMap &&elements) : Object(TypeTag::Dictionary), elements(std::move(elements)) {}
+    explicit Dictionary(const ObjectMap &elements) : Object(TypeTag::Dictionary), elements(elements) {}
+
+    std::vector<Object *> GetKeys() {
+        std::vector<Object *> result;
+        for (auto [k, _] : this->elements) {
+            result.push_back(k);
+        }
+        return result;
+    }
+
+    ObjectWithError Subsciption(Object *other) override {
+        if (auto e = this->elements.Find(other); e >= 0) {
+            return std::make_pair(this->elements.At(e), nullptr);
+        }
+        return std::make_pair(nullptr, new AttributeError(
+            std::format("Dictionary has no attribute `{}`", other->ToString()),
+            other->startPos, other->endPos, this->ctx
+        ));
+    }
+
+    ObjectWithError SubsciptionAssignment(Object *other, Object *newVal) override {
+        if (auto e = this->elements.Find(other); e >= 0) {
+            this->elements.Assign(e, newVal);
+            return std::make_pair(Number::null, nullptr);
+        }
+        if (other->tag != TypeTag::String && other->tag != TypeTag::Number && other->tag != TypeTag::BigInt) {
+            return std::make_pair(nullptr, new TypeError(
+                std::format("Invilid key type: '{}'", other->typeName),
+                other->startPos, other->endPos, this->ctx
+            ));
+        }
+        this->elements.Set(other, newVal);
+        return std::make_pair(Number::null, nullptr);
+    }
+
+    ObjectWithError GetAttr(const std::string &attr) override {
+        if (auto e = this->elements.Find(attr); e >= 0) {
+            return std::make_pair(this->elements.At(e), nullptr);
+        }
+        return std::make_pair(nullptr, new AttributeError(
+           std::format("Could not found attribute '.{}'", attr),
+           this->startPos, this->endPos, this->ctx
+        ));
+    }
+
+    ObjectWithError SetAttr(const std::string &attr, Object *newVal) override {
+        if (auto e = this->elements.Find(attr); e >= 0) {
+            this->elements.Assign(e, newVal);
+            return std::make_pair(Number::null, nullptr);
+        }
+        return this->SubsciptionAssignment((new String(attr))->SetContext(this->ctx)->SetPos(newVal->startPos, newVal->endPos), newVal);
+    }
+
+    Object *Copy() override {
+        auto copy = new Dictionary(this->elements);
+        copy->SetContext(this->ctx)->SetPos(this->startPos, this->endPos);
+        return copy;
+    }
+
+    ObjectWithError Len() override {
+        return std::make_pair(new Number((int) this->elements.size()), nullptr);
+    }
+
+    inline std::string ToString() override {
+        return StringifyMapping(this->elements);
+    }
+};
+
+
+enum class InterpreterStartMode {
+    Repl,
+    File,
+    Evaluation
+};
+
+class Interpreter final {
+public:
+    explicit Interpreter();
+    RuntimeResult Visit(NodeBase *node, Context *ctx);
+    RuntimeResult VisitExpression(NodeBase *node, Context *ctx);
+    RuntimeResult VisitSingleExpression(NodeBase *node, Context *ctx);
+    RuntimeResult VisitVarAccessNode(NodeBase *node, Context *ctx);
+    RuntimeResult VisitVarAssignNode(NodeBase *node, Context *ctx);
+    RuntimeResult VisitNumber(NodeBase *node, Context *ctx);
+    RuntimeResult VisitIfExpressionNode(NodeBase *node, Context *ctx);
+    RuntimeResult VisitForExpression(NodeBase *node, Context *ctx);
+    RuntimeResult VisitWhileExpression(NodeBase *node, Context *ctx);
+    RuntimeResult VisitFunctionCall(NodeBase *node, Context *ctx);
+    RuntimeResult VisitFunctionDefinition(NodeBase *node, Context *ctx);
+    RuntimeResult VisitString(NodeBase *node, Context *ctx);
+    RuntimeResult VisitList(NodeBase *node, Context *ctx);
+    RuntimeResult VisitReturn(NodeBase *node, Context *ctx);
+    RuntimeResult VisitContinue(NodeBase *node, Context *ctx);
+    RuntimeResult VisitBreak(NodeBase *node, Context *ctx);
+    RuntimeResult VisitSubscription(NodeBase *node, Context *ctx);
+    RuntimeResult VisitDictionary(NodeBase *node, Context *ctx);
+    RuntimeResult VisitAttribution(NodeBase *node, Context *ctx);
+    RuntimeResult VisitAdvancedVarAccess(NodeBase *node, Context *ctx);
+    RuntimeResult VisitNewExpression(NodeBase *node, Context *ctx);
+    RuntimeResult VisitAttributionCall(NodeBase *node, Context *ctx);
+    RuntimeResult VisitStructDef(NodeBase *node, Context *ctx);
+    RuntimeResult VisitNonlocal(NodeBase *node, Context *ctx);
+    RuntimeResult VisitDefer(NodeBase *node, Context *ctx);
+    std::vector<Context *> *GetCallStack() { return this->callStack; }
+    [[noreturn]] RuntimeResult VisitEmpty(NodeBase *node, Context *ctx);
+    ~Interpreter();
+
+    std::vector<Context *> *callStack;
+};
+
+// An interpreter keeps no state between visits, function calls and module loads all share this one
+inline Interpreter *SharedInterpreter() {
+    static Interpreter *interpreter = new Interpreter;
+    return interpreter;
+}
+
+
+// `--engine=vm` runs scripts and function bodies as bytecode (see `VirtualMachine`), nodes it cannot
+// compile are still evaluated by the tree-walking interpreter
+enum class ExecutionEngine { TreeWalker, VM };
+ExecutionEngine executionEngine = ExecutionEngine::TreeWalker;
+RuntimeResult ExecuteCompiled(CompilationUnit *unit, NodeBase *body, bool keepValue, Context *ctx, Interpreter *interpreter);
+
+std::map<std::string, Context *> moduleContextCache;
+std::map<std::string, std::string> symbolsModuleLocation;
+// Frames of returned calls to user-defined functions, reused by the next calls (deepest recursion level sized)
+std::vector<Context *> framePool;
+
+struct FunctionBase : virtual public Object {
+    std::string functionName;
+    bool hasMutableArgument = false;
+    explicit FunctionBase(const std::string &name) : functionName(name), Object(TypeTag::FunctionBase)
+    {}
+
+    explicit FunctionBase() : FunctionBase("<anonymous>") {}
+
+    // Parent context of a new frame and the symbol table its locals are chained to
+    std::pair<Context *, SymbolTable *> FrameScope(const CallSite &site) {
+        if (symbolsModuleLocation.find(this->functionName) == symbolsModuleLocation.end()) {
+            if (site.ctx && site.ctx->symbols) {
+                return std::make_pair(site.ctx, site.ctx->symbols);
+            }
+            return std::make_pair(site.ctx, globalSymbolTable);
+        }
+        auto ctxTmpl = moduleContextCache.at(symbolsModuleLocation.at(this->functionName));
+        return std::make_pair(ctxTmpl->external ? site.ctx : ctxTmpl, ctxTmpl->symbols);
+    }
+
+    Context *GenerateNewContext(const CallSite &site) {
+        auto [parent, enclosingSymbols] = this->FrameScope(site);
+        auto frameContext = new Context(this->functionName, parent, site.st);
+        frameContext->symbols = new SymbolTable(enclosingSymbols);
+        frameContext->nonlocals = new SymbolTable;
+        return frameContext;
+    }
+
+    virtual RuntimeResult CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, const CallSite &site) {
+        RuntimeResult result;
+        if (args.size() > argNames.size()) {
+            return result.Failure(new TypeError(
+                std::format("Too many arguments given to function '{}' (Expected {} but got {})", this->functionName, argNames.size(), args.size()),
+                site.st, site.et, site.ctx
+            ));
+        } else if (args.size() < argNames.size()) {
+            return result.Failure(new TypeError(
+                std::format("Too few arguments given to function '{}' (Expected {} but got {})", this->functionName, argNames.size(), args.size()),
+                site.st, site.et, site.ctx
+            ));
+        }
+        return result.Success(nullptr);
+    }
+
+    // Immutable arguments may be shared with variables of the caller and are bound as they are
+    virtual Object *BindArgument(Object *value, std::size_t index, Context *execCtx, const CallSite &site) {
+        if (IsMutableValue(value)) {
+            value->SetContext(execCtx);
+        }
+        return value;
+    }
+
+    virtual RuntimeResult PopulateArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx, const CallSite &site) {
+        for (std::size_t i = 0; i < args.size(); i++) {
+            execCtx->symbols->Set(argNames[i], this->BindArgument(args[i], i, execCtx, site));
+        }
+        return RuntimeResult().Success(nullptr);
+    }
+
+    virtual RuntimeResult CheckAndPopulate(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx, const CallSite &site) {
+        RuntimeResult result;
+        result.Register(this->CheckArguments(argNames, args, site));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        result.Register(this->PopulateArguments(argNames, args, execCtx, site));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        return result.Success(nullptr);
+    }
+};
+
+
+struct Function : public FunctionBase {
+    NodeBase *body;
+    std::vector<std::string> parameters;
+    bool shouldAutoReturn;
+    std::string mutableArgName;
+    std::vector<std::string> cellVars;
+    SymbolTable *closureVarsTable;
+    // Owner of `body`, kept alive for as long as the function (or one of its copies) exists
+    CompilationUnit *unit;
+    // Slots of the frame the body was resolved against (see `Resolver`), owned by `unit`
+    const FrameLayout *layout;
+
+    explicit Function(const std::string &name, NodeBase *body, std::vector<std::string> args, bool shouldAutoReturn) :
+        Object(TypeTag::Function), FunctionBase(name), body(body), parameters(args), shouldAutoReturn(shouldAutoReturn), unit(nullptr), layout(nullptr)
+    {
+        this->closureVarsTable = new SymbolTable;
+    }
+
+    ~Function() override {
+        if (this->unit != nullptr) {
+            this->unit->Release();
+        }
+    }
+
+    Function *SetUnit(CompilationUnit *unit) {
+        if (unit != nullptr) {
+            unit->Retain();
+        }
+        if (this->unit != nullptr) {
+            this->unit->Release();
+        }
+        this->unit = unit;
+        return this;
+    }
+
+    explicit Function(NodeBase *body, std::vector<std::string> args, bool shouldAutoReturn) : 
+        Function("<anonymous>", body, args, shouldAutoReturn) {}
+
+    RuntimeResult CheckMutableArgument(const std::vector<std::string> &argNames, std::vector<Object *> &args, const CallSite &site, bool isMethod = false) {
+        RuntimeResult result;
+        std::vector<std::string> mutableArgNames;
+        for (auto &argName : argNames) {
+            if (argName.starts_with("_") && argName.ends_with("_") && !argName.starts_with("__") && !argName.ends_with("__")) {
+                this->hasMutableArgument = true;
+                mutableArgNames.push_back(argName);
+            }
+        }
+        if (!this->hasMutableArgument && !isMethod) {
+            return FunctionBase::CheckArguments(argNames, args, site);
+        }
+        if (this->hasMutableArgument) {
+            if (mutableArgNames.size() > 1) {
+                return result.Failure(new RuntimeError(
+                    "Too many mutable arguments",
+                    site.st, site.et, site.ctx
+                ));
+            }
+
+            if (argNames[argNames.size() - 1] != mutableArgNames[0]) {
+                return result.Failure(new RuntimeError(
+                    "Mutable argument appeared before positional arguments",
+                    site.st, site.et, site.ctx
+                ));
+            }        
+            this->mutableArgName = mutableArgNames[0];
+            return result.Success(Number::null);
+        }
+        return result.Success(nullptr);
+    }
+
+    RuntimeResult CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, const CallSite &site) override {
+        RuntimeResult result;
+        result.Register(this->CheckMutableArgument(argNames, args, site));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        if (argNames.size() == 0) {
+            return result.Success(nullptr);
+        }
+
+        if (args.size() < argNames.size() - 1) {
+             return result.Failure(new RuntimeError(
+                std::format("Too few arguments given to function '{}' (Expected at least {} but got {})", this->functionName, argNames.size() - 1, args.size()),
+                site.st, site.et, site.ctx
+            ));
+        }
+        return result.Success(nullptr);
+    }
+
+    virtual RuntimeResult PopulateArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx, const CallSite &site) override {
+        if (!this->hasMutableArgument) {
+            return FunctionBase::PopulateArguments(argNames, args, execCtx, site);
+        }
+        auto mutableArgumentValue = new List({});
+        bool mutableArgumentReplaced = false;
+        int i;
+        for (i = 0; i < argNames.size() - 1; i++) {
+            auto argValue = this->BindArgument(args[i], i, execCtx, site);
+            auto argName = argNames[i];
+            execCtx->symbols->Set(argName, argValue);
+        }
+
+        if (!mutableArgumentReplaced) {
+            for (; i < args.size(); i++) {
+                auto argValue = this->BindArgument(args[i], i, execCtx, site);
+
+                if (argValue->tag == TypeTag::List) {
+                    if (As<List>(argValue)->isParameterPack) {
+                        for (auto &&unpackedVal : As<List>(argValue)->elements) {
+                            mutableArgumentValue->elements.push_back(unpackedVal);
+                        }
+                        continue;
+                    }
+                }
+                mutableArgumentValue->elements.push_back(argValue);
+            }
+            execCtx->symbols->Set(this->mutableArgName.substr(1, this->mutableArgName.size() - 2), mutableArgumentValue);
+            if (!mutableArgumentValue->elements.empty()) {
+                execCtx->symbols->Set("$" + this->mutableArgName.substr(1, this->mutableArgName.size() - 2), mutableArgumentValue->AsParameterPack());
+            }
+        }
+
+        return RuntimeResult().Success(nullptr);
+    }
+
+    // Same as `GenerateNewContext`, but the frame comes from `framePool` and reads the closure table in place
+    Context *AcquireFrame(const CallSite &site) {
+        auto [parent, enclosingSymbols] = this->FrameScope(site);
+        Context *frameContext;
+        if (framePool.empty()) {
+            frameContext = new Context(this->functionName, parent, site.st);
+            frameContext->symbols = new SymbolTable(enclosingSymbols, this->layout);
+        } else {
+            frameContext = framePool.back();
+            framePool.pop_back();
+            frameContext->Reset(this->functionName, parent, site.st);
+            frameContext->symbols->Reset(enclosingSymbols, this->layout);
+        }
+        frameContext->nonlocals = this->closureVarsTable;
+        return frameContext;
+    }
+
+    // Frames of failed calls are never released, the error's traceback still walks them. A pooled frame lets go
+    // of its entry position, which would otherwise keep the caller's source alive until the frame is reused
+    static void ReleaseFrame(Context *frameContext) {
+        if (!frameContext->captured) {
+            frameContext->parentEntry = nullptr;
+            framePool.push_back(frameContext);
+        }
+    }
+
+    RuntimeResult Execute(std::vector<Object *> args, const CallSite &site) override {
+        RuntimeResult result;
+        auto interpreter = SharedInterpreter();
+        auto frameContext = this->AcquireFrame(site);
+
+        result.Register(this->CheckAndPopulate(this->parameters, args, frameContext, site));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+
+        RuntimeResult bodyResult;
+        if (executionEngine == ExecutionEngine::VM && this->unit != nullptr) {
+            bodyResult = ExecuteCompiled(this->unit, this->body, this->shouldAutoReturn, frameContext, interpreter);
+        } else {
+            bodyResult = interpreter->Visit(this->body, frameContext);
+        }
+        auto returnValue = result.Register(bodyResult);
+        if (result.ShouldReturn() && result.funcReturnValue == nullptr) {
+            Error *lastError = result.error;
+            if (frameContext->deferNodes.size() != 0) {
+                for (auto node : frameContext->deferNodes) {
+                    auto expr = NodeCast<DeferNode>(node)->deferExpr;
+                    if (currentCallStackDepth <= MAX_CALLSTACK_DEPTH) {
+
+                        std::map<Object *, Object *> excInfo {
+                            { new String("category"), new String(lastError->name) },
+                            { new String("details"), new String(lastError->details) },
+                            { new String("line"), new Number(lastError->st->line + 1) },
+                            { new String("column"), new Number(lastError->st->column + 1) },
+                            { new String("filename"), new String(lastError->st->Filename()) }
+                        };
+                        frameContext->symbols->Set("__lastexc__", new Dictionary(excInfo));
+                        result.Register(interpreter->Visit(expr, frameContext));        
+                        if (result.ShouldReturn()) {
+                            return result.Failure(
+                                result.error, lastError, "During handling the above exception, another exception occurred:"
+                            );                        
+                        }
+                    } else {
+                         return result.Failure(new RuntimeError(
+                            "`defer` terminated due to stack overflow",
+                            site.st, site.et, site.ctx
+                        ));
+                    }
+                }
+
+                auto frameState = frameContext->symbols->Get("__recovered__");
+                if (!frameState) {
+                    return result.Failure(lastError);
+                } else {
+                    ReleaseFrame(frameContext);
+                    return result.Success(frameState);
+                }
+            } else {
+                return result;
+            }
+        }
+        Object *returns = nullptr;
+        if (shouldAutoReturn && result.funcReturnValue == nullptr) {
+            returns = returnValue;
+        } else if (result.funcReturnValue != nullptr) {
+            returns = result.funcReturnValue;
+        } else {
+            returns = Number::null;
+        }
+
+        if (frameContext->deferNodes.size() != 0) {
+            for (auto node : frameContext->deferNodes) {
+                auto expr = NodeCast<DeferNode>(node)->deferExpr;
+                if (currentCallStackDepth <= MAX_CALLSTACK_DEPTH) {
+                    frameContext->symbols->Set("__lastexc__", Number::null);
+                    result.Register(interpreter->Visit(expr, frameContext));        
+                    if (result.ShouldReturn()) {
+                        return result;                    
+                    }
+                } else {
+                    return result.Failure(new RuntimeError(
+                        "`defer` terminated due to stack overflow",
+                        site.st, site.et, site.ctx
+                    ));
+                }
+            }
+        }
+        ReleaseFrame(frameContext);
+        return result.Success(returns);
+    }
+
+    Object *Copy() override {
+        auto copiedFunction = new Function(this->functionName, this->body, this->parameters, this->shouldAutoReturn);
+        copiedFunction->cellVars = this->cellVars;
+        copiedFunction->closureVarsTable = this->closureVarsTable;
+        copiedFunction->SetUnit(this->unit);
+        copiedFunction->layout = this->layout;
+        copiedFunction->SetContext(this->ctx);
+        copiedFunction->SetPos(this->startPos, this->endPos);
+        return copiedFunction;        
+    }
+
+    Object *SetContext(Context *ctx) override {
+        Object::SetContext(ctx);
+        return this;
+    }
+
+    Object *SetPos(Position *st, Position *et) override {
+        Object::SetPos(st, et);
+        return this;
+    }
+
+    inline std::string ToString() override {
+        return std::format("<function {} at {}>", this->functionName, (void *) this);
+    }
+};
+
+
+struct ClassObject : public Dictionary {
+    explicit ClassObject(const std::map<Object *, Object *> &elements) : Dictionary(elements) {}
+    explicit ClassObject(const ObjectMap &elements) : Dictionary(elements) {}
+    std::string className;
+    bool isProto = true;
+
+    RuntimeResult BuildClass() {
+        RuntimeResult result;
+        auto [className, error] = this->GetAttr("__cls__");
+        if (error != nullptr) {
+            return result.Failure(new ValueError(
+                "Class prototype without an '__cls__' attribute",
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        if (className->tag != TypeTag::String) {
+            return result.Failure(new TypeError(
+                std::format("Invilid type for '__cls__': '{}'", className->typeName),
+                this->startPos, this->endPos, this->ctx
+            ));
+        }
+        this->className = As<String>(className)->s.c_str();
+        this->SetTypeTag(TypeTag::ClassObject);
+        return result.Success(nullptr);
+    }
+
+
+    inline std::string ToString() override {
+        if (isProto) {
+            return std::format("<Prototype of object '{}' at {}>", this->className, (void *) this);
+        } else {
+            std::stringstream ss;
+            ss << RED << this->className << RESET << " {\n  ";
+            int idx = 0;
+            for (const auto &[k, v] : this->elements) {
+                std::string s;
+                if (idx + 1 == this->elements.size()) {
+                    s = "\n}";
+                } else {
+                    s = ",\n  ";
+                }
+                std::string vs;
+                if (v->tag == TypeTag::Function) {
+                    vs = "[Function]";
+                } else if (v->tag == TypeTag::BuiltinFunction) {
+                    vs = "[Native Function]";
+                } else if (v->tag == TypeTag::BuiltinMethod) {
+                    vs = "[Native Method]";
+                } else if (v->tag == TypeTag::String) {
+                    vs = std::format("'{}'", v->ToString());
+                } else {
+                    if (v->tag == TypeTag::ClassObject) {
+                        auto co = As<ClassObject>(v);
+                        if (co->className == this->className) {
+                            vs = "[this]";
+                        } else {
+                            vs = std::format("[Object {}]", co->className);
+                        }
+                    } else  {
+                        vs = v->ToString();
+                    }
+                }
+                ss << std::format("'{}': ", k->ToString());
+                ss << CYAN;
+                ss << std::format("{}", vs);
+                ss << RESET;
+                ss << std::format("{}", s);
+                idx++;
+            }
+            return ss.str();
+        }
+    }
+
+    Object *Copy() override {
+        auto copy = new ClassObject(this->elements);
+        copy->className = this->className;
+        copy->isProto = this->isProto;
+        copy->SetContext(this->ctx)->SetPos(this->startPos, this->endPos);
+        copy->BuildClass();
+        return copy;
+    }
+
+    Object *Instantiate(const std::vector<Object *> &args, Context *ctx, Position *st, Position *et);
+};
+
+struct Method : public Function {
+    Object *self;
+
+    static Method *FromFunction(Function *f, Object *self, const std::string &name = "<anonymous>") {
+        auto m = new Method(f->functionName, f->body, f->parameters, f->shouldAutoReturn);
+        m->SetPos(f->startPos, f->endPos);
+        m->SetContext(f->ctx);
+        m->SetUnit(f->unit);
+        m->layout = f->layout;
+        m->self = self;
+        m->functionName = name;
+        return m;
+    }
+
+    explicit Method(const std::string &name, NodeBase *body, std::vector<std::string> args, bool shouldAutoReturn)
+        : Function(name, body, args, shouldAutoReturn), Object(TypeTag::Method) {}
+
+    RuntimeResult CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, const CallSite &site) override {
+        RuntimeResult result;
+        result.Register(this->CheckMutableArgument(argNames, args, site, true));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+
+         if (args.size() + 1 < argNames.size()) {
+                return result.Failure(new RuntimeError(
+                std::format("Too few arguments given to method '{}' (Expected at least {} but got {})", this->functionName, argNames.size() - 1, args.size()),
+                site.st, site.et, site.ctx
+            ));
+        }
+
+        return result.Success(nullptr);
+    }
+    
+    RuntimeResult PopulateArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx, const CallSite &site) override {
+        if (argNames.size() == 0) {
+            return Function::PopulateArguments(argNames, args, execCtx, site);
+        }
+        if ((args.size() < argNames.size() - 1 && hasMutableArgument) || (args.size() != argNames.size() - 1 && !hasMutableArgument)) {
+            return RuntimeResult().Failure(new TypeError(
+                std::format("Invilid argument sequence length of method '{}': {} (requires {})", this->functionName, args.size(), argNames.size() - 1),
+                site.st, site.et, site.ctx
+            ));
+        }
+        execCtx->symbols->Set(argNames[0], this->self);
+        std::vector<std::string> remain;
+        for (int i = 1; i < argNames.size(); i++) {
+            remain.push_back(argNames[i]);
+        }
+
+        return Function::PopulateArguments(remain, args, execCtx, site);
+    }
+
+    Object *Copy() override {
+        auto copiedMethod = new Method(this->functionName, this->body, this->parameters, this->shouldAutoReturn);
+        copiedMethod->self = this->self;
+        copiedMethod->SetUnit(this->unit);
+        copiedMethod->layout = this->layout;
+        copiedMethod->SetContext(this->ctx);
+        copiedMethod->SetPos(this->startPos, this->endPos);
+        return copiedMethod;
+    }
+
+    inline std::string ToString() override {
+        std::string tpName;
+        if (this->self->tag == TypeTag::ClassObject) {
+            tpName = As<ClassObject>(this->self)->className;
+        } else {
+            tpName = this->self->typeName;
+        }
+        return std::format("<bound-method {} at {} of object '{}' at {}>", this->functionName, (void *) this, tpName, (void *) self);
+    }
+};
+
+
+void Interprete(const std::string &, const std::string &, InterpreterStartMode, const std::string & = "", Context * = nullptr, Position *parentEntry = nullptr);
+void SetBuiltins(SymbolTable *global);
+const std::vector<std::string> builtinNames { 
+    "print", "println", "typeof", "readLine", "len", "parseInt", "parseFloat", "str", "eval",
+    "sin", "cos", "tan", "abs", "log", "ln", "sqrt", "isFloating", "isInteger",
+    "input", "import", "set", "require",
+    "readFile", "writeFile", "append", "concat", "remove", "builtins", "panic", "del",
+    "range", "addressOf", "keys", "values", "global", "recover", "BigInteger", "exit"
+};
+
+std::map<std::string, std::string> *envVars = nullptr;
+const std::map<std::string, std::string> requiredEnvVars = { 
+    { "native-lib-path", "lib/" },
+    { "builtins-import-path", "builtins/" },
+    { "version", YAN_LANG_VERSION }
+};
+
+
+namespace builtins {
+    using YanArgumentListType = std::vector<Object *> &;
+    using YanContext = Context *;
+    using YanObject = RuntimeResult;
+    using BuiltinFunctionImplementation = std::function<RuntimeResult(YanContext)>;
+    
+    void AllocEnvVars() {
+        ::envVars = new std::map<std::string, std::string>;
+    }
+
+    bool HasEnvVar(const std::string &key) {
+        if (envVars == nullptr) {
+            std::cerr << "Fatal: Env has not been allocated, builtins::AllocEnv() should be called before operation" << std::endl;
+            assert(false);
+        }
+        return ::envVars->find(key) != ::envVars->end();
+    }
+
+    void SetEnvVar(const std::string &key, const std::string &val) {
+        if (envVars == nullptr) {
+            std::cerr << "Fatal: Env has not been allocated, builtins::AllocEnv() should be called before operation" << std::endl;
+            assert(false);
+        }
+        if (!HasEnvVar(key)) {
+            ::envVars->insert(std::make_pair(key, val));
+        } else {
+            (*::envVars)[key] = val;
+        }
+    }
+
+    std::string GetEnvVar(const std::string &key) {
+        if (envVars == nullptr) {
+            std::cerr << "Fatal: Env has not been allocated, builtins::AllocEnv() should be called before operation" << std::endl;
+            assert(false);
+        }
+        if (!HasEnvVar(key)) {
+            std::cerr << "Fatal: Invilid env key: " << key << std::endl;
+            assert(false);
+        }
+        return (*::envVars)[key];
+    }
+
+    // default
+    void RestoreEnvVar() {
+        if (envVars == nullptr) {
+            std::cerr << "Fatal: Env has not been allocated, builtins::AllocEnv() should be called before operation" << std::endl;
+            assert(false);
+        }
+        std::fstream file;
+        file.open("./env.def", std::ios::in);
+        std::string buf;
+
+        if (file.is_open()) {
+            while (std::getline(file, buf)) {
+                auto def = Split(buf, "=");
+                if (def.size() != 2) {
+                    std::cerr << "Fatal: Invilid env definition: " << buf << std::endl;
+                    assert(false); 
+                }
+
+                SetEnvVar(def[0], def[1]);
+            }      
+            file.close();        
+        }
+
+        for (auto [requiredKey, defaultVal] : requiredEnvVars) {
+            if (!HasEnvVar(requiredKey)) {
+                SetEnvVar(requiredKey, defaultVal);
+            }
+        }
+    }
+
+    std::map<std::string, std::string> GetVars() {
+        auto vars = *::envVars;
+        return vars;
+    }
+
+    struct YanModule {
+        YanModule(const std::string &moduleName) : moduleName(moduleName) {}
+        YanModule *AddSymbol(const std::string &symbolName, std::vector<std::string> &&decl) {
+            if (decl.size() != 0) {
+                this->functionArgumentDeclearation.insert(std::make_pair(symbolName, decl));
+            }
+            this->symbols.push_back(symbolName);
+            return this;
+        }
+
+        std::string moduleName;
+        std::vector<std::string> symbols;
+        std::map<std::string, std::vector<std::string>> functionArgumentDeclearation;
+    };
+
+    using YanModuleDeclearation = YanModule *;
+    using ModuleLoaderFunc = YanModuleDeclearation (*)();
+
+    
+    [[noreturn]] YanObject Invilid(YanContext ctx) {
+        std::cerr << "Fatal: Unknown builtin access" << std::endl;
+        assert(false);
+    }
+
+    Error *AssertYanTypeMatches(YanContext ctx, Object *obj, const std::string &argName, const std::vector<TypeTag> &validTypes) {
+        if (std::find(validTypes.begin(), validTypes.end(), obj->tag) == validTypes.end()) {
+            std::vector<std::string> validTypeNames;
+            for (auto tag : validTypes) {
+                validTypeNames.push_back(TypeTagName(tag));
+            }
+            return new TypeError(
+                std::format("Type of argument '{}' mismatched: Requires one of {} but got {}", argName, StringifyStringSequence(validTypeNames), obj->typeName),
+                obj->startPos, obj->endPos, ctx
+            );
+        }
+        return nullptr;
+    }
+
+    namespace IO {
+        YanObject Println(YanContext ctx) {
+            std::cout << ctx->symbols->Get("_str")->ToString() << std::endl;
+            return RuntimeResult().Success(Number::null);
+        }
+
+        YanObject Readline(YanContext ctx) {
+            std::string s;
+            std::getline(std::cin, s);
+            return RuntimeResult().Success(new String(s));
+        }
+
+        YanObject Input(YanContext ctx) {
+            auto prompt = ctx->symbols->Get("__prompt__");
+            if (prompt != nullptr) {
+                std::cout << prompt->ToString();
+            }
+            std::string s;
+            std::getline(std::cin, s);
+            return RuntimeResult().Success(new String(s));
+        }
+
+        YanObject ReadFile(YanContext ctx) {
+            RuntimeResult result;
+            auto arg = ctx->symbols->Get("_filename");
+            auto err = AssertYanTypeMatches(ctx, arg, "_filename", { TypeTag::String });
+            if (err != nullptr) {
+                return result.Failure(err);
+            }
+            auto file = As<String>(arg)->s;
+
+            std::ifstream ifs;
+            ifs.open(file, std::ios::in);
+            if (!ifs.is_open()) {
+                return result.Failure(new OSError(
+                    std::format("Failed to open file: '{}'", file),
+                    arg->startPos, arg->endPos, ctx
+                ));
+            }
+            std::ostringstream oss;
+            oss << ifs.rdbuf();
+            auto content = oss.str();
+            ifs.close();
+
+            return result.Success(new String(content));
+        }
+
+        YanObject WriteFile(YanContext ctx) {
+            RuntimeResult result;
+            auto arg1 = ctx->symbols->Get("_filename");
+            auto arg2 = ctx->symbols->Get("_str");
+            auto arg3 = ctx->symbols->Get("__mode__");
+            std::fstream fileStream;
+            std::ios_base::openmode mode;
+
+            if (arg3 != nullptr) {
+                if (arg3->tag != TypeTag::String) {
+                    return result.Failure(new TypeError(
+                        "File open mode should be a string",
+                        arg3->startPos, arg3->endPos, ctx
+                    ));
+                }
+                auto modeString = As<String>(arg3)->s;
+                if (modeString == "w") {
+                    mode = std::ios::out;
+                } else if (modeString == "wa") {
+                    mode = std::ios::out | std::ios::app;
+                } else {
+                    return result.Failure(new ValueError(
+                        std::format("Invilid file open mode: \'{}\'", modeString),
+                        arg3->startPos, arg3->endPos, ctx
+                    ));
+                }
+            } else {
+                mode = std::ios::out;
+            }
+
+            if (arg1->tag != TypeTag::String) {
+                return result.Failure(new TypeError(
+                    "Expected a path with string type",
+                    arg3->startPos, arg3->endPos, ctx
+                ));
+            }
+            if (arg2->tag != TypeTag::String) {
+                return result.Failure(new TypeError(
+                    "Content should be a string",
+                    arg2->startPos, arg2->endPos, ctx
+                ));
+            }
+
+            auto filePath = As<String>(arg1)->s;
+            auto content = As<String>(arg2)->s;
+            fileStream.open(filePath, mode);
+            if (!fileStream.is_open()) {
+                return result.Failure(new OSError(
+                    std::format("Failed to open file: '{}'", filePath),
+                    arg1->startPos, arg1->endPos, ctx
+                ));
+            }
+            fileStream << content;
+            fileStream.close();
+            return result.Success(Number::null);
+        }
+
+        YanObject Print(YanContext ctx) {
+            std::cout << ctx->symbols->Get("_str")->ToString();
+            return RuntimeResult().Success(Number::null);
+        }
+    }
+
+    namespace Math {
+        bool HoldsInteger(Number *n) {
+            return std::holds_alternative<int>(n->value);
+        }
+        
+        int GetInt(Number *n) {
+            assert(HoldsInteger(n));
+            return std::get<int>(n->value);
+        }
+
+        double GetFloat(Number *n) {
+            assert(!HoldsInteger(n));
+            return std::get<double>(n->value);
+        }
+
+        // For only 1 argument
+        template<typename T>
+        YanObject _MathFunc(YanContext ctx, YanObject o, T func) {
+            auto arg = ctx->symbols->Get("_x");
+            auto err = AssertYanTypeMatches(ctx, arg, "_x", { TypeTag::Number });
+            if (err != nullptr) {
+                return o.Failure(err);
+            }
+            auto num = dynamic_cast<Number *>(arg);
+            
+            return o.Success(new Number(func(HoldsInteger(num) ? GetInt(num) : GetFloat(num))));
+        }
+
+        YanObject Sin(YanContext ctx) {
+            RuntimeResult result;
+            auto sin_ = [](double x) { return sin(x); };
+            return _MathFunc(ctx, result, sin_);
+        }
+
+        YanObject Cos(YanContext ctx) {
+            RuntimeResult result;
+            auto cos_ = [](double x) { return cos(x); };
+            return _MathFunc(ctx, result, cos_);
+        }
+
+        YanObject Tan(YanContext ctx) {
+            RuntimeResult result;
+            auto tan_ = [](double x) { return tan(x); };
+            return _MathFunc(ctx, result, tan_);
+        }
+
+        YanObject Abs(YanContext ctx) {
+            RuntimeResult result;
+            auto abs_ = [](double x) { return x > 0 ? x : -x; };
+            return _MathFunc(ctx, result, abs_);
+        }
+
+        YanObject Log(YanContext ctx) {
+            RuntimeResult result;
+            auto log_ = [](double x) { return log10(x); };
+            return _MathFunc(ctx, result, log_);
+        }
+
+        YanObject Ln(YanContext ctx) {
+            RuntimeResult result;
+            auto ln_ = [](double x) { return log(x); };
+            return _MathFunc(ctx, result, ln_);
+        }
+
+        YanObject Sqrt(YanContext ctx) {
+            RuntimeResult result;
+            auto sqrt_ = [](double x) { return sqrt(x); };
+            return _MathFunc(ctx, result, sqrt_);
+        }
+
+        YanObject IsFloating(YanContext ctx) {
+            RuntimeResult result;
+            auto arg = ctx->symbols->Get("_num");
+            auto err = AssertYanTypeMatches(ctx, arg, "_num", { TypeTag::Number });
+            if (err != nullptr) {
+                return result.Failure(err);
+            }
+
+            auto num = As<Number>(arg);
+            int v = (int) !HoldsInteger(num);
+            return result.Success(new Number(v));
+        }
+
+        YanObject IsInteger(YanContext ctx) {
+            RuntimeResult result;
+            auto arg = ctx->symbols->Get("_num");
+            auto err = AssertYanTypeMatches(ctx, arg, "_num", { TypeTag::Number });
+            if (err != nullptr) {
+                return result.Failure(err);
+            }
+
+            auto num = As<Number>(arg);
+            int v = (int) HoldsInteger(num);
+            return result.Success(new Number(v));
+        }
+    }
+
+    YanObject Len(YanContext ctx) {
+        RuntimeResult result;
+        auto len = ctx->symbols->Get("_seq")->Len();
+        if (len.first == nullptr) {
+            return result.Failure(len.second);
+        }
+        return result.Success(len.first);
+    }
+
+    namespace List_ {
+        YanObject Append(YanContext ctx) {
+            RuntimeResult result;
+            auto arg = ctx->symbols->Get("_lst");
+            auto o = ctx->symbols->Get("_o");
+            auto err = AssertYanTypeMatches(ctx, arg, "_lst", { TypeTag::List });
+            if (err != nullptr) {
+                return result.Failure(err);
+            }
+            auto lst = As<List>(arg);
+            lst->elements.push_back(o);
+            return result.Success(Number::null);
+        } 
+
+        YanObject Remove(YanContext ctx) {
+            RuntimeResult result;
+            auto arg = ctx->symbols->Get("_lst");
+            auto arg2 = ctx->symbols->Get("_idx");
+            auto err = AssertYanTypeMatches(ctx, arg, "_lst", { TypeTag::List });
+            auto err2 = AssertYanTypeMatches(ctx, arg2, "_idx", { TypeTag::Number });
+            if (err != nullptr) {
+                return result.Failure(err);
+            }
+            if (err2 != nullptr) {
+                return result.Failure(err2);
+            }
+
+            auto lst = As<List>(arg);
+            auto idx = As<Number>(arg2);
+            if (!Math::HoldsInteger(idx)) {
+                return result.Failure(new TypeError(
+                    "List index must be an integer",
+                    idx->startPos, idx->endPos, ctx
+                ));
+            }
+            auto indexReal = Math::GetInt(idx);
+            if (indexReal < 0) {
+                return result.Failure(new TypeError(
+                    "List index must be a positive integer",
+                    idx->startPos, idx->endPos, ctx
+                ));  
+            }
+            lst->elements.erase(lst->elements.begin() + indexReal);
+            return result.Success(Number::null);
+        }
+
+        YanObject Concat(YanContext ctx) {
+            RuntimeResult result;
+            auto arg = ctx->symbols->Get("_lst1");
+            auto arg2 = ctx->symbols->Get("_lst2");
+            auto err = AssertYanTypeMatches(ctx, arg, "_lst1", { TypeTag::List });
+            auto err2 = AssertYanTypeMatches(ctx, arg2, "_lst2", { TypeTag::List });
+            if (err != nullptr) {
+                return result.Failure(err);
+            }
+            if (err2 != nullptr) {
+                return result.Failure(err2);
+            }
+
+            auto lst = As<List>(arg);
+            auto idx = As<List>(arg2);
+            for (auto &e : idx->elements) {
+                lst->elements.push_back(e);
+            }
+            return result.Success(Number::null);
+        }
+
+        YanObject Range(YanContext ctx) {
+            RuntimeResult result;
+            auto arg1 =  ctx->symbols->Get("_a");
+            auto arg2 = ctx->symbols->Get("__b__");
+            auto arg3 = ctx->symbols->Get("__c__");
+            Number *a = nullptr;
+            Number *b = nullptr;
+            Number *c = nullptr;
+
+            auto checkArg = [](Number *n) { 
+                return ::builtins::Math::HoldsInteger(n) && n->ntype == NumberType::Int && ::builtins::Math::GetInt(n) >= 0;
+            };
+
+            if (arg1->tag == TypeTag::Number) {
+                a = As<Number>(arg1);
+                if (!checkArg(a)) {
+                    return result.Failure(new ValueError(
+                        "range(x) requires an positive integer",
+                        arg1->startPos, arg1->endPos, ctx
+                    ));
+                }
+            } else {
+                return result.Failure(new TypeError(
+                    "range() requires number as parameters",
+                    arg1->startPos, arg1->endPos, ctx
+                ));
+            }
+            assert(!(arg2 == nullptr && arg3 != nullptr));
+
+            auto check = [ctx, checkArg](Object *arg1) {
+                RuntimeResult result;
+                if (arg1->tag == TypeTag::Number) {
+                    auto n = As<Number>(arg1);
+                    if (!checkArg(n)) {
+                        return result.Failure(new ValueError(
+                            "range(x) requires an positive integer",
+                            arg1->startPos, arg1->endPos, ctx
+                        ));
+                    }
+                    return result.Success(nullptr);
+                } else {
+                    return result.Failure(new TypeError(
+                        "range() requires number as parameters",
+                        arg1->startPos, arg1->endPos, ctx
+                    ));
+                }
+            };
+
+            if (arg2 != nullptr && arg3 == nullptr) {
+                result.Register(check(arg2));
+                if (result.ShouldReturn()) {
+                    return result;
+                }
+                b = As<Number>(arg2);
+                std::vector<Object *> iter;
+                for (int i = ::builtins::Math::GetInt(a); i < ::builtins::Math::GetInt(b); i++) {
+                    iter.push_back(new Number(i));
+                } 
+                return result.Success(new List(iter));
+            } else if (arg2 != nullptr && arg3 != nullptr) {
+                result.Register(check(arg2));
+                if (result.ShouldReturn()) {
+                    return result;
+                }
+                result.Register(check(arg3));
+                if (result.ShouldReturn()) {
+                    return result;
+                }
+                b = As<Number>(arg2);
+                c = As<Number>(arg3);
+                
+                std::vector<Object *> iter;
+                for (int i = ::builtins::Math::GetInt(a); i < ::builtins::Math::GetInt(b); i += ::builtins::Math::GetInt(c)) {
+                    iter.push_back(new Number(i));
+                } 
+                return result.Success(new List(iter));
+            } else {
+                std::vector<Object *> iter;
+                for (int i = 0; i < ::builtins::Math::GetInt(a); i++) {
+                    iter.push_back(new Number(i));
+                } 
+                return result.Success(new List(iter));
+            }
+        }
+
+        YanObject Keys(YanContext ctx) {
+            RuntimeResult result;
+            auto arg = ctx->symbols->Get("_dict");
+            auto err = AssertYanTypeMatches(ctx, arg, "_dict", { TypeTag::Dictionary });
+            if (err != nullptr) {
+                return result.Failure(err);
+            }
+            auto dict = As<Dictionary>(arg);
+            return result.Success(new List(dict->GetKeys()));
+        }
+
+        YanObject Values(YanContext ctx) {
+            RuntimeResult result;
+            auto arg = ctx->symbols->Get("_dict");
+            auto err = AssertYanTypeMatches(ctx, arg, "_dict", { TypeTag::Dictionary });
+            if (err != nullptr) {
+                return result.Failure(err);
+            }
+
+            auto dict = As<Dictionary>(arg);
+            std::vector<Object *> values;
+            for (auto &[k, v] : dict->elements) {
+                values.push_back(v);
+            }
+            return result.Success(new List(values));
+        }
+    }
+    
+    YanObject Set(YanContext ctx) {
+        RuntimeResult result;
+        auto argLst = ctx->symbols->Get("_lst");
+        auto argIdx = ctx->symbols->Get("_idx");
+        auto argValue = ctx->symbols->Get("_value");
+        auto err1 = AssertYanTypeMatches(ctx, argLst, "_lst", { TypeTag::List });
+        if (err1 != nullptr) {
+            return result.Failure(err1);
+        }
+        auto err2 = AssertYanTypeMatches(ctx, argIdx, "_idx", { TypeTag::Number });
+        if (err2 != nullptr) {
+            return result.Failure(err2);
+        }
+
+        auto lst = As<List>(argLst);
+        auto index = As<Number>(argIdx);
+        if (index->ntype != NumberType::Int) {
+            return result.Failure(new ValueError(
+                "List index must be an integer",
+                index->startPos, index->endPos, ctx
+            ));
+        } else if (Math::GetInt(index) < 0) {
+            return result.Failure(new ValueError(
+                "Negative index not allowed here",
+                index->startPos, index->endPos, ctx
+            ));
+        }
+
+        lst->elements[Math::GetInt(index)] = argValue;
+        return result.Success(Number::null);
+    }
+
+    YanObject _InterpreteModule(const std::string &moduleFile, const std::string &symbolName, Position *st, Position *et, YanContext ctx) {
+        RuntimeResult result;
+        std::ifstream ifs;
+        ifs.open(moduleFile, std::ios::in);
+        if (!ifs.is_open()) {
+            ifs.clear();
+            ifs.open(std::format("{}/{}", GetEnvVar("builtins-import-path"), moduleFile), std::ios::in);
+            if (!ifs.is_open()) {
+                return result.Failure(new OSError(
+                    std::format("Failed to open module: '{}'", moduleFile),
+                    st, et, ctx
+                ));
+            }
+        }
+        std::ostringstream oss;
+        oss << ifs.rdbuf();
+        auto code = oss.str();
+
+        auto [unit, err] = CompilationUnit::Compile(moduleFile, code);
+        if (err != nullptr) {
+            return result.Failure(err);
+        }
+        auto moduleContext = new Context(std::format("<module '{}'>", moduleFile));
+        moduleContext->parent = ctx;
+        moduleContext->parentEntry = st;
+        moduleContext->symbols = new SymbolTable;
+        SetBuiltins(moduleContext->symbols);
+        moduleContext->Capture();
+        result.Register(SharedInterpreter()->Visit(unit->ast, moduleContext));
+        unit->Release();
+        if (result.ShouldReturn()) {
+            return result.Failure(new RuntimeError(
+                std::format("Failed to load module: '{}'", moduleFile),
+                st, et, ctx
+            ), result.error);
+        }
+
+        auto symbol = moduleContext->symbols->Get(symbolName);
+        if (symbol == nullptr) {
+            return result.Failure(new RuntimeError(
+                std::format("Module '{}' has no symbol '{}'", moduleFile, symbolName),
+                st, et, ctx
+            ));
+        }
+        // if (symbol->tag != TypeTag::Function) {
+        //     return result.Failure(new ValueError(
+        //         "Only functions can be imported", st, et, ctx
+        //     ));
+        // }
+
+        auto symbolCopy = symbol->Copy();
+        moduleContextCache.insert(std::make_pair(moduleFile, moduleContext));        
+        symbolsModuleLocation.insert(std::make_pair(symbolName, moduleFile));
+        return result.Success(symbolCopy);
+    }
+
+    YanObject _ImportModule(const std::string &moduleFile, YanContext dest, Position *st, Position *et, YanContext ctx) {
+        RuntimeResult result;
+        std::ifstream ifs;
+        ifs.open(moduleFile, std::ios::in);
+        if (!ifs.is_open()) {
+            ifs.clear();
+            ifs.open(std::format("{}/{}", GetEnvVar("builtins-import-path"), moduleFile), std::ios::in);
+            if (!ifs.is_open()) {
+                return result.Failure(new OSError(
+                    std::format("Failed to open module: '{}'", moduleFile),
+                    st, et, ctx
+                ));
+            }
+        }
+        std::ostringstream oss;
+        oss << ifs.rdbuf();
+        auto code = oss.str();
+
+        auto [unit, err] = CompilationUnit::Compile(moduleFile, code);
+        if (err != nullptr) {
+            return result.Failure(err);
+        }
+        auto moduleContext = new Context(std::format("<module '{}'>", moduleFile));
+        moduleContext->parent = ctx;   
+        moduleContext->parentEntry = st;             
+        moduleContext->symbols = new SymbolTable;
+        SetBuiltins(moduleContext->symbols);
+        moduleContext->Capture();
+        result.Register(SharedInterpreter()->Visit(unit->ast, moduleContext));
+        unit->Release();
+        if (result.ShouldReturn()) {
+            return result.Failure(new RuntimeError(
+                std::format("Failed to load module: '{}'", moduleFile),
+                st, et, ctx
+            ), result.error);
+        }
+        moduleContextCache.insert(std::make_pair(moduleFile, moduleContext));
+
+        for (auto &[symbolName, symbol] : moduleContext->symbols->Entries()) {
+            if (symbol->tag != TypeTag::BuiltinFunction || !Contains(builtinNames, symbolName)) {
+                dest->symbols->Set(symbolName, symbol->Copy());
+                symbolsModuleLocation.insert(std::make_pair(symbolName, moduleFile));
+            }
+        }
+
+        return result.Success(Number::null);
+    }
+    
+    YanObject _useModule(const std::string &moduleFile, YanContext dest, Position *st, Position *et, YanContext ctx) {
+        RuntimeResult result;
+        std::ifstream ifs;
+        ifs.open(moduleFile + ".yan", std::ios::in);
+        if (!ifs.is_open()) {
+            ifs.clear();
+            ifs.open(std::format("{}/{}", GetEnvVar("builtins-import-path"), moduleFile + ".yan"), std::ios::in);
+            if (!ifs.is_open()) {
+                return result.Failure(new OSError(
+                    std::format("Failed to open module: '{}'", moduleFile),
+                    st, et, ctx
+                ));
+            }
+        }
+        std::ostringstream oss;
+        oss << ifs.rdbuf();
+        auto code = oss.str();
+
+        auto [unit, err] = CompilationUnit::Compile(moduleFile, code);
+        if (err != nullptr) {
+            return result.Failure(err);
+        }
+        auto moduleContext = new Context(std::format("<module '{}'>", moduleFile));
+        moduleContext->parent = ctx;        
+        moduleContext->parentEntry = st;        
+        moduleContext->symbols = new SymbolTable;
+        moduleContext->SetExternal(true);
+        SetBuiltins(moduleContext->symbols);
+        moduleContext->Capture();
+        result.Register(SharedInterpreter()->Visit(unit->ast, moduleContext));
+        unit->Release();
+        if (result.ShouldReturn()) {
+            return result.Failure(new RuntimeError(
+                std::format("Failed to load module: '{}'", moduleFile),
+                st, et, ctx
+            ), result.error);
+        }
+        moduleContextCache.insert(std::make_pair(moduleFile, moduleContext));
+
+        ObjectMap moduleSymbols;
+        for (auto &[symbolName, symbol] : moduleContext->symbols->Entries()) {
+            if (symbol->tag != TypeTag::BuiltinFunction || !Contains(builtinNames, symbolName)) {
+                moduleSymbols.Set(new String(symbolName), symbol);
+                symbolsModuleLocation.insert(std::make_pair(symbolName, moduleFile));
+            }
+        }
+
+        auto p = Split(moduleFile, "/");
+        std::string importName {};
+        if (p.size() != 1) {
+            importName = p[p.size() - 1];
+        } else {
+            importName = moduleFile;
+        }
+        dest->symbols->Set(importName, new Dictionary(std::move(moduleSymbols)));
+        return result.Success(Number::null);
+    }
+
+    // YanObject _LoadNativeModuleFromStub(const std::string &moduleStub, YanContext dest, Position *st, Position *et, YanContext ctx) {
+
+    // }
+
+    // auto ::LoadNativeFunctionImplementation(const std::string &dynamicLib, const std::string &name) -> RuntimeResult (*)(Context *);
+    YanObject _LoadNativeSymbol(const std::string &mod, const std::string &symbolName, Position *st, Position *et, YanContext ctx);
+
+    YanObject Import(YanContext ctx) {
+        RuntimeResult result;
+        auto arg = ctx->symbols->Get("_symbol");
+        auto err = AssertYanTypeMatches(ctx, arg, "_symbol", { TypeTag::String });
+        if (err != nullptr) {
+            return result.Failure(err);
+        }
+        auto argString = As<String>(arg)->s;
+
+        if (!argString.starts_with("@")) {
+            auto symbolInfo = Split(argString, ".");
+            if (symbolInfo.size() != 1 && symbolInfo.size() != 2) {
+                return result.Failure(new ValueError(
+                    std::format("Invilid import specification: '{}'", arg->ToString()),
+                    arg->startPos, arg->endPos, ctx
+                ));
+            }
+            if (symbolInfo.size() == 2) {
+                auto symbolSourceFile = symbolInfo[0] + ".yan";
+                auto symbolName = symbolInfo[1];
+                auto symbol = _InterpreteModule(symbolSourceFile, symbolName, arg->startPos, arg->endPos, ctx);
+                if (symbol.error != nullptr) {
+                    return result.Failure(symbol.error, symbol.cause);
+                }
+
+                return result.Success(symbol.value);
+            } else {
+                auto destCtx = ctx->parent;
+                auto status = _useModule(symbolInfo[0], destCtx, arg->startPos, arg->endPos, ctx);
+                if (status.error != nullptr) {
+                    return result.Failure(status.error, status.cause);
+                }
+                return result.Success(Number::null);
+            }
+        } else {
+            return result.Failure(new ValueError(
+                "\'import\' does not support to load an native implementation",
+                arg->startPos, arg->endPos, ctx
+            ));
+        }
+    }
+
+    YanObject Require(YanContext ctx) {
+        RuntimeResult result;
+        auto arg = ctx->symbols->Get("_module");
+        auto err = AssertYanTypeMatches(ctx, arg, "_module", { TypeTag::String });
+        if (err != nullptr) {
+            return result.Failure(err);
+        }
+
+        auto argString = As<String>(arg)->s;
+        if (!argString.starts_with("@")) {
+            auto moduleName = argString + ".yan";
+            auto destCtx = ctx->parent;
+            auto status = _ImportModule(moduleName, destCtx, arg->startPos, arg->endPos, ctx);
+            if (status.error != nullptr) {
+                return result.Failure(status.error, status.cause);
+            }
+
+            return result.Success(Number::null);
+        } else {
+            auto moduleDescr = Split(argString.substr(1), ".");
+            if (moduleDescr.size() != 2) {
+                return result.Failure(new ValueError(
+                    "Invilid symbol location",
+                    arg->startPos, arg->endPos, ctx
+                ));
+            }
+            auto moduleName = moduleDescr[0];
+            auto symbol = moduleDescr[1];
+
+            auto destCtx = ctx->parent;
+            auto symbolValue = _LoadNativeSymbol(moduleName, symbol, arg->startPos, arg->endPos, ctx);
+            if (symbolValue.error != nullptr) {
+                return result.Failure(symbolValue.error);
+            }
+            return result.Success(symbolValue.value);
+        }
+    }
+
+    YanObject Eval(YanContext ctx) {
+        RuntimeResult result;
+        auto code = ctx->symbols->Get("_code");
+        if (code->tag != TypeTag::String) {
+            return result.Failure(new TypeError(
+                std::format("Argument '_code' must be a String (got {})", code->typeName),
+                code->startPos, code->endPos, ctx
+            ));
+        }
+
+        auto evaluationFrameId = std::format("<eval frame at {}>", (void *) ctx);
+        Interprete(evaluationFrameId, dynamic_cast<String *>(code)->s, InterpreterStartMode::Evaluation, evaluationFrameId, ctx, code->startPos);
+        return result.Success(Number::null);
+    }
+
+    YanObject ParseInt(YanContext ctx) {
+        RuntimeResult result;
+        auto yanStr = ctx->symbols->Get("_str");
+        if (yanStr->tag != TypeTag::String) {
+            return result.Failure(new TypeError(
+                std::format("Argument '_str' must be a String (got {})", yanStr->typeName),
+                yanStr->startPos, yanStr->endPos, ctx
+            ));
+        }
+        return RuntimeResult().Success(new Number((int) Lexer::ParseInt(dynamic_cast<String *>(yanStr)->s)));
+    }
+
+    YanObject ParseFloat(YanContext ctx) {
+        RuntimeResult result;
+        auto yanStr = ctx->symbols->Get("_str");
+        if (yanStr->tag != TypeTag::String) {
+            return result.Failure(new TypeError(
+                std::format("Argument '_str' must be a String (got {})", yanStr->typeName),
+                yanStr->startPos, yanStr->endPos, ctx
+            ));
+        }
+        return RuntimeResult().Success(new Number((double) Lexer::ParseFloat(dynamic_cast<String *>(yanStr)->s)));
+    }
+
+    YanObject ToString(YanContext ctx) {
+        return RuntimeResult().Success(new String(ctx->symbols->Get("_object")->ToString()));
+    }
+
+    YanObject TypeNameOf(YanContext ctx) {
+        auto obj = ctx->symbols->Get("_object");
+        if (obj->tag == TypeTag::ClassObject) {
+            return RuntimeResult().Success(new String(std::format("[Class {}]", dynamic_cast<ClassObject *>(obj)->className)));
+        } else {
+            return RuntimeResult().Success(new String(std::format("[builtins.{}]", std::string(obj->typeName))));
+        }
+    }
+
+    YanObject Builtins(YanContext ctx) {
+        auto builtinLst = new List({});
+        for (const auto &n : builtinNames)  {
+            builtinLst->elements.push_back(new String(n));
+        }
+        return RuntimeResult().Success(builtinLst);
+    }
+
+    YanObject Panic(YanContext ctx) {
+        auto err = ctx->symbols->Get("_err");
+        return RuntimeResult().Failure(new ::Panic(err->ToString(), err->startPos, err->endPos, ctx));
+    }
+
+    YanObject Del(YanContext ctx) {
+        RuntimeResult result;
+        auto arg = ctx->symbols->Get("_varName");
+        if (arg->tag != TypeTag::String) {
+            return result.Failure(new TypeError(
+                "del() requires a string name of variable",
+                arg->startPos, arg->endPos, ctx
+            ));
+        }
+
+        auto delVarName = As<String>(arg);
+        if (ctx->symbols->Get(delVarName->s) == nullptr) {
+            return result.Failure(new ValueError(
+                std::format("del('{}'): not defined", delVarName->s),
+                arg->startPos, arg->endPos, ctx
+            ));
+        }
+
+        auto var = ctx->symbols->Get(delVarName->s);
+        if (var->tag == TypeTag::BuiltinFunction) {
+            return result.Failure(new RuntimeError(
+                std::format("Attempted to delete non-user defined function: '{}'", delVarName->s),
+                arg->startPos, arg->endPos, ctx
+            ));
+        }
+        // Not freed: values are shared, other variables or containers may still refer to it
+        ctx->parent->symbols->Remove(delVarName->s);
+        return result.Success(Number::null);
+    }
+
+    YanObject AddressOf(YanContext ctx) {
+        return RuntimeResult().Success(
+            new String(std::format("{}", static_cast<void *>(ctx->symbols->Get("_object"))))
+        );
+    }
+
+    YanObject Global(YanContext ctx) {
+        RuntimeResult result;
+        auto arg = ctx->symbols->Get("_varName");
+        auto value = ctx->symbols->Get("_value");
+
+        if (arg->tag != TypeTag::String) {
+            return result.Failure(new TypeError(
+                "Variable name must be a string",
+                arg->startPos, arg->endPos, ctx
+            ));
+        }
+
+        auto varName = As<String>(arg)->s;
+        if (ctx->global->Get(varName) == nullptr)  {
+            return result.Failure(new ValueError(
+                std::format("Variable '{}' is not declared in global scope", varName),
+                arg->startPos, arg->endPos, ctx
+            ));
+        }
+
+        ctx->global->Set(varName, value);
+        return result.Success(Number::null);
+    }
+
+    YanObject Recover(YanContext ctx) {
+        RuntimeResult result;
+        auto arg = ctx->parent->symbols->Get("__lastexc__");
+
+        if (!ctx->parent || !ctx->parent->parent) {
+            return result.Failure(new ValueError(
+                "Cannot recover from top-level scope or a normal function",
+                nullptr, nullptr, ctx
+            ));
+        }
+        auto ret = ctx->symbols->Get("__ret__");
+
+        if (arg != nullptr) {
+            ctx->parent->symbols->Remove("__lastexc__");
+            if (!ret) {
+                ctx->parent->parent->symbols->Set("__recovered__", Number::null);            
+            } else {
+                ctx->parent->parent->symbols->Set("__recovered__", ret);            
+            }
+        }
+        return result.Success(Number::null);
+    }
+
+    YanObject BigInteger(YanContext ctx);
+
+    YanObject Exit(YanContext ctx) {
+        auto arg = ctx->symbols->Get("__code__");
+        int exitCode = 0;
+        if (arg) {
+            if (arg->tag != TypeTag::Number) {
+                auto nv = As<Number>(arg);
+                if (!Math::HoldsInteger(nv)) {
+                    return RuntimeResult().Failure(new TypeError(
+                        "Exit code requires an integer",
+                        arg->startPos, arg->endPos, ctx
+                    ));
+                }
+                exitCode = Math::GetInt(nv);
+            }
+        }
+
+        exit(exitCode);
+        return RuntimeResult().Success(nullptr);
+    }
+}
+
+const std::map<std::string, builtins::BuiltinFunctionImplementation> builtinFuncIndexes {
+    { "print", builtins::IO::Print },
+    { "println", builtins::IO::Println },
+    { "readLine", builtins::IO::Readline },
+    { "typeof", builtins::TypeNameOf },
+    { "len", builtins::Len },
+    { "parseInt", builtins::ParseInt },
+    { "parseFloat", builtins::ParseFloat },
+    { "str", builtins::ToString },
+    { "eval", builtins::Eval },
+    { "sin", builtins::Math::Sin },
+    { "cos", builtins::Math::Cos },
+    { "tan", builtins::Math::Tan },
+    { "abs", builtins::Math::Abs },
+    { "log", builtins::Math::Log },
+    { "ln", builtins::Math::Ln },
+    { "sqrt", builtins::Math::Sqrt },
+    { "input", builtins::IO::Input },
+    { "import", builtins::Import },
+    { "set", builtins::Set },
+    { "require", builtins::Require },
+    { "readFile", builtins::IO::ReadFile },
+    { "writeFile", builtins::IO::WriteFile },
+    { "append", builtins::List_::Append },
+    { "concat", builtins::List_::Concat },
+    { "remove", builtins::List_::Remove },
+    { "builtins", builtins::Builtins },
+    { "panic", builtins::Panic },
+    { "isFloating", builtins::Math::IsFloating },
+    { "isInteger", builtins::Math::IsInteger },
+    { "del", builtins::Del },
+    { "range", builtins::List_::Range },
+    { "addressOf", builtins::AddressOf },
+    { "keys", builtins::List_::Keys },
+    { "values", builtins::List_::Values },
+    { "global", builtins::Global },
+    { "recover", builtins::Recover },
+    { "BigInteger", builtins::BigInteger },
+    { "exit", builtins::Exit }
+};
+
+const std::map<std::string, std::vector<std::string>> builtinFuncParamsRegistry {
+    { "print" , { "_str" } },
+    { "println", { "_str" } },
+    { "typeof", { "_object" } },
+    { "len", { "_seq" } },
+    { "parseInt", { "_str" } },
+    { "parseFloat", { "_str" } },
+    { "str", { "_object" } },
+    { "eval", { "_code" } },
+    { "sin", { "_x" } },
+    { "cos", { "_x" } },
+    { "tan", { "_x" } },
+    { "abs", { "_x" } },
+    { "log", { "_x" } },
+    { "ln", { "_x" } },
+    { "sqrt", { "_x" } },
+    { "input", { "__prompt__" } },
+    { "import", { "_symbol" } },
+    { "set", { "_lst", "_idx", "_value" } },
+    { "require", { "_module" } },
+    { "readFile", { "_filename" } },
+    { "writeFile", { "_filename", "_str", "__mode__" } },
+    { "append", { "_lst", "_o" } },
+    { "concat", { "_lst1", "_lst2" } },
+    { "remove", { "_lst", "_idx" } },
+    { "panic", { "_err" } },
+    { "isFloating", { "_num" } },
+    { "isInteger", { "_num" } },
+    { "del", { "_varName" } },
+    { "range", { "_a", "__b__", "__c__" } },
+    { "addressOf", { "_object" } },
+    { "keys", { "_dict" } },
+    { "values", { "_dict" } },
+    { "global", { "_varName", "_value" } },
+    { "recover", { "__ret__" } },
+    { "BigInteger", { "__val__" } },
+    { "exit", { "__code__" } }
+};
+
+#ifdef __linux__
+    using DylibType = void *;
+#elif defined(_WIN32)
+    using DylibType = win32::HMODULE;
+#endif
+static std::map<std::string, std::pair<std::string, void *>> dynamicLoadedSymbol;
+std::map<std::string, DylibType> dylibs;
+std::map<std::string, builtins::YanModuleDeclearation> nativeModules;
+
+struct BuiltinFunction : public FunctionBase {
+    explicit BuiltinFunction(const std::string &name) : FunctionBase(name), Object(TypeTag::BuiltinFunction) {}
+    std::vector<std::string> argDeclearation;
+    bool dynamicBind = false;
+    builtins::BuiltinFunctionImplementation dynamicImpl = nullptr;
+
+    RuntimeResult Execute(std::vector<Object *> args, const CallSite &site) override {
+        RuntimeResult result;
+        auto frameContext = this->GenerateNewContext(site);
+        auto builtinFunctionName = this->functionName;
+        builtins::BuiltinFunctionImplementation func;
+
+        if (currentCallStackDepth > 1) {
+             currentCallStackDepth--; // built-in call does not take times of max calls
+        }
+        if (!this->dynamicBind) {
+            if (builtinFuncIndexes.find(builtinFunctionName) == builtinFuncIndexes.end()) {
+                if (dynamicLoadedSymbol.find(builtinFunctionName) != dynamicLoadedSymbol.end()) {
+                    func = (RuntimeResult (*)(Context *)) dynamicLoadedSymbol.at(builtinFunctionName).second;
+                } else {
+                    func = builtins::Invilid;
+                }
+            } else {
+                func = builtinFuncIndexes.at(builtinFunctionName);
+            }
+        } else {
+            func = this->dynamicImpl;
+        }
+        // std::cout << std::boolalpha << this->dynamicBind << std::endl;
+        assert(func != nullptr);
+
+        if (builtinFuncParamsRegistry.find(builtinFunctionName) != builtinFuncParamsRegistry.end() && this->argDeclearation.size() == 0) {
+            result.Register(this->CheckAndPopulate(builtinFuncParamsRegistry.at(builtinFunctionName), args, frameContext, site));
+        } else if (this->argDeclearation.size() != 0) {
+            if (this->argDeclearation.size() == 1) {
+                if (this->argDeclearation[0] == std::string("void")) {
+                    if (args.size() != 0) {
+                        result.Register(RuntimeResult().Failure(new RuntimeError(
+                            std::format("Function '{}' decleared as `void` should not take argument(s) [got {}]", functionName, args.size()),
+                            site.st, site.et, site.ctx
+                        )));
+                        return result;
+                    }
+                }
+            }
+            result.Register(this->CheckAndPopulate(this->argDeclearation, args, frameContext, site));
+        }
+        if (result.ShouldReturn()) {
+            return result;
+        }
+
+        auto returnValue = result.Register(func(frameContext));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        return result.Success(returnValue);
+    }
+
+    // Native functions report errors at their arguments and in their own frame, so shared immutable arguments
+    // are bound as copies positioned at the argument expression
+    Object *BindArgument(Object *value, std::size_t index, Context *execCtx, const CallSite &site) override {
+        if (IsMutableValue(value)) {
+            return value->SetContext(execCtx);
+        }
+        auto copy = value->Copy();
+        if (site.arguments != nullptr && index < site.arguments->size()) {
+            auto argNode = (*site.arguments)[index];
+            copy->SetPos(argNode->st, argNode->et);
+        }
+        return copy->SetContext(execCtx);
+    }
+
+    void Bind(const std::vector<std::string> &argDeclearation, builtins::BuiltinFunctionImplementation impl) {
+        this->dynamicBind = true;
+        this->argDeclearation = argDeclearation;
+        this->dynamicImpl = impl;
+    }
+
+    void Unbind() {
+        this->dynamicBind = false;
+        this->argDeclearation.clear();
+        this->dynamicImpl = nullptr;
+    }
+
+    RuntimeResult CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, const CallSite &site) override {
+        RuntimeResult result;
+        unsigned expectedMost = 0, expectedLeast = 0;
+        for (auto argName : argNames) {
+            expectedMost++;
+            if (!argName.starts_with("__") || !argName.ends_with("__")) {
+                expectedLeast++;
+            }
+        }
+
+        if (args.size() > expectedMost) {
+            return result.Failure(new TypeError(
+                std::format("Too many arguments given to function '{}' (Expected {} to {} args but got {})", this->functionName, expectedLeast, expectedMost, args.size()),
+                site.st, site.et, site.ctx
+            ));
+        } else if (args.size() < expectedLeast) {
+            return result.Failure(new TypeError(
+                std::format("Too few arguments given to function '{}' (Expected {} to {} args but got {})", this->functionName, expectedLeast, expectedMost, args.size()),
+                site.st, site.et, site.ctx
+            ));
+        }
+        return result.Success(nullptr);
+    }
+
+    Object *Copy() override {
+        auto copy = new BuiltinFunction(this->functionName);
+        copy->SetContext(this->ctx)->SetPos(this->startPos, this->endPos);
+        copy->argDeclearation = this->argDeclearation;
+        if (this->dynamicBind) {
+            copy->Bind(this->argDeclearation, this->dynamicImpl);
+        }
+        return copy;
+    }
+
+    inline std::string ToString() override {
+        if (!this->dynamicBind) {
+            return std::format("<builtin-function {} at {}>", this->functionName, (void *) this);
+        } else {
+            return std::format("<native-function {} at {}>", this->functionName, (void *) this);
+        }
+    }
+};
+
+YAN_C_API_START builtins::YanObject Class_Default__init__(builtins::YanContext ctx) {
+    auto self = ctx->symbols->Get("self");
+    auto requiredArgs = self->GetAttr("__ctor_args__");
+    if (requiredArgs.first->tag == TypeTag::Number) {
+        return RuntimeResult().Success(Number::null);
+    } else {
+        for (const auto item : As<List>(requiredArgs.first)->elements) {
+            auto attr = As<String>(item)->s;
+            auto value = ctx->symbols->Get(attr);
+            if (!value) {
+                return RuntimeResult().Failure(
+                    new TypeError(
+                        "Missing required constructor args",
+                        self->startPos, self->endPos, ctx
+                    )
+                );
+            }
+            self->SetAttr(attr, value);
+        }
+    }
+
+    return RuntimeResult().Success(Number::null);
+}
+YAN_C_API_END
+
+BuiltinFunction *defaultInitializer = nullptr;
+
+
+struct BuiltinMethod : public BuiltinFunction {
+    Object *self;
+
+    static BuiltinMethod *FromBuiltinFunction(BuiltinFunction *bf, Object *self) {
+        auto m = new BuiltinMethod(bf->functionName);
+        m->SetPos(bf->startPos, bf->endPos);
+        m->SetContext(bf->ctx);
+        m->self = self;
+        m->Bind(bf->argDeclearation, bf->dynamicImpl);
+        return m;
+    }
+
+    explicit BuiltinMethod(const std::string &name)
+        : BuiltinFunction(name), Object(TypeTag::BuiltinMethod) {}
+
+    RuntimeResult CheckArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, const CallSite &site) override {
+        RuntimeResult result;
+        if (args.size() + 1 != argNames.size()) {
+            return result.Failure(new RuntimeError(
+                std::format("Invilid arguments given to method '{}' (Expected {} but got {})", this->functionName, argNames.size() - 1, args.size()),
+                site.st, site.et, site.ctx
+            ));
+        }
+        return result.Success(nullptr);
+    }
+    
+    RuntimeResult PopulateArguments(const std::vector<std::string> &argNames, std::vector<Object *> &args, Context *execCtx, const CallSite &site) override {
+        if (argNames.size() == 0) {
+            return BuiltinFunction::PopulateArguments(argNames, args, execCtx, site);
+        }
+
+        execCtx->symbols->Set(argNames[0], this->self);
+        std::vector<std::string> remain;
+        for (int i = 1; i < argNames.size(); i++) {
+            remain.push_back(argNames[i]);
+        }
+
+        return BuiltinFunction::PopulateArguments(remain, args, execCtx, site);
+    }
+
+    Object *Copy() override {
+        auto copiedMethod = new BuiltinMethod(this->functionName);
+        copiedMethod->self = this->self;
+        copiedMethod->SetContext(this->ctx);
+        copiedMethod->SetPos(this->startPos, this->endPos);
+        copiedMethod->argDeclearation = this->argDeclearation;
+        if (this->dynamicBind) {
+            copiedMethod->Bind(this->argDeclearation, this->dynamicImpl);
+        }
+        return copiedMethod;
+    }
+
+    inline std::string ToString() override {
+        std::string tpName;
+        if (this->self->tag == TypeTag::ClassObject) {
+            tpName = As<ClassObject>(this->self)->className;
+        } else {
+            tpName = this->self->typeName;
+        }
+        return std::format("<bound-method {} at {} of object '{}' at {} (dynamically-binded)>", this->functionName, (void *) this, tpName, (void *) self);
+    }
+};
+
+Object *ClassObject::Instantiate(const std::vector<Object *> &args, Context *ctx, Position *st, Position *et) {
+    RuntimeResult result;
+    auto object = As<ClassObject>(this->Copy());
+    object->isProto = false;
+    auto ctor = this->GetAttr("__init__");
+    assert(ctor.first != nullptr);
+    auto unboundedCtor = As<BuiltinFunction>(ctor.first);
+    auto boundedCtor = BuiltinMethod::FromBuiltinFunction(unboundedCtor, object);
+
+    object->SetContext(ctx)->SetPos(st, et);
+    result.Register(boundedCtor->Execute(args, boundedCtor->Site()));
+    if (result.ShouldReturn()) {
+        std::cerr << "Internal interpreter error: " << result.error->name << ": " << result.error->details << std::endl;
+        std::cerr << "Native call stack traceback:" << std::endl << RuntimeError::GetNativeCallStackInfo() << std::endl;
+        assert(false);
+    }
+    return object;
+}
+
+static std::map<std::string, BuiltinFunction *> allBuiltins {
+    { "print", nullptr },
+    { "println", nullptr },
+    { "typeof", nullptr },
+    { "readLine", nullptr },
+    { "len", nullptr },
+    { "parseInt", nullptr },
+    { "parseFloat", nullptr },
+    { "str", nullptr },
+    { "eval", nullptr },
+    { "sin", nullptr },
+    { "cos", nullptr },
+    { "tan", nullptr },
+    { "abs", nullptr },
+    { "log", nullptr },
+    { "ln", nullptr },
+    { "sqrt", nullptr },
+    { "input", nullptr },
+    { "import", nullptr },
+    { "set", nullptr },
+    { "require", nullptr },
+    { "readFile", nullptr },
+    { "writeFile", nullptr },
+    { "append", nullptr },
+    { "concat", nullptr },
+    { "remove", nullptr },
+    { "builtins", nullptr },
+    { "del", nullptr },
+    { "range", nullptr },
+    { "addressOf", nullptr },
+    { "keys", nullptr }, 
+    { "values", nullptr },
+    { "global", nullptr },
+    { "recover", nullptr },
+    { "BigInteger", nullptr },
+    { "exit", nullptr }
+};
+
+DylibType OpenDynamicLibrary(const std::string &dylib) {
+    // not implemented
+    #ifdef __linux__
+        auto descr = dlopen(std::format("./yan-{}.so", dylib).c_str(), RTLD_LAZY);
+        if (descr == nullptr) {
+            descr = dlopen(std::format("{}/yan-{}.so", builtins::GetEnvVar("native-lib-path"), dylib).c_str(), RTLD_LAZY);
+            if (descr == nullptr) {
+                std::cerr << "Fatal: Dynamic lib '" + dylib << "' opened failed: " << dlerror() << std::endl;
+                return nullptr; 
+            }
+        }
+        return descr;
+    #elif defined(_WIN32)
+        auto s = std::format(".\\yan-{}.dll", dylib).c_str();
+        auto dll = win32::LoadLibrary(s);
+        if (dll == nullptr) {
+            s = std::format("{}\\yan-{}.dll", builtins::GetEnvVar("native-lib-path"), dylib).c_str();
+            dll = win32::LoadLibrary(s);
+            if (dll == nullptr) {
+                std::cerr << "Fatal: Dynamic lib '" + dylib << "' opened failed: [WinError " << win32::GetLastError() << "]" << std::endl;
+                return nullptr;
+            }
+        }
+        return dll;
+    #else
+        return nullptr;
+    #endif
+}
+
+
+YAN_C_API_START 
+    builtins::YanObject BigInt_ToString(builtins::YanContext ctx);
+YAN_C_API_END
+
+struct BigInt : public ClassObject {
+    BigInteger value;
+    BuiltinFunction *BigInt_ToStringFunc = nullptr;
+
+    explicit BigInt(BigInteger value) : ClassObject(ObjectMap()), value(value) {
+        this->SetTypeTag(TypeTag::BigInt);
+        this->BigInt_ToStringFunc = new BuiltinFunction("BigInt_ToString");
+        this->BigInt_ToStringFunc->Bind({ "self" }, BigInt_ToString);
+        this->SetAttr("toString", BuiltinMethod::FromBuiltinFunction(this->BigInt_ToStringFunc, this));
+    }
+
+    static RuntimeResult CheckType(Object *other) {
+        RuntimeResult result;
+        if (other->tag != TypeTag::Number && other->tag != TypeTag::BigInt && other->tag != TypeTag::String) {
+            return result.Failure(new TypeError(
+                std::format("Invilid operation with big integer with type `{}`", other->typeName),
+                other->startPos, other->endPos, other->ctx
+            ));
+        }
+        if (other->tag == TypeTag::Number) {
+            if (!builtins::Math::HoldsInteger(As<Number>(other))) {
+                return result.Failure(new TypeError(
+                    "BigInt could not resolve floating values",
+                    other->startPos, other->endPos, other->ctx
+                ));
+            }
+            return result.Success(new Number(1));
+        }
+        if (other->tag == TypeTag::BigInt) {
+            return result.Success(new Number(2));
+        }
+        return result.Success(new Number(3));
+    }
+
+    static RuntimeResult Create(Object *val) {
+        auto result = CheckType(val);
+        if (result.ShouldReturn()) {
+            return result;
+        }
+
+        auto v = result.value;
+        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
+            return result.Success(new BigInt(builtins::Math::GetInt(As<Number>(val))));
+        } else if (builtins::Math::GetInt(As<Number>(v)) == 2) {
+            return result.Success(new BigInt(As<BigInt>(val)->value));
+        } else {
+            return result.Success(new BigInt(As<String>(val)->s));
+        }
+    }
+
+    using ObjectWithError = std::pair<Object *, Error *>;
+    ObjectWithError AddTo(Object *other) override {
+        auto result = CheckType(other);
+        if (result.ShouldReturn()) {
+            return std::make_pair(nullptr, result.error);
+        }
+
+        auto v = result.value;
+        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
+            return std::make_pair(new BigInt(this->value + builtins::Math::GetInt(As<Number>(other))), nullptr);
+        } else {
+            return std::make_pair(new BigInt(this->value + As<BigInt>(other)->value), nullptr);
+        }
+    }
+
+    ObjectWithError SubstractedBy(Object *other) override {
+        auto result = CheckType(other);
+        if (result.ShouldReturn()) {
+            return std::make_pair(nullptr, result.error);
+        }
+
+        auto v = result.value;
+        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
+            return std::make_pair(new BigInt(this->value - builtins::Math::GetInt(As<Number>(other))), nullptr);
+        } else {
+            return std::make_pair(new BigInt(this->value - As<BigInt>(other)->value), nullptr);
+        }
+    }
+
+    ObjectWithError MultipliedBy(Object *other) override {
+        auto result = CheckType(other);
+        if (result.ShouldReturn()) {
+            return std::make_pair(nullptr, result.error);
+        }
+
+        auto v = result.value;
+        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
+            return std::make_pair(new BigInt(this->value * builtins::Math::GetInt(As<Number>(other))), nullptr);
+        } else {
+            return std::make_pair(new BigInt(this->value * As<BigInt>(other)->value), nullptr);
+        }
+    }
+
+    ObjectWithError DividedBy(Object *other) override {
+        auto result = CheckType(other);
+        if (result.ShouldReturn()) {
+            return std::make_pair(nullptr, result.error);
+        }
+
+        auto v = result.value;
+        if (builtins::Math::GetInt(As<Number>(v)) == 1) {
+            return std::make_pair(new BigInt(this->value / builtins::Math::GetInt(As<Number>(other))), nullptr);
+        } else {
+            return std::make_pair(new BigInt(this->value / As<BigInt>(other)->value), nullptr);
+        }
+    }
+
+    ObjectWithError GetCompEquals(Object *other) override {
+        if (other->tag != TypeTag::BigInt) {
+            return std::make_pair(new Number(0), nullptr);
+        } else if (other->tag == TypeTag::Number) {
+            if (!builtins::Math::HoldsInteger(As<Number>(other))) {
+                return std::make_pair(new Number(0), nullptr);
+            }
+            return std::make_pair(new Number(this->value == builtins::Math::GetInt(As<Number>(other))), nullptr);
+        }
+        return std::make_pair(new Number(this->value == As<BigInt>(other)->value), nullptr);
+    }
+
+    ObjectWithError GetCompNequals(Object *other) override {
+        auto result = this->GetCompEquals(other);
+        if (result.second) {
+            return std::make_pair(nullptr, result.second);
+        }
+        return std::make_pair(new Number((int) !result.first->AsBool()), nullptr);
+    }
+
+    std::string ToString() override {
+        std::stringstream ss;
+        ss << this->value;
+        return ss.str();
+    }
+
+    Object *Copy() override {
+        auto c = new BigInt(this->value);
+        return c; 
+    }
+};
+
+std::size_t ObjectMap::HashOf(Object *key) {
+    switch (key->tag) {
+        case TypeTag::String:
+            return SymbolHash(As<String>(key)->s);
+        case TypeTag::Number: {
+            // `1` and `1.0` are equal keys, integral doubles hash like the integer
+            auto &v = As<Number>(key)->value;
+            if (std::holds_alternative<int>(v)) {
+                return std::hash<long long>{}(std::get<int>(v));
+            }
+            auto d = std::get<double>(v);
+            if (d == std::trunc(d) && d >= INT_MIN && d <= INT_MAX) {
+                return std::hash<long long>{}(static_cast<long long>(d));
+            }
+            return std::hash<double>{}(d);
+        }
+        case TypeTag::BigInt: {
+            std::size_t hash = 0;
+            for (auto limb : As<BigInt>(key)->value.GetInternalValue()) {
+                hash = hash * 1000003 ^ std::hash<int>{}(limb);
+            }
+            return hash;
+        }
+        default:
+            return std::hash<Object *>{}(key);
+    }
+}
+
+bool ObjectMap::Equals(Object *a, Object *b) {
+    if (a == b) {
+        return true;
+    }
+    if (a->tag != b->tag) {
+        return false;
+    }
+    switch (a->tag) {
+        case TypeTag::String:
+            return As<String>(a)->s == As<String>(b)->s;
+        case TypeTag::Number: {
+            std::variant<int, double> equal;
+            Number::Compute(OperatorKind::Equal, As<Number>(a)->value, As<Number>(b)->value, equal);
+            return std::get<int>(equal) != 0;
+        }
+        case TypeTag::BigInt:
+            return As<BigInt>(a)->value == As<BigInt>(b)->value;
+        default:
+            return false;
+    }
+}
+
+bool ObjectMap::IsStringKey(Object *key, const std::string &s) {
+    return key->tag == TypeTag::String && As<String>(key)->s == s;
+}
+
+builtins::YanObject BigInt_ToString(builtins::YanContext ctx) {
+    RuntimeResult result;
+    auto self = ctx->symbols->Get("self");
+    assert(self->tag == TypeTag::BigInt && "Type mismatched: Internal interpreter error");
+    auto value = As<BigInt>(self);
+    auto v = value->value.GetInternalValue();
+    std::vector<std::string> tmp;
+    for (auto digit : v) {
+        tmp.push_back(std::to_string(digit));
+    }
+
+    std::reverse(tmp.begin(), tmp.end());
+    return result.Success(new String(Join(tmp, "")));
+}
+
+
+builtins::YanObject builtins::BigInteger(builtins::YanContext ctx) {
+    RuntimeResult result;
+    auto arg = ctx->symbols->Get("__val__");
+
+    Object *val = arg ? arg : Number::null;
+    auto r = result.Register(BigInt::Create(val));
+    if (result.ShouldReturn()) {
+        return result;
+    }
+    return result.Success(r);
+}
+
+auto LoadNativeFunctionImplementation(const std::string &dynamicLib, const std::string &name) -> RuntimeResult (*)(Context *) {
+    #ifdef __linux__
+        void *dylib = nullptr;
+        void *symbol = nullptr;
+        if (dylibs.find(dynamicLib) == dylibs.end()) {
+            dylib = OpenDynamicLibrary(dynamicLib);
+            dylibs.insert(std::make_pair(dynamicLib, dylib));
+        } else {
+            dylib = dylibs.at(dynamicLib);
+        }
+    #elif defined(_WIN32)
+        DylibType dylib = 0;
+        void *symbol = nullptr;
+        if (dylibs.find(dynamicLib) == dylibs.end()) {
+            dylib = OpenDynamicLibrary(dynamicLib);
+            dylibs.insert(std::make_pair(dynamicLib, dylib));
+        } else {
+            dylib = dylibs.at(dynamicLib);
+        }
+    #endif
+
+    assert(dylib != nullptr);
+    if (dynamicLoadedSymbol.find(name) == dynamicLoadedSymbol.end()) {
+        #ifdef __linux__
+            symbol = dlsym(dylib, name.c_str());
+            if (symbol == nullptr) {
+                std::cerr << "Fatal: Error locating symbol '" + name << "' in dynamic lib '" + dynamicLib + "': " << dlerror() << std::endl;
+                return nullptr;
+            }
+        #elif defined(_WIN32)
+            symbol = reinterpret_cast<void *>(win32::GetProcAddress(dylib, name.c_str()));
+             if (symbol == nullptr) {
+                std::cerr << "Fatal: Error locating symbol '" + name << "' in dynamic lib '" + dynamicLib + "': " << std::format("[WinError {}]", win32::GetLastError()) << std::endl;
+                return nullptr;
+            }
+        #endif
+        dynamicLoadedSymbol.insert(std::make_pair(name, std::make_pair(dynamicLib, symbol)));
+    }
+    if (nativeModules.find(dynamicLib) == nativeModules.end()) {
+        #ifdef __linux__
+            symbol = dlsym(dylib, "YanModule_OnLoad");
+            if (symbol == nullptr) {
+                std::cerr << "Fatal: Error locating onLoad() function of '" + dynamicLib + "'" << std::endl;
+                return nullptr;
+            }
+        #elif defined(_WIN32)
+            symbol = reinterpret_cast<void *>(win32::GetProcAddress(dylib, "YanModule_OnLoad"));
+                if (symbol == nullptr) {
+                std::cerr << "Fatal: Error locating onLoad() function of '" << dynamicLib + "': " << std::format("[WinError {}]", win32::GetLastError()) << std::endl;
+                return nullptr;
+            }
+        #endif
+        auto moduleDeclearation = ((builtins::ModuleLoaderFunc) symbol)();
+        nativeModules.insert(std::make_pair(dynamicLib, moduleDeclearation));
+    }
+
+    symbol = dynamicLoadedSymbol.at(name).second;
+    return (RuntimeResult (*)(Context *)) symbol;
+}
+
+builtins::YanObject builtins::_LoadNativeSymbol(const std::string &mod, const std::string &symbolName, Position *st, Position *et, builtins::YanContext ctx) {
+    auto symbol = LoadNativeFunctionImplementation(mod, symbolName);
+    auto func = new BuiltinFunction(symbolName);
+    func->SetPos(st, et)->SetContext(ctx);
+    auto modDec = nativeModules.at(mod);
+    if (modDec->functionArgumentDeclearation.find(symbolName) != modDec->functionArgumentDeclearation.end()) {
+        func->argDeclearation = modDec->functionArgumentDeclearation.at(symbolName);
+    }
+    return RuntimeResult().Success(func);
+}
+
+
+void InitializeBuiltins() {
+    for (auto builtinNames : builtinNames) {
+        // if (debug) {
+        //     std::cout << "[Debug Initalization] Initalizing builtin '" << builtinNames << "'" << std::endl;
+        // }
+        allBuiltins[builtinNames] = new BuiltinFunction(builtinNames);
+    }
+}
+
+void SetBuiltins(SymbolTable *global) {
+    for (auto [builtinName, o] : allBuiltins) {
+        global->Set(builtinName, o);
+    }
+}
+
+
+// Dispatches a binary operator to the left operand, shared by the tree-walking interpreter and the VM
+std::pair<Object *, Error *> ApplyBinaryOperator(OperatorKind op, Object *left, Object *right) {
+    switch (op) {
+        case OperatorKind::Add:
+            return left->AddTo(right);
+        case OperatorKind::Subtract:
+            return left->SubstractedBy(right);
+        case OperatorKind::Multiply:
+            return left->MultipliedBy(right);
+        case OperatorKind::Divide:
+            return left->DividedBy(right);
+        case OperatorKind::Power:
+            return left->PoweredBy(right);
+        case OperatorKind::Equal:
+            return left->GetCompEquals(right);
+        case OperatorKind::NotEqual:
+            return left->GetCompNequals(right);
+        case OperatorKind::Less:
+            return left->GetCompLt(right);
+        case OperatorKind::Greater:
+            return left->GetCompGt(right);
+        case OperatorKind::LessEqual:
+            return left->GetCompLte(right);
+        case OperatorKind::GreaterEqual:
+            return left->GetCompGte(right);
+        case OperatorKind::And:
+            return left->And(right);
+        case OperatorKind::Or:
+            return left->Or(right);
+        default:
+            return std::make_pair(nullptr, nullptr);
+    }
+}
+
+// Immutable operands may be shared with variables and keep the position and context they were created with. When
+// the operation fails on one, it is repeated on copies positioned at the operand expressions, so that the error
+// points at this expression as it did when every variable access returned a copy. Operators of immutable values
+// have no side effects, which makes the second attempt safe
+std::pair<Object *, Error *> ApplyBinaryOperator(NodeBase *node, Object *left, Object *right, Context *ctx) {
+    auto applied = ApplyBinaryOperator(node->op, left, right);
+    if (applied.second == nullptr || IsMutableValue(left)) {
+        return applied;
+    }
+    left = left->Copy()->SetPos(node->left->st, node->left->et)->SetContext(ctx);
+    if (!IsMutableValue(right)) {
+        right = right->Copy()->SetPos(node->right->st, node->right->et)->SetContext(ctx);
+    }
+    return ApplyBinaryOperator(node->op, left, right);
+}
+
+Interpreter::Interpreter() {
+    this->callStack = new std::vector<Context *>;
+}
+
+RuntimeResult Interpreter::Visit(NodeBase *node, Context *ctx) {
+    switch (node->nodeType) {
+        case NodeType::Expression:
+            return this->VisitExpression(node, ctx);
+        case NodeType::Number:
+            return this->VisitNumber(node, ctx);
+        case NodeType::SingleExpression:
+            return this->VisitSingleExpression(node, ctx);
+        case NodeType::VarAccess:
+            return this->VisitVarAccessNode(node, ctx);
+        case NodeType::VarAssign:
+            return this->VisitVarAssignNode(node, ctx);
+        case NodeType::IfExpression:
+            return this->VisitIfExpressionNode(node, ctx);
+        case NodeType::ForExpression:
+            return this->VisitForExpression(node, ctx);
+        case NodeType::WhileExpression:
+            return this->VisitWhileExpression(node, ctx);
+        case NodeType::FunctionDefinition:
+            return this->VisitFunctionDefinition(node, ctx);
+        case NodeType::FunctionCall:
+            return this->VisitFunctionCall(node, ctx);
+        case NodeType::String:
+            return this->VisitString(node, ctx);
+        case NodeType::List:
+            return this->VisitList(node, ctx);
+        case NodeType::Return:
+            return this->VisitReturn(node, ctx);
+        case NodeType::Continue:
+            return this->VisitContinue(node, ctx);
+        case NodeType::Break:
+            return this->VisitBreak(node, ctx);
+        case NodeType::Subscription:
+            return this->VisitSubscription(node, ctx);
+        case NodeType::Dictionary:
+            return this->VisitDictionary(node, ctx);
+        case NodeType::Attribution:
+            return this->VisitAttribution(node, ctx);
+        case NodeType::AdvancedVarAccess:
+            return this->VisitAdvancedVarAccess(node, ctx);
+        case NodeType::NewExpression:
+            return this->VisitNewExpression(node, ctx);
+        case NodeType::AttributionCall:
+            return this->VisitAttributionCall(node, ctx);
+        case NodeType::NonlocalStatement:
+            return this->VisitNonlocal(node, ctx);
+        case NodeType::Defer:
+            return this->VisitDefer(node, ctx);
+        case NodeType::StructDefStmt:
+            return this->VisitStructDef(node, ctx);
+        case NodeType::Invilid:
+            return this->VisitEmpty(node, ctx);
+    }
+    return RuntimeResult();
+}
+
+RuntimeResult Interpreter::VisitExpression(NodeBase *node, Context *ctx) {
+    RuntimeResult rtResult;        
+    auto r = rtResult.Register(this->Visit(node->left, ctx));
+    if (rtResult.ShouldReturn()) {
+        return rtResult;
+    }
+    // Number *left = dynamic_cast<Number *>(r);
+
+    auto rn = rtResult.Register(this->Visit(node->right, ctx));
+    if (rtResult.ShouldReturn()) {
+        return rtResult;
+    }
+    // Number *right = dynamic_cast<Number *>(rn);        
+
+    auto [result, error] = ApplyBinaryOperator(node, r, rn, ctx);
+    if (error != nullptr) {
+        return rtResult.Failure(error);
+    }
+    if (result == nullptr) {
+        return RuntimeResult();
+    }
+    return rtResult.Success(result->SetPos(node->st, node->et));
+}
+
+RuntimeResult Interpreter::VisitSingleExpression(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto op = NodeCast<UnaryOperationNode>(node);
+    auto o = result.Register(this->Visit(op->node, ctx));
+    if (result.ShouldReturn()) {
+        return result;
+    }
+    if (o->tag != TypeTag::Number) {
+        return result.Failure(new TypeError(
+            std::format("Unary operation '{}' is not supported on type '{}'", op->unaryOperator.ToString(), o->typeName),
+            node->st, node->et, ctx
+        ));
+    }
+    Number *num = dynamic_cast<Number *>(o);
+    if (result.ShouldReturn()) {
+        return result;
+    }
+
+    if (node->op == OperatorKind::Subtract) {
+        auto r = num->MultipliedBy(new Number(-1));
+        if (r.second != nullptr) {
+            return result.Failure(r.second);
+        } else {
+            num = dynamic_cast<Number *>(r.first);
+        }
+    } else if (node->op == OperatorKind::Not) {
+        auto r = num->Not();
+        if (r.second != nullptr) {
+            return result.Failure(r.second);
+        } else {
+            num = dynamic_cast<Number *>(r.first);
+        }
+    }
+    return result.Success(num->SetPos(op->st, op->et));
+}
+
+RuntimeResult Interpreter::VisitVarAccessNode(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto nd = NodeCast<VariableAccessNode>(node);
+    auto &variableName = *(std::string *) nd->variableNameToken.value;
+    auto value = ctx->symbols->Get(nd->layout, nd->slot, variableName, nd->hash, nd->cache);
+
+    if (value == nullptr) {
+        return result.Failure(new RuntimeError(
+            std::format("'{}' is not defined", variableName),
+            nd->st, nd->et, ctx
+        ));
+    }
+
+    // Immutable values are shared with the variable and left as they are, the consumer reports errors at its own
+    // position (see `CallSite` and `ApplyBinaryOperator`)
+    if (IsMutableValue(value)) {
+        value->SetPos(nd->st, nd->et)->SetContext(ctx);
+    }
+    return result.Success(value);
+}
+
+RuntimeResult Interpreter::VisitVarAssignNode(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto nd = NodeCast<VariableAssignNode>(node);
+    auto &variableName = *(std::string *) nd->variableNameToken.value;
+    auto variableValue = result.Register(this->Visit(nd->valueNode, ctx));
+    
+    if (result.ShouldReturn()) {
+        return result;
+    }
+
+    ctx->symbols->Set(nd->layout, nd->slot, variableName, nd->hash, variableValue);
+    return result.Success(variableValue);
+}
+
+RuntimeResult Interpreter::VisitNumber(NodeBase *node, Context *ctx) {
+    auto type = NodeCast<NumberNode>(node)->numberToken.type;
+    RuntimeResult result;
+    Number *num = nullptr;
+    if (type == TokenType::Int) {
+        num = new Number(*((int *) (NodeCast<NumberNode>(node)->numberToken.value)));
+        num->SetContext(ctx);
+    } else if (type == TokenType::Float) {
+        num = new Number(*((double *) (NodeCast<NumberNode>(node)->numberToken.value)));
+        num->SetContext(ctx);            
+    }
+    return result.Success(num->SetPos(NodeCast<NumberNode>(node)->st, NodeCast<NumberNode>(node)->et));
+}
+
+RuntimeResult Interpreter::VisitIfExpressionNode(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    assert(node->nodeType == NodeType::IfExpression);
+    auto ifNode = NodeCast<IfExpressionNode>(node);
+    for (auto [case_, shouldReturnNull] : ifNode->cases) {
+        auto conditionValue = result.Register(this->Visit(case_.first, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        if (conditionValue->AsBool()) {
+            auto exprValue = result.Register(this->Visit(case_.second, ctx));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+            return result.Success(shouldReturnNull ? Number::null : exprValue);
+        }
+    }
+
+    if (ifNode->elseCase.first != nullptr) {
+        auto elseValue = result.Register(this->Visit(ifNode->elseCase.first, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        return result.Success(ifNode->elseCase.second ? Number::null : elseValue);
+    }
+
+    return result.Success(Number::null);
+}
+
+RuntimeResult Interpreter::VisitForExpression(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    std::vector<Object *> elements;
+
+    assert(node->nodeType == NodeType::ForExpression);
+    auto forNode = NodeCast<ForExpressionNode>(node);
+    if (!forNode->rangeBasedLoop) {
+        Object *stepValue = nullptr;
+        auto stv = result.Register(this->Visit(forNode->stvNode, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+    
+        auto etv = result.Register(this->Visit(forNode->etvNode, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+    
+        if (forNode->stepvNode != nullptr) {
+            stepValue = result.Register(this->Visit(forNode->stepvNode, ctx));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+        } else {
+            stepValue = new Number(1);
+        }
+    
+        Number *i;
+        Number *stvNum = nullptr, *etvNum = nullptr, *stepNum = nullptr;
+        if (stv->tag == TypeTag::Number && stepValue->tag == TypeTag::Number && etv->tag == TypeTag::Number) {
+            stvNum = dynamic_cast<Number *>(stv);
+            stepNum = dynamic_cast<Number *>(stepValue);
+            etvNum = dynamic_cast<Number *>(etv);
+            i = new Number(stvNum->value);
+        } else {
+            return result.Failure(new TypeError(
+                std::format("For-loop expects 3 number but got ({}, {}, {})", stv->typeName, stepValue->typeName, etv->typeName),
+                node->st, node->et, ctx
+            ));
+        }
+    
+        std::function<bool()> condition;
+        if (stepNum->ntype == NumberType::Int && std::get<int>(stepNum->value) >= 0) {
+            condition = [&i, &etv]() {
+                return i->GetCompLt(etv).first->AsBool();
+            };
+        } else if (stepNum->ntype == NumberType::Int) {
+            condition = [&i, &etv]() {
+                return i->GetCompGt(etv).first->AsBool();
+            };
+        } else if (stepNum->ntype == NumberType::Float && std::get<double>(stepNum->value) >= 0) {
+            condition = [&i, &etv]() {
+                return i->GetCompLt(etv).first->AsBool();
+            };
+        } else {
+            condition = [&i, &etv]() {
+                return i->GetCompGt(etv).first->AsBool();
+            };
+        }
+    
+        while (condition()) {
+            ctx->symbols->Set(*(std::string *) forNode->var.value, i);
+            i = dynamic_cast<Number *>(i->AddTo(stepValue).first);
+            auto value = result.Register(this->Visit(forNode->body, ctx));
+            if (result.ShouldReturn() && !result.shouldContinue && !result.shouldBreak) {
+                return result;
+            }
+    
+            if (result.shouldContinue) {
+                continue;
+            }
+            if (result.shouldBreak) {
+                break;
+            }
+            elements.push_back(value);
+        }
+        ctx->symbols->Remove(*(std::string *) forNode->var.value);
+        return result.Success(forNode->shouldReturnNull ? Number::null : (new List(elements))->SetContext(ctx)->SetPos(node->st, node->et));
+    } else {
+        auto iterableRaw = result.Register(this->Visit(forNode->range, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        auto iteratorRaw = iterableRaw->Iter();
+        bool iterList = true;
+        if (iterableRaw->tag != TypeTag::List) {
+            iterList = false;
+            if (iteratorRaw.second != nullptr || iteratorRaw.first == nullptr) {
+                return result.Failure(new TypeError(
+                    std::format("Object '{}' is not iterable", iterableRaw->typeName),
+                    forNode->range->st, forNode->range->et, ctx
+                ));
+            }
+        }
+
+        if (iterList) {
+            auto iterable = As<List>(iterableRaw);
+            for (auto &i : iterable->elements) {
+                ctx->symbols->Set(*(std::string *) forNode->var.value, i);
+                auto value = result.Register(this->Visit(forNode->body, ctx));
+                if (result.ShouldReturn() && !result.shouldContinue && !result.shouldBreak) {
+                    return result;
+                }
+        
+                if (result.shouldContinue) {
+                    continue;
+                }
+                if (result.shouldBreak) {
+                    break;
+                }
+                elements.push_back(value);
+            }
+            ctx->symbols->Remove(*(std::string *) forNode->var.value);
+            return result.Success(forNode->shouldReturnNull ? Number::null : (new List(elements))->SetContext(ctx)->SetPos(node->st, node->et));
+        } else {
+            auto iterator = iteratorRaw.first;
+            std::pair<Object *, Error *> iterResultTmp { nullptr, nullptr };
+            iterResultTmp = iterator->Next();
+            while (iterResultTmp.second == nullptr) {
+                ctx->symbols->Set(*(std::string *) forNode->var.value, iterResultTmp.first);
+                auto value = result.Register(this->Visit(forNode->body, ctx));
+                if (result.ShouldReturn() && !result.shouldContinue && !result.shouldBreak) {
+                    return result;
+                }
+        
+                if (result.shouldContinue) {
+                    continue;
+                }
+                if (result.shouldBreak) {
+                    break;
+                }
+                elements.push_back(value);
+                iterResultTmp = iterator->Next();                      
+            }
+            ctx->symbols->Remove(*(std::string *) forNode->var.value);
+            delete iterator;
+            if (iterResultTmp.second->name != "StopIteration") {
+                return result.Failure(iterResultTmp.second);
+            }          
+            return result.Success(forNode->shouldReturnNull ? Number::null : (new List(elements))->SetContext(ctx)->SetPos(node->st, node->et));              
+        }
+    }
+}
+
+RuntimeResult Interpreter::VisitWhileExpression(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto whileNode = NodeCast<WhileExpressionNode>(node);
+
+    while (true) {
+        auto cond = result.Register(this->Visit(whileNode->conditionNode, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        if (!cond->AsBool()) {
+            break;
+        }
+        auto value = result.Register(this->Visit(whileNode->body, ctx));
+
+        if (result.ShouldReturn() && !result.shouldContinue && !result.shouldBreak) {
+            return result;
+        }
+        if (result.shouldContinue) {
+            continue;
+        }
+        if (result.shouldBreak) {
+            break;
+        }
+    }
+    return result.Success(Number::null);
+}
+
+RuntimeResult Interpreter::VisitFunctionDefinition(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto funcDefNode = NodeCast<FunctionDefinitionNode>(node);
+    auto funcBody = funcDefNode->body;
+    std::vector<std::string> parameters;
+    Function *function;
+
+    for (auto param : funcDefNode->parameters) {
+        parameters.push_back(*(std::string *) param.value);
+    }
+    // The function is created in (and will resolve names through) this frame
+    ctx->Capture();
+
+    if (funcDefNode->fun.type != TokenType::Invilid) {
+        function = dynamic_cast<Function *>((new Function(*(std::string *) funcDefNode->fun.value, funcBody, parameters, funcDefNode->shouldAutoReturn))->SetContext(ctx)->SetPos(node->st, node->et));
+        ctx->symbols->Set(*(std::string *) funcDefNode->fun.value, function);
+    } else {
+        function = dynamic_cast<Function *>((new Function(funcBody, parameters, funcDefNode->shouldAutoReturn))->SetContext(ctx)->SetPos(node->st, node->et));    
+    }
+
+    function->SetUnit(funcDefNode->unit);
+    function->layout = funcDefNode->layout;
+    for (auto &fv : funcDefNode->cellVars) {
+        function->cellVars.push_back(*(std::string *) fv->freeVar.value);
+    }
+
+        // FixMe: Fix REPEAT Code
+    if (ctx->parent != nullptr) {
+        for (auto &fv : funcDefNode->freeVars) {
+            auto fvName = *(std::string *) fv->freeVar.value;
+            auto fvValue = ctx->symbols->Get(fvName);
+            if (fvValue == nullptr) {
+                return result.Failure(new RuntimeError(
+                    std::format("'{}' is not a valid freevar", fvName),
+                    fv->st, fv->et, ctx
+                ));
+            }
+            function->closureVarsTable->Set(fvName, fvValue);
+        }
+    }
+    return result.Success(function);
+}
+
+RuntimeResult Interpreter::VisitFunctionCall(NodeBase *node, Context *ctx) {
+    if (overflowCount >= INVILID_OVERFLOW_TOLERANCE) {
+        std::cerr << "Fatal: Stack corrupted" << std::endl;
+        std::cerr << "[Native Stack Info]" << std::endl;
+        std::cerr << RuntimeError::GetNativeCallStackInfo() << std::endl;
+        assert(false);
+    }
+
+    RuntimeResult result;
+    auto funcCallNode = NodeCast<FunctionCallNode>(node);
+    std::vector<Object *> args;
+    currentCallStackDepth++;
+    if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
+        currentCallStackDepth = 0;
+        overflowCount++;    
+        return result.Failure(new RuntimeError(
+            std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
+            node->st, node->et, ctx
+        ));
+    }
+    
+    // if (ctx->interpreter) {
+    //     ctx->interpreter->callStack->push_back(ctx);
+    // }
+        
+    auto functionTarget = result.Register(this->Visit(funcCallNode->target, ctx));
+    if (result.ShouldReturn()) {
+        return result;
+    }
+    // Calling a class object instantiates it
+    if (functionTarget->tag == TypeTag::ClassObject) {
+        functionTarget = functionTarget->Copy();
+    }
+    // The callee is shared, not copied, it is told where it is called from
+    CallSite site { ctx, funcCallNode->target->st, funcCallNode->target->et, &funcCallNode->arguments };
+    
+    for (auto &arg : funcCallNode->arguments) {
+        args.push_back(result.Register(this->Visit(arg, ctx)));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+    }
+    
+    // if (functionTarget->tag != TypeTag::Function && functionTarget->tag != TypeTag::BuiltinFunction && functionTarget->tag != TypeTag::Method && functionTarget->tag != TypeTag::ClassObject && functionTarget->tag != TypeTag::BuiltinMethod) {
+    //     return result->Failure(new TypeError(
+    //         std::format("'{}' object is not callable", functionTarget->typeName),
+    //         node->st, node->et, ctx
+    //      ));
+    // } else {
+    Object *returnValue;
+    if (functionTarget->tag == TypeTag::Function) {
+        auto target = dynamic_cast<Function *>(functionTarget);
+        auto returnValueTmp = result.Register(target->Execute(args, site));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        returnValue = returnValueTmp;
+    } else if (functionTarget->tag == TypeTag::BuiltinFunction) {
+        auto returnValueTmp = result.Register((dynamic_cast<BuiltinFunction *>(functionTarget))->Execute(args, site));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        returnValue = returnValueTmp;
+    // } else if (functionTarget->tag == TypeTag::ClassObject) {
+    //     auto [ctor, error] = dynamic_cast<ClassObject *>(functionTarget)->GetAttr("__init__");
+    //     if (error != nullptr) {
+    //         return result->Failure(new TypeError(
+    //             std::format("Prototype of object '{}' has no constructor", As<ClassObject>(functionTarget)->className),
+    //             node->st, node->et, ctx
+    //         ));
+    //     }
+    //     if (ctor->tag != TypeTag::Function) {
+    //         return result->Failure(new TypeError(
+    //             "Constructor is not callable",
+    //             node->st, node->et, ctx
+    //         ));
+    //     }
+    //     auto returnValueTmp = functionTarget->Copy();
+    //     auto boundedCtor = Method::FromFunction(As<Function>(ctor), returnValueTmp, "__init__");
+    //     boundedCtor->SetPos(node->st, node->et)->SetContext(ctx);
+    //     result->Register(boundedCtor->Execute(args));
+    //     if (result->ShouldReturn()) {
+    //         return result;
+    //     }
+    //     As<ClassObject>(returnValueTmp)->isProto = false;
+    //     returnValue = returnValueTmp;
+    } else if (functionTarget->tag == TypeTag::ClassObject) {
+        currentCallStackDepth--;
+        return result.Success(functionTarget);
+    } else {
+        if (functionTarget->tag == TypeTag::Method) {
+            auto returnValueTmp = result.Register((dynamic_cast<Method *>(functionTarget))->Execute(args, site));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+            returnValue = returnValueTmp;
+        } else if (functionTarget->tag == TypeTag::BuiltinMethod) {
+            auto returnValueTmp = result.Register((dynamic_cast<BuiltinFunction *>(functionTarget))->Execute(args, site));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+            returnValue = returnValueTmp;
+        } else {
+            auto returnValueTmp = result.Register((functionTarget->Execute(args, site)));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+            returnValue = returnValueTmp;
+        }
+    }
+    
+    currentCallStackDepth--;
+    // Immutable values are returned as they are, they may be shared with a variable of the callee
+    if (IsMutableValue(returnValue)) {
+        returnValue = returnValue->Copy()->SetPos(node->st, node->et)->SetContext(ctx);
+    }
+    return result.Success(returnValue);
+    // }
+}
+
+RuntimeResult Interpreter::VisitNonlocal(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto nlNode = NodeCast<NonlocalStatementNode>(node);
+    auto fvName = *(std::string *) nlNode->freeVar.value;
+    auto fvValue = ctx->nonlocals->Get(fvName);
+
+    if (fvValue == nullptr) {
+        return result.Failure(new RuntimeError(
+            std::format("'{}' is not a valid cellvar", fvName),
+            node->st, node->et, ctx
+        ));
+    }
+    ctx->symbols->Set(fvName, fvValue);
+    return result.Success(Number::null);
+}
+
+RuntimeResult Interpreter::VisitString(NodeBase *node, Context *ctx) {
+    return RuntimeResult().Success(
+        (new String(*(std::string *) (NodeCast<StringNode>(node)->stringToken.value)))->SetContext(ctx)->SetPos(node->st, node->et)
+    );
+}
+
+RuntimeResult Interpreter::VisitList(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    std::vector<Object *> elements;
+    auto elementNodes = NodeCast<ListNode>(node);
+
+    for (auto elementNode : elementNodes->elements) {
+        elements.push_back(result.Register(this->Visit(elementNode, ctx)));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+    }
+    if (elementNodes->subscripting == nullptr) {
+        return result.Success((new List(elements))->SetContext(ctx)->SetPos(node->st, node->et));
+    } else {
+        auto idx = result.Register(this->Visit(elementNodes->subscripting, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        if (idx->tag != TypeTag::Number) {
+            return result.Failure(new TypeError(
+                "List subsciption takes an number", 
+                idx->startPos, idx->endPos, ctx
+            ));
+        }
+        auto indexNum = As<Number>(idx);
+        if (!builtins::Math::HoldsInteger(indexNum)) {
+            return result.Failure(new TypeError(
+                "List subsciption takes an integer", 
+                idx->startPos, idx->endPos, ctx
+            ));
+        }
+
+        auto indexReal = builtins::Math::GetInt(indexNum);
+        if (indexReal < 0) {
+            return result.Failure(new TypeError(
+                "List subsciption takes an non-negative integer", 
+                idx->startPos, idx->endPos, ctx
+            ));
+        }
+        if (indexReal > elements.size() - 1) {
+            return result.Failure(new RuntimeError(
+                std::format("List index out of range ({} > max: {})", indexReal, elements.size() - 1),
+                node->st, node->et, ctx
+            ));
+        }
+        if (elementNodes->newVal == nullptr) {
+            if (indexReal < elements.size() && indexReal >= 0) {
+                return result.Success(elements[indexReal]);
+            }
+            return result.Failure(new RuntimeError(
+                "List index out of range",
+                node->st, node->et, ctx
+            ));
+        } else {
+            return result.Failure(new ValueError(
+                "Assignment to literal",
+                node->st, node->et, ctx
+            ));
+        }
+    }
+}
+
+RuntimeResult Interpreter::VisitDictionary(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto dictNode = NodeCast<DictionaryNode>(node);
+    bool isClass = false;
+    bool hasCtor = false;
+    ObjectMap dict;
+    for (auto &[k, v] : dictNode->elements) {
+        auto kvalue = result.Register(this->Visit(k, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        if (kvalue->tag == TypeTag::String) {
+            if (As<String>(kvalue)->s == "__cls__") {
+                isClass = true;
+            } else if (As<String>(kvalue)->s == "__init__") {
+                hasCtor = true;
+            }
+        }
+        auto vvalue = result.Register(this->Visit(v, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        dict.Set(kvalue, vvalue);
+    }
+
+    if (isClass && !hasCtor) {
+        return result.Failure(new TypeError(
+            "Prototype of object '{}' should have a '__init__' as its constructor",
+            node->st, node->et, ctx
+        ));
+    }
+
+    if (!isClass) {
+        return result.Success((new Dictionary(std::move(dict)))->SetPos(node->st, node->et)->SetContext(ctx));
+    } else {
+        auto cls = new ClassObject(dict);
+        cls->SetPos(node->st, node->et)->SetContext(ctx);
+        result.Register(cls->BuildClass());
+        if (result.ShouldReturn()) {
+            return result;
+        }
+        return result.Success(cls);
+    }
+}
+
+Number *Number::null = new Number(0);
+
+// Number holding `v`, shared between callers for small ints. Only for values which are never handed out without a copy
+// (variables are read by copy), since positions and context of a shared Number belong to nobody
+Number *Number::Shared(const std::variant<int, double> &v) {
+    static Number *cache[SharedMax - SharedMin + 1] = {};
+    if (std::holds_alternative<int>(v)) {
+        auto i = std::get<int>(v);
+        if (i >= SharedMin && i <= SharedMax) {
+            auto &number = cache[i - SharedMin];
+            if (number == nullptr) {
+                number = new Number(i);
+            }
+            return number;
+        }
+    }
+    return new Number(v);
+}
+
+RuntimeResult Interpreter::VisitReturn(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto returnNode = NodeCast<ReturnStatementNode>(node);
+    // if (ctx->symbols->Get(ctx->ctxLabel) == nullptr) {
+    //     return result->Failure(new RuntimeError(
+    //         "'return' outside a user-defined function",
+    //         node->st, node->et, ctx
+    //     ));
+    // }
+    Object *value = nullptr;
+    if (returnNode->nodeToReturn != nullptr) {
+        value = result.Register(this->Visit(returnNode->nodeToReturn, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+    } else {
+        value = Number::null;
+    }
+    return result.SuccessReturn(value);
+}
+
+RuntimeResult Interpreter::VisitContinue(NodeBase *node, Context *ctx) {
+    return RuntimeResult().SuccessContinue();
+}
+
+RuntimeResult Interpreter::VisitBreak(NodeBase *node, Context *ctx) {
+    return RuntimeResult().SuccessBreak();
+}
+
+RuntimeResult Interpreter::VisitSubscription(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto subNode = NodeCast<SubscriptionNode>(node);
+    auto var = result.Register(this->Visit(subNode->target, ctx));
+    if (result.ShouldReturn()) {
+        return result;
+    }
+    auto indexValue = result.Register(this->Visit(subNode->index, ctx));
+    if (result.error != nullptr) {
+        return result;
+    }
+    
+    if (subNode->assignment == nullptr) {
+        auto v = var->Subsciption(indexValue);
+        if (v.second != nullptr) {
+            auto err = v.second;
+            err->st = node->st;
+            err->et = node->et;
+            ((RuntimeError *) err)->SetContext(ctx);
+            return result.Failure(err);
+        }
+        if (subNode->calls.find(0) == subNode->calls.end()) {   
+            if (subNode->subIndexes.size() == 0) {
+                return result.Success(v.first);
+            }
+        } else {
+            std::vector<Object *> args;
+            for (auto &&argNode : subNode->calls[0]) {
+                auto argValue = result.Register(this->Visit(argNode, ctx));
+                if (result.ShouldReturn()) {
+                    return result;
+                }
+                args.push_back(argValue);
+            }
+            auto ret = result.Register(v.first->Execute(args, v.first->Site()));
+            if (result.ShouldReturn()) {
+                result.error->st = node->st;
+                result.error->et = node->et;
+                return result;
+            }
+
+            if (subNode->subIndexes.size() == 0) {
+                return result.Success(ret);
+            }
+        }
+        
+        Object *tmp = v.first;
+        int index = 1;
+        for (auto i : subNode->subIndexes) {
+            auto sv = result.Register(this->Visit(i, ctx));
+            auto subsciptionLayerResult = tmp->Subsciption(sv);
+            if (subsciptionLayerResult.second != nullptr) {
+                auto err = subsciptionLayerResult.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+            if (subNode->calls.find(index) == subNode->calls.end()) {
+                tmp = subsciptionLayerResult.first->SetContext(ctx)->SetPos(node->st, node->et);;
+            } else {
+                std::vector<Object *> args;
+                for (auto &&argNode : subNode->calls[index]) {
+                    auto argValue = result.Register(this->Visit(argNode, ctx));
+                    if (result.ShouldReturn()) {
+                        return result;
+                    }
+                    args.push_back(argValue);
+                }
+
+                tmp = result.Register(subsciptionLayerResult.first->Execute(args, subsciptionLayerResult.first->Site()));
+                if (result.ShouldReturn()) {
+                    result.error->st = node->st;
+                    result.error->et = node->et;
+                    return result;
+                }
+            }
+        
+            index++;
+        }
+        return result.Success(tmp->SetContext(ctx)->SetPos(node->st, node->et));        
+    } else {        
+        auto newValue = result.Register(this->Visit(subNode->assignment, ctx));
+        if (result.error != nullptr) {
+            return result;
+        }
+
+        if (subNode->subIndexes.size() == 0 && subNode->calls.find(0) != subNode->calls.end()) {
+            return result.Failure(new RuntimeError(
+                "Unable to assign a new value to a function return value (rvalue)",
+                node->st, node->et, ctx
+            ));
+        }
+
+        if (subNode->calls.find(subNode->subIndexes.size()) != subNode->calls.end()) {
+            return result.Failure(new RuntimeError(
+                "Unable to assign a new value to a function return value (rvalue)",
+                node->st, node->et, ctx
+            ));
+        }
+
+        if (subNode->subIndexes.size() == 0) {
+            auto status = var->SubsciptionAssignment(indexValue, newValue);
+            if (status.second != nullptr) {
+                auto err = status.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+            return result.Success(Number::null);
+        } else {
+            auto v = var->Subsciption(indexValue);
+            if (v.second != nullptr) {
+                auto err = v.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+            if (subNode->subIndexes.size() == 0) {
+                return result.Success(v.first);
+            }
+            Object *tmp = v.first;
+
+            int index = 1;
+            for (unsigned i = 0; i < subNode->subIndexes.size() - 1; i++) {
+                auto sv = result.Register(this->Visit(subNode->subIndexes[i], ctx));
+                auto subsciptionLayerResult = tmp->Subsciption(sv);
+                if (subsciptionLayerResult.second != nullptr) {
+                    auto err = subsciptionLayerResult.second;
+                    err->st = node->st;
+                    err->et = node->et;
+                    ((RuntimeError *) err)->SetContext(ctx);
+                    return result.Failure(err);
+                }
+                if (subNode->calls.find(index) == subNode->calls.end()) {
+                    tmp = subsciptionLayerResult.first;
+                } else {
+                    std::vector<Object *> args;
+                    for (auto &&argNode : subNode->calls[index]) {
+                        auto argValue = result.Register(this->Visit(argNode, ctx));
+                        if (result.ShouldReturn()) {
+                            return result;
+                        }
+                        args.push_back(argValue);
+                    }
+
+                    tmp = result.Register(subsciptionLayerResult.first->Execute(args, subsciptionLayerResult.first->Site()));
+                    if (result.ShouldReturn()) {
+                        result.error->st = node->st;
+                        result.error->et = node->et;
+                        return result;
+                    }
+                }
+                index++;
+            }
+
+            auto lastIndex = result.Register(this->Visit(subNode->subIndexes[subNode->subIndexes.size() - 1], ctx));
+            if (result.error != nullptr) {
+                return result;
+            }
+            auto status = tmp->SubsciptionAssignment(lastIndex, newValue);
+            if (status.second != nullptr) {
+                auto err = status.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+            return result.Success(Number::null);
+        }
+    }
+}
+
+RuntimeResult Interpreter::VisitAttribution(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto attrNode = NodeCast<AttributionNode>(node);
+    auto var = result.Register(this->Visit(attrNode->target, ctx));
+    if (result.ShouldReturn()) {
+        return result;
+    }
+    auto attr = *(std::string *) attrNode->attr.value;
+    auto calls = attrNode->calls;
+    
+    auto TryGenerateMethod = [=, &result](Object *v, Object *self, const std::string attr) -> Object * {
+        if (v->tag == TypeTag::Function) {
+            if (As<Function>(v)->parameters.size() > 0) {
+                if (As<Function>(v)->parameters[0] == "self" || As<Function>(v)->parameters[0] == "this") {
+                    std::string pa {};
+                    if (self->tag == TypeTag::ClassObject) {
+                        pa = As<ClassObject>(self)->className;
+                    } else if (self->tag == TypeTag::Dictionary) {
+                        pa = "<anonymous>";
+                    }
+                    auto method = Method::FromFunction(As<Function>(v), self, pa + '.' + attr)->SetPos(node->st, node->et)->SetContext(ctx);    
+                    return method; 
+                }
+            }       
+        }
+        return v;
+    };
+
+    if (attrNode->assignment == nullptr) {
+        Object *v;
+        if (calls.find(0) != calls.end()) {
+            auto va = var->GetAttr(attr);
+            if (va.first == nullptr) {
+                return result.Failure(va.second);
+            }
+            (va.first)->SetContext(ctx)->SetPos(node->st, node->et);
+            ctx->symbols->Set(std::format("__@attrCall_{}__", *(std::string *) attrNode->attr.value), 
+                TryGenerateMethod(va.first, var, attr));
+            v = result.Register(this->Visit(calls[0], ctx));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+            v = v->SetContext(ctx)->SetPos(node->st, node->et);
+            if (attrNode->subAttrs.size() == 0) {
+                return result.Success(v);
+            }
+        } else {
+            auto vp = var->GetAttr(attr);
+            v = vp.first;        
+            if (vp.second != nullptr) {
+                auto err = vp.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+
+            if (attrNode->subAttrs.size() == 0) {
+                if (vp.first->tag == TypeTag::Function) {
+                    if (As<Function>(vp.first)->parameters.size() > 0) {
+                        if (As<Function>(vp.first)->parameters[0] == "self" || As<Function>(vp.first)->parameters[0] == "this") {
+                            auto method = Method::FromFunction(As<Function>(vp.first), var, attr);    
+                            return result.Success(method); 
+                        }
+                    }       
+                }
+                return result.Success(vp.first->SetContext(ctx)->SetPos(node->st, node->et));
+            }
+        }
+
+        Object *tmp = v;
+        Object *self = nullptr;
+        std::string ls {};
+        int callId = 1;
+        for (auto i : attrNode->subAttrs) {
+            auto subsciptionLayerResult = tmp->GetAttr(*(std::string *) i.value);
+            if (subsciptionLayerResult.second != nullptr) {
+                auto err = subsciptionLayerResult.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+            if (calls.find(callId) != calls.end()) {
+                (subsciptionLayerResult.first)->SetContext(ctx)->SetPos(node->st, node->et);
+                ctx->symbols->Set(std::format("__@attrCall_{}__", *(std::string *) i.value), 
+                    TryGenerateMethod(subsciptionLayerResult.first, tmp, *(std::string *) i.value));
+                auto layerResult = result.Register(this->Visit(calls[callId], ctx));
+                if (result.ShouldReturn()) {
+                    return result;
+                }
+                tmp = layerResult->SetContext(ctx)->SetPos(node->st, node->et);
+                
+            } else {
+                ls = *(std::string *) attrNode->subAttrs[attrNode->subAttrs.size() - 1].value;
+                if (*(std::string *) i.value == ls) {
+                    self = tmp;
+                }
+                tmp = subsciptionLayerResult.first->SetContext(ctx)->SetPos(node->st, node->et);
+            }
+            callId++;
+        }
+        // if (tmp->tag == TypeTag::Function) {
+        //    if (As<Function>(tmp)->parameters[0] == "self" || As<Function>(tmp)->parameters[0] == "this") {
+        //         auto method = Method::FromFunction(As<Function>(tmp), self, ls);    
+        //         return result->Success(method); 
+        //     }    
+        // }
+        return result.Success(tmp->SetContext(ctx)->SetPos(node->st, node->et));  
+    } else {
+        Object *v;
+        if (attrNode->calls.find(0) != attrNode->calls.end() && attrNode->subAttrs.empty()) {
+            return result.Failure(new RuntimeError(
+                "Unable to assign a new value to a function return value (rvalue)",
+                node->st, node->et, ctx
+            ));
+        }
+
+        if (attrNode->calls.find(attrNode->subAttrs.size()) != attrNode->calls.end()) {
+            return result.Failure(new RuntimeError(
+                "Unable to assign a new value to a function return value (rvalue)",
+                node->st, node->et, ctx
+            ));
+        }
+        
+        auto expr = result.Register(this->Visit(attrNode->assignment, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+
+        if (attrNode->calls.find(0) != attrNode->calls.end()) {
+            auto va = var->GetAttr(attr);
+            if (va.first == nullptr) {
+                return result.Failure(va.second);
+            }
+            (va.first)->SetContext(ctx)->SetPos(node->st, node->et);
+            ctx->symbols->Set(std::format("__@attrCall_{}__", *(std::string *) attrNode->attr.value), 
+                TryGenerateMethod(va.first, var, attr));
+            v = result.Register(this->Visit(calls[0], ctx));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+            v = v->SetContext(ctx)->SetPos(node->st, node->et);
+            if (attrNode->subAttrs.size() == 0) {
+                return result.Success(v);
+            }
+        } else {
+            auto vp = var->SetAttr(attr, expr);
+            v = vp.first;        
+            if (vp.second != nullptr) {
+                auto err = vp.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+
+            if (attrNode->subAttrs.size() == 0) {
+                if (vp.first->tag == TypeTag::Function) {
+                    if (As<Function>(vp.first)->parameters.size() > 0) {
+                        if (As<Function>(vp.first)->parameters[0] == "self" || As<Function>(vp.first)->parameters[0] == "this") {
+                            auto method = Method::FromFunction(As<Function>(vp.first), var, attr);    
+                            return result.Success(method); 
+                        }
+                    }       
+                }
+                return result.Success(vp.first->SetContext(ctx)->SetPos(node->st, node->et));
+            }
+        }
+        
+        if (attrNode->subAttrs.size() != 0) {
+            Object *tmp = v;
+            Object *self = nullptr;
+            std::string ls {};
+            int callId = 1;
+            for (auto i : attrNode->subAttrs) {
+                auto subsciptionLayerResult = tmp->GetAttr(*(std::string *) i.value);
+                if (subsciptionLayerResult.second != nullptr) {
+                    auto err = subsciptionLayerResult.second;
+                    err->st = node->st;
+                    err->et = node->et;
+                   ((RuntimeError *) err)->SetContext(ctx);            
+                    return result.Failure(err);
+                }
+                if (calls.find(callId) != calls.end()) {
+                    ctx->symbols->Set(std::format("__@attrCall_{}__", *(std::string *) i.value), 
+                        TryGenerateMethod(subsciptionLayerResult.first, tmp, *(std::string *) i.value));
+                    auto layerResult = result.Register(this->Visit(calls[callId], ctx));
+                    if (result.ShouldReturn()) {
+                        return result;
+                    }
+                    tmp = layerResult;
+                } else {
+                    ls = *(std::string *) attrNode->subAttrs[attrNode->subAttrs.size() - 1].value;
+                    if (*(std::string *) i.value == ls) {
+                        self = tmp;
+                    }
+                    tmp = subsciptionLayerResult.first;
+                }
+                callId++;
+            }
+
+            auto r = self->SetAttr(*(std::string *) attrNode->subAttrs[attrNode->subAttrs.size() - 1].value, expr);
+            if (r.second != nullptr) {
+                auto err = r.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+            return result.Success(Number::null);
+        } else {
+            auto rv = var->SetAttr(attr, expr);
+            if (rv.second != nullptr) {
+                auto err = rv.second;
+                err->st = node->st;
+                err->et = node->et;
+                ((RuntimeError *) err)->SetContext(ctx);
+                return result.Failure(err);
+            }
+            return result.Success(Number::null);
+        }
+    }
+}
+
+RuntimeResult Interpreter::VisitAttributionCall(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto callNode = NodeCast<AttributionCallNode>(node);
+    std::vector<Object *> args;
+
+    auto callv = std::format("__@attrCall_{}__", *(std::string *) NodeCast<VariableAccessNode>(callNode->call->target)->variableNameToken.value);
+    auto o = ctx->symbols->Get(callv);
+    if (o == nullptr) {
+        std::cerr << "Internal interpreter error: Couldn't get attribution call" << std::endl;
+        std::cerr << "Native call stack traceback:" << std::endl << RuntimeError::GetNativeCallStackInfo() << std::endl;
+        assert(false);
+    }
+
+    currentCallStackDepth++;
+    if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
+        std::cout << currentCallStackDepth << std::endl;
+        currentCallStackDepth = 0;
+        return result.Failure(new RuntimeError(
+            std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
+            node->st, node->et, ctx
+        ));
+    }
+
+     for (auto &arg : callNode->call->arguments) {
+        auto v1 = result.Register(this->Visit(arg, ctx));
+        if (v1 != nullptr && IsMutableValue(v1)) {
+            v1->SetPos(node->st, node->et)->SetContext(ctx);
+        }
+        args.push_back(v1);
+        if (result.ShouldReturn()) {
+            result.error->st = node->st;
+            result.error->et = node->et;
+            ((RuntimeError *) result.error)->SetContext(ctx);
+            return result;
+        }
+    }
+
+    auto v = result.Register(o->Execute(args, CallSite { o->ctx, o->startPos, o->endPos, &callNode->call->arguments }));
+    if (result.ShouldReturn()) {
+        return result;
+    }
+    
+    ctx->symbols->Remove(callv);
+    currentCallStackDepth--;
+    if (IsMutableValue(v)) {
+        v->SetContext(ctx)->SetPos(node->st, node->et);
+    }
+    return result.Success(v);
+}
+
+RuntimeResult Interpreter::VisitAdvancedVarAccess(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto avNode = NodeCast<AdvancedVarAccessNode>(node);
+    Object *tmp = nullptr;
+
+    for (auto &accessNode : avNode->advancedAccess) {        
+        tmp = result.Register(this->Visit(accessNode, ctx));
+        if (result.ShouldReturn()) {
+            return result;
+        }
+    }
+    return result.Success(tmp->SetContext(ctx)->SetPos(node->st, node->et)); 
+}
+
+RuntimeResult Interpreter::VisitNewExpression(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    auto newNode = NodeCast<NewExprNode>(node);
+    std::vector<Object *> args;
+    currentCallStackDepth++;
+    if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
+        currentCallStackDepth = 0;
+        return result.Failure(new RuntimeError(
+            std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
+            node->st, node->et, ctx
+        ));
+    }
+    
+    if (newNode->newExpr->nodeType == NodeType::FunctionCall) {
+         for (auto &arg : NodeCast<FunctionCallNode>(newNode->newExpr)->arguments) {
+            args.push_back(result.Register(this->Visit(arg, ctx)));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+        }
+    }
+
+    if (newNode->newExpr->nodeType == NodeType::AdvancedVarAccess) {
+        auto access = NodeCast<AdvancedVarAccessNode>(newNode->newExpr)->advancedAccess;
+        auto call = access[access.size() - 1];
+        if (call->nodeType != NodeType::Attribution) {
+            // std::cerr << "Fatal: Interpreter state error [While instantiating objects: 'invilid node']" << std::endl;
+            // std::cerr << "Native call stack traceback:" << std::endl << RuntimeError::GetNativeCallStackInfo() << std::endl;        
+            // assert(false); 
+            return result.Failure(new RuntimeError(
+                "Invilid access for object prototypes: without attribute access",
+                call->st, call->et, ctx
+            ));
+        }
+
+        auto caller = NodeCast<AttributionNode>(call)->calls;
+        if (caller.size() > 1) {
+            // std::cerr << "Fatal: Interpreter state error [While instantiating objects: 'invalid call']" << std::endl;
+            // std::cerr << "Native call stack traceback:" << std::endl << RuntimeError::GetNativeCallStackInfo() << std::endl;        
+            // assert(false);
+            return result.Failure(new RuntimeError(
+                "Invilid access for object prototypes: with dynamic function call",
+                call->st, call->et, ctx
+            ));
+        } else if (caller.size() == 0) {
+            goto instantiate;
+        }
+
+        std::vector<int> positions;
+        for (const auto &[idx, call] : caller) {
+            positions.emplace_back(idx);
+        }
+
+        // get the last call
+        AttributionCallNode *nd = NodeCast<AttributionCallNode>(caller[*std::max_element(positions.begin(), positions.end())]);
+        
+        for (auto &arg : nd->call->arguments) {
+            args.push_back(result.Register(this->Visit(arg, ctx)));
+            if (result.ShouldReturn()) {
+                return result;
+            }
+        }
+
+        for (auto n : NodeCast<AdvancedVarAccessNode>(newNode->newExpr)->advancedAccess) {
+            if (n->nodeType == NodeType::Attribution) {
+                NodeCast<AttributionNode>(n)->calls.clear();
+            }
+        }
+    }
+
+instantiate:
+    auto functionTarget = result.Register(this->Visit(newNode->newExpr, ctx));
+
+    if (result.ShouldReturn()) {
+        return result;
+    }
+    if (functionTarget->tag != TypeTag::ClassObject) {
+        return result.Failure(new TypeError(
+            "Keyword 'new' requires a constructor call",
+            functionTarget->startPos, functionTarget->endPos, ctx
+        ));
+    }
+
+    auto [ctor, error] = dynamic_cast<ClassObject *>(functionTarget)->GetAttr("__init__");
+    if (error != nullptr) {
+        return result.Failure(new TypeError(
+            std::format("Prototype of object '{}' has no constructor", As<ClassObject>(functionTarget)->className),
+            node->st, node->et, ctx
+        ));
+    }
+    if (ctor->tag != TypeTag::Function && ctor->tag != TypeTag::BuiltinFunction && ctor->tag != TypeTag::BuiltinMethod) {
+        return result.Failure(new TypeError(
+            "Constructor is not callable",
+            node->st, node->et, ctx
+        ));
+    }
+    auto returnValueTmp = functionTarget->Copy();
+    // auto returnValueTmp = functionTarget;
+    Object *boundedCtor = nullptr; 
+    if (ctor->tag == TypeTag::Function) {
+        boundedCtor = Method::FromFunction(As<Function>(ctor), returnValueTmp, std::format("{}.__init__", dynamic_cast<ClassObject *>(functionTarget)->className));
+    } else if (ctor->tag == TypeTag::BuiltinFunction) {
+        if (As<BuiltinFunction>(ctor)->dynamicImpl == nullptr) {
+            return result.Failure(new RuntimeError(
+                "Failed to construct object with invilid native constructor",
+                node->st, node->et, ctx
+            ));    
+        }
+        boundedCtor = BuiltinMethod::FromBuiltinFunction(As<BuiltinFunction>(ctor), returnValueTmp);
+    } else {
+        boundedCtor = ctor;
+        // TODO: Deprecated & danger operation note: Modification to linked object of a bounded method
+        As<BuiltinMethod>(boundedCtor)->self = returnValueTmp;
+    }
+    // boundedCtor->SetPos(node->st, node->et)->SetContext(ctx);
+    result.Register(boundedCtor->Execute(args, CallSite { boundedCtor->ctx, node->st, node->et }));
+    if (result.ShouldReturn()) {
+        result.error->st = node->st;
+        result.error->et = node->et;
+        return result.Failure(result.error);
+    }
+    As<ClassObject>(returnValueTmp)->isProto = false;
+    auto returnValue = returnValueTmp;
+    currentCallStackDepth--;
+    return result.Success(returnValue);
+}
+
+[[noreturn]] RuntimeResult Interpreter::VisitEmpty(NodeBase *node, Context *ctx) {
+    std::cerr << "Fatal: Invilid node" << std::endl;
+    assert(false);
+}
+
+RuntimeResult Interpreter::VisitDefer(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+    // auto currentFrame = ctx->symbols->Get(ctx->ctxLabel);
+    // if (currentFrame == nullptr) {
+    //     return result->Failure(new RuntimeError(
+    //         "'defer' statement outside a valid frame",
+    //         node->st, node->et, ctx
+    //     ));
+    // }
+    currentCallStackDepth++;
+    // if (currentFrame->tag != TypeTag::Function && currentFrame->tag != TypeTag::Method) {
+    //     return result->Failure(new RuntimeError(
+    //         "frame is not callable",
+    //         node->st, node->et, ctx
+    //     ));
+    // }
+
+    if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
+        currentCallStackDepth = 0;
+        return result.Failure(new RuntimeError(
+            std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
+            node->st, node->et, ctx
+        ));
+    }
+    
+    ctx->deferNodes.push_back(node);
+    return result.Success(Number::null);
+}
+
+RuntimeResult Interpreter::VisitStructDef(NodeBase *node, Context *ctx) {
+    RuntimeResult result;
+
+    auto defNode = NodeCast<StructDefStmtNode>(node);
+    auto structName = *(std::string *) defNode->structName.value;
+    
+    Object *ctorList = Number::null;
+    if (!defNode->args.empty()) {
+        std::vector<Object *> v;
+        for (const auto &p : defNode->args) {
+            v.push_back(new String(*(std::string *) p.value));
+        }
+        ctorList = new List(v);
+    }
+    
+    auto Class = new ClassObject({
+        { new String("__cls__"), new String(structName) },
+        { new String("__ctor_args__"), ctorList },
+        { new String("__init__"), Number::null }
+    });
+
+    // Here is a temproarily bind of method
+    if (defNode->args.empty()) {
+        Class->SetAttr("__init__", BuiltinMethod::FromBuiltinFunction(defaultInitializer, Class));
+    } else {
+        auto customCtor = new BuiltinFunction(std::format("{}__init__", structName));
+        std::vector<std::string> argList = { "self" };
+        for (const auto &p : defNode->args) {
+            argList.push_back(*(std::string *) p.value);
+        }
+        customCtor->Bind(argList, Class_Default__init__);
+        Class->SetAttr("__init__", BuiltinMethod::FromBuiltinFunction(customCtor, Class));
+    }
+    result.Register(Class->BuildClass());
+    if (result.ShouldReturn()) {
+        return result;
+    }
+    Class->SetPos(node->st, node->et)->SetContext(ctx);
+    ctx->Capture();
+    ctx->symbols->Set(structName, Class);
+    return result.Success(Number::null);
+}
+
+Interpreter::~Interpreter() = default;
+
+
+// ------------------------------------------------------------------------------------------------
+// Bytecode engine (`yan --engine=vm`)
+//
+// `BytecodeCompiler` lowers a script or a function body to a flat instruction array, `VirtualMachine`
+// runs it with an operand stack and without a `RuntimeResult` per node. Variables still live in the
+// context's symbol tables, so compiled code and the tree-walking interpreter can be mixed freely:
+// nodes without a dedicated instruction (attribution, subscription, dictionaries, `new`, function
+// definitions, ...) are compiled to `Eval` which hands the subtree back to `Interpreter::Visit`.
+// Numbers stay unboxed on the operand stack and in numeric `for` counters, they are only turned into
+// `Number` objects (`Box`) where a value leaves the VM: stores, calls, lists, returns.
+// ------------------------------------------------------------------------------------------------
+
+// Threaded dispatch through a label table where the compiler supports it, define YAN_VM_SWITCH_DISPATCH to force the portable switch
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(YAN_VM_SWITCH_DISPATCH)
+    #define YAN_VM_COMPUTED_GOTO
+#endif
+
+#define YAN_VM_OPCODES(X) \
+    X(PushNumber) X(PushString) X(PushNull) X(Pop) \
+    X(Load) X(Store) X(Binary) X(Unary) X(MakeList) \
+    X(GetAttr) X(GetMethod) X(GetCallee) X(SetAttr) X(GetItem) X(SetItem) \
+    X(Jump) X(JumpIfFalse) X(EnterCall) X(Call) X(CallAttr) X(Eval) \
+    X(ForPrep) X(ForNext) X(IterPrep) X(IterNext) X(Append) X(LoopEnd) \
+    X(Break) X(Continue) X(Return) X(Halt) X(Box)
+
+enum class OpCode : std::uint8_t {
+    #define YAN_VM_OPCODE_ENUM(name) name,
+    YAN_VM_OPCODES(YAN_VM_OPCODE_ENUM)
+    #undef YAN_VM_OPCODE_ENUM
+};
+
+struct Instruction {
+    OpCode op;
+    std::uint16_t loop;  // innermost enclosing loop + 1 (0 outside loops), receives break / continue signals
+    std::int32_t a;      // jump target, element / argument count or index of a variable name
+    NodeBase *node;      // source node: literals, positions for errors and subtrees for `Eval`
+};
+
+struct LoopInfo {
+    std::int32_t breakTarget;
+    std::int32_t continueTarget;
+    std::int32_t depth;  // operand stack height inside the body
+    bool collect;        // `for` whose value is used: body values are gathered into a list
+    const std::string *variable;
+};
+
+// Instructions evaluating the arguments of an attribute call
+struct CallArguments {
+    std::int32_t begin;
+    std::int32_t end;
+    NodeBase *call;
+};
+
+struct Chunk final {
+    std::vector<Instruction> code;
+    std::vector<const std::string *> names;
+    std::vector<LoopInfo> loops;
+    std::vector<CallArguments> attributeCalls;
+    std::size_t maxStack = 0;
+};
+
+// NaN-boxed operand stack slot: a double as is, or an int / an object pointer in the payload of a quiet NaN
+class Value final {
+public:
+    Value() : bits(ObjectTag) {}
+
+    static inline Value FromDouble(double v) {
+        return Value(v != v ? CanonicalNaN : std::bit_cast<std::uint64_t>(v));
+    }
+
+    static inline Value FromInt(int v) {
+        return Value(IntTag | static_cast<std::uint32_t>(v));
+    }
+
+    static inline Value FromObject(Object *o) {
+        return Value(ObjectTag | reinterpret_cast<std::uintptr_t>(o));
+    }
+
+    static inline Value FromNumber(const std::variant<int, double> &v) {
+        return std::holds_alternative<int>(v) ? FromInt(std::get<int>(v)) : FromDouble(std::get<double>(v));
+    }
+
+    inline bool IsInt() const { return (this->bits & TagMask) == IntTag; }
+    inline bool IsObject() const { return (this->bits & ObjectTag) == ObjectTag; }
+    inline bool IsDouble() const { return (this->bits & QuietNaN) != QuietNaN; }
+
+    inline int AsInt() const { return static_cast<int>(static_cast<std::uint32_t>(this->bits)); }
+    inline double AsDouble() const { return std::bit_cast<double>(this->bits); }
+    inline Object *AsObject() const { return reinterpret_cast<Object *>(this->bits & PointerMask); }
+
+    inline std::variant<int, double> AsNumber() const {
+        if (this->IsInt()) {
+            return this->AsInt();
+        }
+        return this->AsDouble();
+    }
+
+    inline bool AsBool() const {
+        if (this->IsInt()) {
+            return this->AsInt() != 0;
+        } else if (this->IsDouble()) {
+            return this->AsDouble() != 0.0;
+        }
+        return this->AsObject()->AsBool();
+    }
+
+private:
+    static constexpr std::uint64_t QuietNaN = 0x7ffc000000000000ull;
+    static constexpr std::uint64_t CanonicalNaN = 0x7ff8000000000000ull;
+    static constexpr std::uint64_t TagMask = 0xffff000000000000ull;
+    static constexpr std::uint64_t IntTag = QuietNaN | (1ull << 48);
+    static constexpr std::uint64_t ObjectTag = QuietNaN | (1ull << 63);
+    static constexpr std::uint64_t PointerMask = ~ObjectTag;
+
+    explicit Value(std::uint64_t bits) : bits(bits) {}
+    std::uint64_t bits;
+};
+
+
+class BytecodeCompiler final {
+public:
+    explicit BytecodeCompiler(Chunk *chunk) : chunk(chunk), depth(0) {}
+
+    // `keepValue` decides whether the value of `node` is returned by `Halt` (REPL / auto-return bodies)
+    void CompileBody(NodeBase *node, bool keepValue) {
+        if (keepValue) {
+            this->CompileBoxed(node);
+        } else {
+            this->Compile(node, false);
+        }
+        this->Emit(OpCode::Halt, nullptr, keepValue);
+    }
+
+private:
+    Chunk *chunk;
+    std::int32_t depth;
+    std::vector<std::uint16_t> activeLoops;
+
+    std::int32_t Emit(OpCode op, NodeBase *node = nullptr, std::int32_t a = 0) {
+        std::uint16_t loop = this->activeLoops.empty() ? 0 : this->activeLoops.back();
+        this->chunk->code.push_back(Instruction { op, loop, a, node });
+        return static_cast<std::int32_t>(this->chunk->code.size() - 1);
+    }
+
+    inline std::int32_t Here() const {
+        return static_cast<std::int32_t>(this->chunk->code.size());
+    }
+
+    inline void Patch(std::int32_t at) {
+        this->chunk->code[at].a = this->Here();
+    }
+
+    void Push(std::int32_t n = 1) {
+        this->depth += n;
+        if (this->depth > static_cast<std::int32_t>(this->chunk->maxStack)) {
+            this->chunk->maxStack = this->depth;
+        }
+    }
+
+    std::int32_t Name(const Token &tk) {
+        this->chunk->names.push_back((std::string *) tk.value);
+        return static_cast<std::int32_t>(this->chunk->names.size() - 1);
+    }
+
+    std::uint16_t NewLoop(const std::string *variable, bool collect) {
+        this->chunk->loops.push_back(LoopInfo { -1, -1, this->depth, collect, variable });
+        return static_cast<std::uint16_t>(this->chunk->loops.size());
+    }
+
+    inline LoopInfo &Loop(std::uint16_t id) {
+        return this->chunk->loops[id - 1];
+    }
+
+    void Discard(bool keepValue) {
+        if (!keepValue) {
+            this->Emit(OpCode::Pop);
+            this->depth--;
+        }
+    }
+
+    void Fallback(NodeBase *node, bool keepValue) {
+        this->Emit(OpCode::Eval, node);
+        this->Push();
+        this->Discard(keepValue);
+    }
+
+    // Numbers, variables and operator expressions may leave an unboxed number on the stack
+    static bool MayLeaveUnboxed(NodeBase *node) {
+        switch (node->nodeType) {
+            case NodeType::Number:
+            case NodeType::VarAccess:
+            case NodeType::SingleExpression:
+                return true;
+            case NodeType::Expression:
+                return node->op != OperatorKind::None && node->op != OperatorKind::Not;
+            default:
+                return false;
+        }
+    }
+
+    // For values that escape the VM (stored, passed, collected or returned), which must be objects.
+    // `stored` values only go to a variable (and are read back by copy), small ints among them are not allocated
+    void CompileBoxed(NodeBase *node, bool stored = false) {
+        this->Compile(node, true);
+        if (MayLeaveUnboxed(node)) {
+            this->Emit(OpCode::Box, node, stored);
+        }
+    }
+
+    // Branch bodies of `if` and loops declared with a block evaluate to null
+    void CompileBranch(NodeBase *node, bool keepValue, bool returnsNull) {
+        if (keepValue && returnsNull) {
+            this->Compile(node, false);
+            this->Emit(OpCode::PushNull);
+            this->Push();
+        } else if (keepValue) {
+            this->CompileBoxed(node);
+        } else {
+            this->Compile(node, false);
+        }
+    }
+
+    void Compile(NodeBase *node, bool keepValue) {
+        switch (node->nodeType) {
+            case NodeType::Number:
+                if (keepValue) {
+                    this->Emit(OpCode::PushNumber, node);
+                    this->Push();
+                }
+                return;
+            case NodeType::String:
+                if (keepValue) {
+                    this->Emit(OpCode::PushString, node);
+                    this->Push();
+                }
+                return;
+            case NodeType::Expression:
+                if (node->op == OperatorKind::None || node->op == OperatorKind::Not) {
+                    return this->Fallback(node, keepValue);
+                }
+                this->Compile(node->left, true);
+                this->Compile(node->right, true);
+                this->Emit(OpCode::Binary, node);
+                this->depth--;
+                return this->Discard(keepValue);
+            case NodeType::SingleExpression:
+                this->Compile(NodeCast<UnaryOperationNode>(node)->node, true);
+                this->Emit(OpCode::Unary, node);
+                return this->Discard(keepValue);
+            case NodeType::VarAccess:
+                this->Emit(OpCode::Load, node, this->Name(NodeCast<VariableAccessNode>(node)->variableNameToken));
+                this->Push();
+                return this->Discard(keepValue);
+            case NodeType::VarAssign: {
+                auto assignNode = NodeCast<VariableAssignNode>(node);
+                this->CompileBoxed(assignNode->valueNode, !keepValue);
+                this->Emit(OpCode::Store, node, this->Name(assignNode->variableNameToken));
+                return this->Discard(keepValue);
+            }
+            case NodeType::List: {
+                auto listNode = NodeCast<ListNode>(node);
+                if (listNode->subscripting != nullptr) {
+                    return this->Fallback(node, keepValue);
+                }
+                for (auto element : listNode->elements) {
+                    if (keepValue) {
+                        this->CompileBoxed(element);
+                    } else {
+                        this->Compile(element, false);
+                    }
+                }
+                if (keepValue) {
+                    this->Emit(OpCode::MakeList, node, static_cast<std::int32_t>(listNode->elements.size()));
+                    this->depth -= static_cast<std::int32_t>(listNode->elements.size());
+                    this->Push();
+                }
+                return;
+            }
+            case NodeType::AdvancedVarAccess: {
+                // Every access of the chain is evaluated in turn (with its side effects), like the tree walker does
+                auto &accesses = NodeCast<AdvancedVarAccessNode>(node)->advancedAccess;
+                for (std::size_t i = 0; i < accesses.size(); i++) {
+                    this->Compile(accesses[i], keepValue && i + 1 == accesses.size());
+                }
+                return;
+            }
+            case NodeType::Attribution:
+                return this->CompileAttribution(NodeCast<AttributionNode>(node), keepValue);
+            case NodeType::Subscription:
+                return this->CompileSubscription(NodeCast<SubscriptionNode>(node), keepValue);
+            case NodeType::IfExpression:
+                return this->CompileIf(NodeCast<IfExpressionNode>(node), keepValue);
+            case NodeType::WhileExpression:
+                return this->CompileWhile(NodeCast<WhileExpressionNode>(node), keepValue);
+            case NodeType::ForExpression:
+                return this->CompileFor(NodeCast<ForExpressionNode>(node), keepValue);
+            case NodeType::FunctionCall: {
+                auto callNode = NodeCast<FunctionCallNode>(node);
+                this->Emit(OpCode::EnterCall, node);
+                this->CompileBoxed(callNode->target);
+                for (auto arg : callNode->arguments) {
+                    this->CompileBoxed(arg);
+                }
+                this->Emit(OpCode::Call, node, static_cast<std::int32_t>(callNode->arguments.size()));
+                this->depth -= static_cast<std::int32_t>(callNode->arguments.size());
+                return this->Discard(keepValue);
+            }
+            case NodeType::Return: {
+                auto returnNode = NodeCast<ReturnStatementNode>(node);
+                if (returnNode->nodeToReturn != nullptr) {
+                    this->CompileBoxed(returnNode->nodeToReturn);
+                } else {
+                    this->Emit(OpCode::PushNull);
+                    this->Push();
+                }
+                this->Emit(OpCode::Return, node);
+                this->depth--;
+                break;
+            }
+            case NodeType::Break:
+                this->Emit(OpCode::Break, node);
+                break;
+            case NodeType::Continue:
+                this->Emit(OpCode::Continue, node);
+                break;
+            default:
+                return this->Fallback(node, keepValue);
+        }
+        // `return`, `break` and `continue` never fall through, pretend they produced a value so the
+        // (unreachable) code after them still sees a consistent stack height
+        if (keepValue) {
+            this->Push();
+        }
+    }
+
+    void CompileAttribution(AttributionNode *attrNode, bool keepValue) {
+        if (attrNode->assignment != nullptr) {
+            // Chained assignments and assignments through calls are left to the tree walker
+            if (!attrNode->calls.empty() || !attrNode->subAttrs.empty()) {
+                return this->Fallback(attrNode, keepValue);
+            }
+            this->CompileBoxed(attrNode->target);
+            this->CompileBoxed(attrNode->assignment);
+            this->Emit(OpCode::SetAttr, attrNode, this->Name(attrNode->attr));
+            this->depth--;
+            return this->Discard(keepValue);
+        }
+
+        this->CompileBoxed(attrNode->target);
+        if (attrNode->calls.empty() && attrNode->subAttrs.empty()) {
+            this->Emit(OpCode::GetMethod, attrNode, this->Name(attrNode->attr));
+            return this->Discard(keepValue);
+        }
+        this->CompileAttributeLayer(attrNode, attrNode->attr, 0);
+        for (std::size_t i = 0; i < attrNode->subAttrs.size(); i++) {
+            this->CompileAttributeLayer(attrNode, attrNode->subAttrs[i], static_cast<int>(i + 1));
+        }
+        this->Discard(keepValue);
+    }
+
+    // `.name` or `.name(...)` at `layer` of an attribution chain, replaces the object on top of the stack
+    void CompileAttributeLayer(AttributionNode *attrNode, const Token &name, int layer) {
+        auto call = attrNode->calls.find(layer);
+        if (call == attrNode->calls.end()) {
+            this->Emit(OpCode::GetAttr, attrNode, this->Name(name));
+            return;
+        }
+        auto &arguments = NodeCast<AttributionCallNode>(call->second)->call->arguments;
+        this->Emit(OpCode::GetCallee, attrNode, this->Name(name));
+        this->Emit(OpCode::EnterCall, call->second);
+        auto begin = this->Here();
+        for (auto arg : arguments) {
+            this->CompileBoxed(arg);
+        }
+        this->chunk->attributeCalls.push_back(CallArguments { begin, this->Here(), call->second });
+        this->Emit(OpCode::CallAttr, call->second, static_cast<std::int32_t>(arguments.size()));
+        this->depth -= static_cast<std::int32_t>(arguments.size());
+    }
+
+    void CompileSubscription(SubscriptionNode *subNode, bool keepValue) {
+        // Calls on subscripted values and chained assignments are left to the tree walker
+        if (!subNode->calls.empty() || (subNode->assignment != nullptr && !subNode->subIndexes.empty())) {
+            return this->Fallback(subNode, keepValue);
+        }
+        this->CompileBoxed(subNode->target);
+        this->CompileBoxed(subNode->index);
+        if (subNode->assignment != nullptr) {
+            this->CompileBoxed(subNode->assignment);
+            this->Emit(OpCode::SetItem, subNode);
+            this->depth -= 2;
+            return this->Discard(keepValue);
+        }
+        this->Emit(OpCode::GetItem, subNode, 0);
+        this->depth--;
+        for (auto subIndex : subNode->subIndexes) {
+            this->CompileBoxed(subIndex);
+            this->Emit(OpCode::GetItem, subNode, 1);
+            this->depth--;
+        }
+        this->Discard(keepValue);
+    }
+
+    void CompileIf(IfExpressionNode *ifNode, bool keepValue) {
+        std::vector<std::int32_t> exits;
+        for (auto &[case_, returnsNull] : ifNode->cases) {
+            this->Compile(case_.first, true);
+            auto skip = this->Emit(OpCode::JumpIfFalse);
+            this->depth--;
+            this->CompileBranch(case_.second, keepValue, returnsNull);
+            exits.push_back(this->Emit(OpCode::Jump));
+            if (keepValue) {
+                this->depth--;
+            }
+            this->Patch(skip);
+        }
+        if (ifNode->elseCase.first != nullptr) {
+            this->CompileBranch(ifNode->elseCase.first, keepValue, ifNode->elseCase.second);
+        } else if (keepValue) {
+            this->Emit(OpCode::PushNull);
+            this->Push();
+        }
+        for (auto exit : exits) {
+            this->Patch(exit);
+        }
+    }
+
+    void CompileWhile(WhileExpressionNode *whileNode, bool keepValue) {
+        auto loop = this->NewLoop(nullptr, false);
+        this->Loop(loop).continueTarget = this->Here();
+        this->Compile(whileNode->conditionNode, true);
+        auto exit = this->Emit(OpCode::JumpIfFalse);
+        this->depth--;
+
+        this->activeLoops.push_back(loop);
+        this->Compile(whileNode->body, false);
+        this->activeLoops.pop_back();
+
+        this->Emit(OpCode::Jump, nullptr, this->Loop(loop).continueTarget);
+        this->Patch(exit);
+        this->Loop(loop).breakTarget = this->Here();
+        if (keepValue) {
+            this->Emit(OpCode::PushNull);
+            this->Push();
+        }
+    }
+
+    void CompileFor(ForExpressionNode *forNode, bool keepValue) {
+        bool collect = keepValue && !forNode->shouldReturnNull;
+        if (!forNode->rangeBasedLoop) {
+            this->CompileBoxed(forNode->stvNode);
+            this->CompileBoxed(forNode->etvNode);
+            std::int32_t operands = 2;
+            if (forNode->stepvNode != nullptr) {
+                this->CompileBoxed(forNode->stepvNode);
+                operands++;
+            }
+            this->depth -= operands;
+        } else {
+            this->CompileBoxed(forNode->range);
+            this->depth--;
+        }
+
+        auto loop = this->NewLoop((std::string *) forNode->var.value, collect);
+        this->activeLoops.push_back(loop);
+        this->Emit(forNode->rangeBasedLoop ? OpCode::IterPrep : OpCode::ForPrep, forNode);
+        this->Loop(loop).continueTarget = this->Emit(forNode->rangeBasedLoop ? OpCode::IterNext : OpCode::ForNext, forNode);
+        if (collect) {
+            this->CompileBoxed(forNode->body);
+            this->Emit(OpCode::Append, forNode);
+            this->depth--;
+        } else {
+            this->Compile(forNode->body, false);
+        }
+        this->Emit(OpCode::Jump, nullptr, this->Loop(loop).continueTarget);
+        this->Loop(loop).breakTarget = this->Emit(OpCode::LoopEnd, forNode);
+        this->activeLoops.pop_back();
+        this->Push();
+        this->Discard(keepValue);
+    }
+};
+
+
+class VirtualMachine final {
+public:
+    explicit VirtualMachine(Interpreter *interpreter) : interpreter(interpreter) {}
+    RuntimeResult Run(const Chunk *chunk, Context *ctx);
+
+private:
+    Interpreter *interpreter;
+
+    // Objects of the `count` values at `from`. Computed gotos do not run destructors, so the result must only be used
+    // as a temporary (a local vector alive at `VM_DISPATCH` would leak)
+    static std::vector<Object *> Operands(const Value *from, std::int32_t count) {
+        std::vector<Object *> objects(count);
+        for (std::int32_t k = 0; k < count; k++) {
+            objects[k] = from[k].AsObject();
+        }
+        return objects;
+    }
+
+    // Reports `error` at `node`, like the tree walker does for failed attribute and subscription accesses
+    static Error *Locate(Error *error, NodeBase *node, Context *ctx = nullptr) {
+        error->st = node->st;
+        error->et = node->et;
+        if (ctx != nullptr) {
+            ((RuntimeError *) error)->SetContext(ctx);
+        }
+        return error;
+    }
+
+    // Errors raised while the arguments of an attribute call are evaluated are reported at that call, like
+    // `Interpreter::VisitAttributionCall` does (the outermost one when calls are nested)
+    static void Relocate(const Chunk *chunk, const Instruction *at, Error *error, Context *ctx) {
+        auto offset = static_cast<std::int32_t>(at - chunk->code.data());
+        const CallArguments *outermost = nullptr;
+        for (auto &call : chunk->attributeCalls) {
+            if (call.begin <= offset && offset < call.end && (outermost == nullptr || call.begin < outermost->begin)) {
+                outermost = &call;
+            }
+        }
+        if (outermost != nullptr) {
+            VirtualMachine::Locate(error, outermost->call, ctx);
+        }
+    }
+
+    // Functions whose first parameter is `self` / `this` are bound to the object they are read from
+    static bool TakesSelf(Object *value) {
+        if (value->tag != TypeTag::Function) {
+            return false;
+        }
+        auto &parameters = As<Function>(value)->parameters;
+        return !parameters.empty() && (parameters[0] == "self" || parameters[0] == "this");
+    }
+
+    // Runtime state of one loop of the running chunk
+    struct LoopState {
+        std::variant<int, double> i;
+        std::variant<int, double> end;
+        std::variant<int, double> step;
+        bool ascending;
+        List *list;
+        std::size_t index;
+        Object *iterator;
+        Error *error;
+        std::vector<Object *> collected;
+    };
+};
+
+RuntimeResult VirtualMachine::Run(const Chunk *chunk, Context *ctx) {
+    // The operand stack of most chunks fits on the native stack, so a call allocates nothing here
+    constexpr std::size_t InlineStackSize = 32;
+    Value inlineStack[InlineStackSize];
+    std::vector<Value> stackStorage;
+    Value *stack = inlineStack;
+    if (static_cast<std::size_t>(chunk->maxStack) + 1 > InlineStackSize) {
+        stackStorage.resize(chunk->maxStack + 1);
+        stack = stackStorage.data();
+    }
+    std::vector<LoopState> loops(chunk->loops.size());
+    Value *sp = stack;
+    const Instruction *code = chunk->code.data();
+    const Instruction *ip = code;
+    const Instruction *ins = nullptr;
+    RuntimeResult signal;
+
+#ifdef YAN_VM_COMPUTED_GOTO
+    static void *dispatchTable[] = {
+        #define YAN_VM_OPCODE_LABEL(name) &&Op_##name,
+        YAN_VM_OPCODES(YAN_VM_OPCODE_LABEL)
+        #undef YAN_VM_OPCODE_LABEL
+    };
+    #define VM_CASE(name) Op_##name
+    #define VM_DISPATCH() do { ins = ip++; goto *dispatchTable[static_cast<std::size_t>(ins->op)]; } while (0)
+    #define VM_FAIL(error) do { signal = RuntimeResult().Failure(error); goto deliver; } while (0)
+    VM_DISPATCH();
+#else
+    #define VM_CASE(name) case OpCode::name
+    #define VM_DISPATCH() continue
+    #define VM_FAIL(error) do { signal = RuntimeResult().Failure(error); goto deliver; } while (0)
+    for (;;) {
+        ins = ip++;
+        switch (ins->op) {
+#endif
+
+    VM_CASE(PushNumber): {
+        auto numberNode = NodeCast<NumberNode>(ins->node);
+        if (numberNode->numberToken.type == TokenType::Int) {
+            *sp++ = Value::FromInt(*((int *) numberNode->numberToken.value));
+        } else {
+            *sp++ = Value::FromDouble(*((double *) numberNode->numberToken.value));
+        }
+        VM_DISPATCH();
+    }
+
+    VM_CASE(PushString): {
+        auto stringNode = NodeCast<StringNode>(ins->node);
+        *sp++ = Value::FromObject((new String(*(std::string *) stringNode->stringToken.value))->SetContext(ctx)->SetPos(stringNode->st, stringNode->et));
+        VM_DISPATCH();
+    }
+
+    VM_CASE(PushNull): {
+        *sp++ = Value::FromObject(Number::null);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Pop): {
+        sp--;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Load): {
+        auto nd = static_cast<VariableAccessNode *>(ins->node);
+        auto value = ctx->symbols->Get(nd->layout, nd->slot, *chunk->names[ins->a], nd->hash, nd->cache);
+        if (value == nullptr) {
+            VM_FAIL(new RuntimeError(
+                std::format("'{}' is not defined", *chunk->names[ins->a]),
+                ins->node->st, ins->node->et, ctx
+            ));
+        }
+        if (value->tag == TypeTag::Number) {
+            // Loaded by value, `Box` materializes a `Number` again if it escapes
+            *sp++ = Value::FromNumber(static_cast<Number *>(value)->value);
+            VM_DISPATCH();
+        }
+        // Same as `Interpreter::VisitVarAccessNode`: shared immutable values are left as they are
+        if (IsMutableValue(value)) {
+            value->SetPos(ins->node->st, ins->node->et)->SetContext(ctx);
+        }
+        *sp++ = Value::FromObject(value);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Store): {
+        auto nd = static_cast<VariableAssignNode *>(ins->node);
+        ctx->symbols->Set(nd->layout, nd->slot, *chunk->names[ins->a], nd->hash, sp[-1].AsObject());
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Binary): {
+        auto right = *--sp;
+        auto left = sp[-1];
+        if (!left.IsObject() && !right.IsObject()) {
+            std::variant<int, double> result;
+            if (!Number::Compute(ins->node->op, left.AsNumber(), right.AsNumber(), result)) {
+                VM_FAIL(new RuntimeError("Division by zero", ins->node->right->st, ins->node->right->et, ctx));
+            }
+            sp[-1] = Value::FromNumber(result);
+            VM_DISPATCH();
+        }
+        auto boxedLeft = left.IsObject() ? left.AsObject() : (new Number(left.AsNumber()))->SetContext(ctx)->SetPos(ins->node->left->st, ins->node->left->et);
+        auto boxedRight = right.IsObject() ? right.AsObject() : (new Number(right.AsNumber()))->SetContext(ctx)->SetPos(ins->node->right->st, ins->node->right->et);
+        auto [value, error] = ApplyBinaryOperator(ins->node, boxedLeft, boxedRight, ctx);
+        if (error != nullptr) {
+            VM_FAIL(error);
+        }
+        sp[-1] = Value::FromObject(value->SetPos(ins->node->st, ins->node->et));
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Unary): {
+        auto op = NodeCast<UnaryOperationNode>(ins->node);
+        if (!sp[-1].IsObject()) {
+            std::variant<int, double> result = sp[-1].AsNumber();
+            if (op->op == OperatorKind::Subtract) {
+                Number::Compute(OperatorKind::Multiply, sp[-1].AsNumber(), -1, result);
+            } else if (op->op == OperatorKind::Not) {
+                result = (int) !sp[-1].AsBool();
+            }
+            sp[-1] = Value::FromNumber(result);
+            VM_DISPATCH();
+        }
+        auto o = sp[-1].AsObject();
+        if (o->tag != TypeTag::Number) {
+            VM_FAIL(new TypeError(
+                std::format("Unary operation '{}' is not supported on type '{}'", op->unaryOperator.ToString(), o->typeName),
+                op->st, op->et, ctx
+            ));
+        }
+        auto num = dynamic_cast<Number *>(o);
+        std::pair<Object *, Error *> r { num, nullptr };
+        if (op->op == OperatorKind::Subtract) {
+            r = num->MultipliedBy(new Number(-1));
+        } else if (op->op == OperatorKind::Not) {
+            r = num->Not();
+        }
+        if (r.second != nullptr) {
+            VM_FAIL(r.second);
+        }
+        sp[-1] = Value::FromObject(r.first->SetPos(op->st, op->et));
+        VM_DISPATCH();
+    }
+
+    VM_CASE(MakeList): {
+        sp -= ins->a;
+        auto list = new List(Operands(sp, ins->a));
+        *sp++ = Value::FromObject(list->SetContext(ctx)->SetPos(ins->node->st, ins->node->et));
+        VM_DISPATCH();
+    }
+
+    VM_CASE(GetAttr): {
+        auto [value, error] = sp[-1].AsObject()->GetAttr(*chunk->names[ins->a]);
+        if (error != nullptr) {
+            VM_FAIL(VirtualMachine::Locate(error, ins->node, ctx));
+        }
+        sp[-1] = Value::FromObject(value->SetContext(ctx)->SetPos(ins->node->st, ins->node->et));
+        VM_DISPATCH();
+    }
+
+    VM_CASE(GetMethod): {
+        auto self = sp[-1].AsObject();
+        auto &attr = *chunk->names[ins->a];
+        auto [value, error] = self->GetAttr(attr);
+        if (error != nullptr) {
+            VM_FAIL(VirtualMachine::Locate(error, ins->node, ctx));
+        }
+        if (VirtualMachine::TakesSelf(value)) {
+            sp[-1] = Value::FromObject(Method::FromFunction(As<Function>(value), self, attr));
+        } else {
+            sp[-1] = Value::FromObject(value->SetContext(ctx)->SetPos(ins->node->st, ins->node->et));
+        }
+        VM_DISPATCH();
+    }
+
+    // Same as the `__@attrCall_...__` lookup of `Interpreter::VisitAttribution`, without going through the symbol table
+    VM_CASE(GetCallee): {
+        auto self = sp[-1].AsObject();
+        auto &attr = *chunk->names[ins->a];
+        auto [value, error] = self->GetAttr(attr);
+        if (value == nullptr) {
+            VM_FAIL(error);
+        }
+        value->SetContext(ctx)->SetPos(ins->node->st, ins->node->et);
+        if (VirtualMachine::TakesSelf(value)) {
+            std::string owner;
+            if (self->tag == TypeTag::ClassObject) {
+                owner = As<ClassObject>(self)->className;
+            } else if (self->tag == TypeTag::Dictionary) {
+                owner = "<anonymous>";
+            }
+            value = Method::FromFunction(As<Function>(value), self, owner + '.' + attr)->SetPos(ins->node->st, ins->node->et)->SetContext(ctx);
+        }
+        sp[-1] = Value::FromObject(value);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(SetAttr): {
+        auto newValue = (--sp)->AsObject();
+        auto [status, error] = sp[-1].AsObject()->SetAttr(*chunk->names[ins->a], newValue);
+        if (error != nullptr) {
+            VM_FAIL(VirtualMachine::Locate(error, ins->node, ctx));
+        }
+        sp[-1] = Value::FromObject(status);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(GetItem): {
+        auto index = (--sp)->AsObject();
+        auto [value, error] = sp[-1].AsObject()->Subsciption(index);
+        if (error != nullptr) {
+            VM_FAIL(VirtualMachine::Locate(error, ins->node, ctx));
+        }
+        sp[-1] = Value::FromObject(ins->a ? value->SetContext(ctx)->SetPos(ins->node->st, ins->node->et) : value);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(SetItem): {
+        auto newValue = (--sp)->AsObject();
+        auto index = (--sp)->AsObject();
+        auto [status, error] = sp[-1].AsObject()->SubsciptionAssignment(index, newValue);
+        if (error != nullptr) {
+            VM_FAIL(VirtualMachine::Locate(error, ins->node, ctx));
+        }
+        sp[-1] = Value::FromObject(Number::null);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Jump): {
+        ip = code + ins->a;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(JumpIfFalse): {
+        if (!(*--sp).AsBool()) {
+            ip = code + ins->a;
+        }
+        VM_DISPATCH();
+    }
+
+    VM_CASE(EnterCall): {
+        if (overflowCount >= INVILID_OVERFLOW_TOLERANCE) {
+            std::cerr << "Fatal: Stack corrupted" << std::endl;
+            std::cerr << "[Native Stack Info]" << std::endl;
+            std::cerr << RuntimeError::GetNativeCallStackInfo() << std::endl;
+            assert(false);
+        }
+        currentCallStackDepth++;
+        if (currentCallStackDepth >= MAX_CALLSTACK_DEPTH) {
+            currentCallStackDepth = 0;
+            overflowCount++;
+            VM_FAIL(new RuntimeError(
+                std::format("Maximum call stack depth ({}) exceeded, recompile the source and change MAX_CALLSTACK_DEPTH to extend stack capacity", MAX_CALLSTACK_DEPTH),
+                ins->node->st, ins->node->et, ctx
+            ));
+        }
+        VM_DISPATCH();
+    }
+
+    // Same as `Interpreter::VisitFunctionCall`
+    VM_CASE(Call): {
+        sp -= ins->a;
+        auto callNode = NodeCast<FunctionCallNode>(ins->node);
+        auto target = sp[-1].AsObject();
+        if (target->tag == TypeTag::ClassObject) {
+            sp[-1] = Value::FromObject(target->Copy());
+            currentCallStackDepth--;
+            VM_DISPATCH();
+        }
+        auto callResult = target->Execute(
+            Operands(sp, ins->a),
+            CallSite { ctx, callNode->target->st, callNode->target->et, &callNode->arguments }
+        );
+        if (callResult.ShouldReturn()) {
+            signal = callResult;
+            goto deliver;
+        }
+        currentCallStackDepth--;
+        auto returnValue = callResult.value;
+        if (IsMutableValue(returnValue)) {
+            returnValue = returnValue->Copy()->SetPos(ins->node->st, ins->node->et)->SetContext(ctx);
+        }
+        sp[-1] = Value::FromObject(returnValue);
+        VM_DISPATCH();
+    }
+
+    // Call of a callee pushed by `GetCallee`, same as `Interpreter::VisitAttributionCall`
+    VM_CASE(CallAttr): {
+        sp -= ins->a;
+        auto callee = sp[-1].AsObject();
+        auto callResult = callee->Execute(
+            Operands(sp, ins->a),
+            CallSite { callee->ctx, callee->startPos, callee->endPos, &NodeCast<AttributionCallNode>(ins->node)->call->arguments }
+        );
+        if (callResult.ShouldReturn()) {
+            signal = callResult;
+            goto deliver;
+        }
+        currentCallStackDepth--;
+        auto returnValue = callResult.value;
+        if (IsMutableValue(returnValue)) {
+            returnValue->SetContext(ctx)->SetPos(ins->node->st, ins->node->et);
+        }
+        sp[-1] = Value::FromObject(returnValue);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Eval): {
+        auto evalResult = this->interpreter->Visit(ins->node, ctx);
+        if (evalResult.ShouldReturn()) {
+            signal = evalResult;
+            goto deliver;
+        }
+        *sp++ = Value::FromObject(evalResult.value);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(ForPrep): {
+        auto forNode = NodeCast<ForExpressionNode>(ins->node);
+        auto &state = loops[ins->loop - 1];
+        Object *stepValue = forNode->stepvNode != nullptr ? (*--sp).AsObject() : new Number(1);
+        auto etv = (*--sp).AsObject();
+        auto stv = (*--sp).AsObject();
+        if (stv->tag != TypeTag::Number || stepValue->tag != TypeTag::Number || etv->tag != TypeTag::Number) {
+            VM_FAIL(new TypeError(
+                std::format("For-loop expects 3 number but got ({}, {}, {})", stv->typeName, stepValue->typeName, etv->typeName),
+                forNode->st, forNode->et, ctx
+            ));
+        }
+        auto stepNum = dynamic_cast<Number *>(stepValue);
+        state.i = dynamic_cast<Number *>(stv)->value;
+        state.end = dynamic_cast<Number *>(etv)->value;
+        state.step = stepNum->value;
+        if (stepNum->ntype == NumberType::Int) {
+            state.ascending = std::get<int>(stepNum->value) >= 0;
+        } else {
+            state.ascending = std::get<double>(stepNum->value) >= 0;
+        }
+        state.collected.clear();
+        VM_DISPATCH();
+    }
+
+    VM_CASE(ForNext): {
+        auto &state = loops[ins->loop - 1];
+        auto &info = chunk->loops[ins->loop - 1];
+        std::variant<int, double> inRange;
+        Number::Compute(state.ascending ? OperatorKind::Less : OperatorKind::Greater, state.i, state.end, inRange);
+        if (!Value::FromNumber(inRange).AsBool()) {
+            ip = code + info.breakTarget;
+            VM_DISPATCH();
+        }
+        ctx->symbols->Set(*info.variable, Number::Shared(state.i));
+        Number::Compute(OperatorKind::Add, state.i, state.step, state.i);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(IterPrep): {
+        auto &state = loops[ins->loop - 1];
+        auto iterable = (*--sp).AsObject();
+        state.list = nullptr;
+        state.iterator = nullptr;
+        state.error = nullptr;
+        state.index = 0;
+        state.collected.clear();
+        if (iterable->tag == TypeTag::List) {
+            state.list = As<List>(iterable);
+            VM_DISPATCH();
+        }
+        auto [iterator, error] = iterable->Iter();
+        if (error != nullptr || iterator == nullptr) {
+            VM_FAIL(new TypeError(
+                std::format("Object '{}' is not iterable", iterable->typeName),
+                NodeCast<ForExpressionNode>(ins->node)->range->st, NodeCast<ForExpressionNode>(ins->node)->range->et, ctx
+            ));
+        }
+        state.iterator = iterator;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(IterNext): {
+        auto &state = loops[ins->loop - 1];
+        auto &info = chunk->loops[ins->loop - 1];
+        Object *element;
+        if (state.list != nullptr) {
+            if (state.index >= state.list->elements.size()) {
+                ip = code + info.breakTarget;
+                VM_DISPATCH();
+            }
+            element = state.list->elements[state.index++];
+        } else {
+            auto [next, error] = state.iterator->Next();
+            if (error != nullptr) {
+                state.error = error;
+                ip = code + info.breakTarget;
+                VM_DISPATCH();
+            }
+            element = next;
+        }
+        ctx->symbols->Set(*info.variable, element);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Append): {
+        loops[ins->loop - 1].collected.push_back((*--sp).AsObject());
+        VM_DISPATCH();
+    }
+
+    VM_CASE(LoopEnd): {
+        auto &state = loops[ins->loop - 1];
+        auto &info = chunk->loops[ins->loop - 1];
+        ctx->symbols->Remove(*info.variable);
+        if (NodeCast<ForExpressionNode>(ins->node)->rangeBasedLoop && state.iterator != nullptr) {
+            delete state.iterator;
+            state.iterator = nullptr;
+            if (state.error != nullptr && state.error->name != "StopIteration") {
+                VM_FAIL(state.error);
+            }
+        }
+        if (info.collect) {
+            *sp++ = Value::FromObject((new List(state.collected))->SetContext(ctx)->SetPos(ins->node->st, ins->node->et));
+        } else {
+            *sp++ = Value::FromObject(Number::null);
+        }
+        VM_DISPATCH();
+    }
+
+    VM_CASE(Break): {
+        signal.SuccessBreak();
+        goto deliver;
+    }
+
+    VM_CASE(Continue): {
+        signal.SuccessContinue();
+        goto deliver;
+    }
+
+    VM_CASE(Return): {
+        return RuntimeResult().SuccessReturn((*--sp).AsObject());
+    }
+
+    VM_CASE(Halt): {
+        return RuntimeResult().Success(ins->a ? (*--sp).AsObject() : Number::null);
+    }
+
+    // `a` is set for values which are only stored in a variable, those may use a shared Number
+    VM_CASE(Box): {
+        if (sp[-1].IsObject()) {
+            VM_DISPATCH();
+        }
+        if (ins->a) {
+            sp[-1] = Value::FromObject(Number::Shared(sp[-1].AsNumber()));
+        } else {
+            sp[-1] = Value::FromObject((new Number(sp[-1].AsNumber()))->SetContext(ctx)->SetPos(ins->node->st, ins->node->et));
+        }
+        VM_DISPATCH();
+    }
+
+#ifndef YAN_VM_COMPUTED_GOTO
+        }
+#endif
+
+    // `break` / `continue` (also when raised by a callee or an evaluated subtree) resume the innermost loop,
+    // everything else, and signals outside any loop, leaves the chunk just like `Interpreter::Visit` would
+    deliver:
+        if (signal.error != nullptr) {
+            VirtualMachine::Relocate(chunk, ins, signal.error, ctx);
+            return signal;
+        }
+        if (signal.funcReturnValue != nullptr || ins->loop == 0) {
+            return signal;
+        }
+        {
+            auto &info = chunk->loops[ins->loop - 1];
+            sp = stack + info.depth;
+            ip = code + (signal.shouldBreak ? info.breakTarget : info.continueTarget);
+        }
+        VM_DISPATCH();
+
+#ifndef YAN_VM_COMPUTED_GOTO
+    }
+#endif
+    #undef VM_CASE
+    #undef VM_DISPATCH
+    #undef VM_FAIL
+}
+
+RuntimeResult ExecuteCompiled(CompilationUnit *unit, NodeBase *body, bool keepValue, Context *ctx, Interpreter *interpreter) {
+    auto &chunk = unit->chunks[body];
+    if (chunk == nullptr) {
+        chunk = unit->arena.New<Chunk>();
+        BytecodeCompiler(chunk).CompileBody(body, keepValue);
+    }
+    return VirtualMachine(interpreter).Run(chunk, ctx);
+}
+
+void Initialize() {
+    srand((unsigned) time(nullptr));
+    // globalSymbolTable->Set("null", new Number(0));
+    globalSymbolTable->Set("false", new Number(0));
+    globalSymbolTable->Set("true", new Number(1));
+    globalSymbolTable->Set("pass", Number::null);
+    // globalSymbolTable->Set("pi", new Number(3.141592653589793238462));
+    globalSymbolTable->Set("null", Number::null);
+    InitializeBuiltins();
+    SetBuiltins(globalSymbolTable);
+
+    builtins::AllocEnvVars();
+    builtins::RestoreEnvVar();
+
+    defaultInitializer = new BuiltinFunction("_default__init__");
+    defaultInitializer->Bind({ "self" }, Class_Default__init__);
+}
+
+bool startAsShell = false;
+
+void Interprete(const std::string &file, const std::string &text, InterpreterStartMode mode, const std::string &frameId, Context *parent, Position *parentEntry) {
+    auto [unit, err] = CompilationUnit::Compile(file, text);
+    if (err != nullptr) {
+        std::cerr << err->ToString() << std::endl;
+        return;
+    }
+    // if (debug) {
+    //     std::cout << "[DEBUG] AST: " << unit->ast->ToString() << std::endl;    
+    // }
+
+    auto interpreter = SharedInterpreter();
+    Context *context;
+    if (mode != InterpreterStartMode::Evaluation) {
+        context = new Context("<module>");
+        context->symbols = globalSymbolTable;    
+        context->interpreter = interpreter;
+    } else {
+        context = new Context(frameId);
+        context->parent = parent;
+        context->symbols = globalSymbolTable;
+        context->parentEntry = parentEntry;
+    }
+    RuntimeResult n;
+    if (executionEngine == ExecutionEngine::VM) {
+        n = ExecuteCompiled(unit, unit->ast, true, context, interpreter);
+    } else {
+        n = interpreter->Visit(unit->ast, context);
+    }
+    if (n.error != nullptr) {
+        if (n.cause == nullptr) {
+            std::cerr << n.error->ToString() << std::endl;
+            unit->Release();
+            return; 
+        } else {
+            std::cerr << n.cause->ToString() << std::endl;
+            if (n.extraInfo == "") {
+                std::cerr << std::endl << "Above exception is the direct cause of the following exception: " << std::endl << std::endl;
+            } else {
+                std::cerr << std::endl << n.extraInfo << std::endl << std::endl;
+            }
+            std::cerr << n.error->ToString() << std::endl;
+            unit->Release();
+            return;
+        }
+    }
+
+    if (n.value != nullptr) {
+        if (n.value->tag == TypeTag::String) {
+            // It may be impossible to reach here ...
+            dynamic_cast<String *>(n.value)->Representation();
+        } else {
+            int resultCount = std::get<int>(As<Number>(n.value->Len().first)->value);
+            if (resultCount == 1) {
+                if (mode == InterpreterStartMode::Repl) {
+                    auto o = As<List>(n.value)->elements[0];
+                    if (o->tag == TypeTag::String) {
+                        std::cout << "= ";
+                        As<String>(o)->Representation();
+                    } else {
+                        std::cout << "= " << o->ToString() << std::endl;
+                    }
+                } else if (mode == InterpreterStartMode::Evaluation && startAsShell) {
+                    auto o = As<List>(n.value)->elements[0];
+                    if (o->tag == TypeTag::String) {
+                        std::cout << std::format("[@{}]= ", frameId);
+                        As<String>(o)->Representation(); 
+                    } else {
+                        std::cout << std::format("[@{}]= ", frameId) << o->ToString() << std::endl;                    
+                    }
+                } else if (mode == InterpreterStartMode::Evaluation && !startAsShell) {
+                    auto o = As<List>(n.value)->elements[0];
+                    if (o->tag == TypeTag::String) {
+                        As<String>(o)->Representation();
+                    } else {
+                        std::cout << As<List>(n.value)->elements[0]->ToString() << std::endl;
+                    }
+                }
+            } else {
+                for (int i = 0; i < resultCount; i++) {
+                    if (mode == InterpreterStartMode::Repl) {
+                        auto o = As<List>(n.value)->elements[i];
+                        if (o->tag == TypeTag::String) {
+                            std::cout << std::format("[#{}]= ", i + 1);
+                            As<String>(o)->Representation(); 
+                        } else {
+                            std::cout << std::format("[#{}]= ", i + 1) << o->ToString() << std::endl;                    
+                        }
+                        // std::cout << std::format("[#{}]= ", i + 1) << As<List>(n->value)->elements[i]->ToString() << std::endl;
+                    } else if (mode == InterpreterStartMode::Evaluation && startAsShell) {
+                        auto o = As<List>(n.value)->elements[i];
+                        if (o->tag == TypeTag::String) {
+                            std::cout << std::format("[#{}, @{}]= ", i + 1, frameId);
+                            As<String>(o)->Representation(); 
+                        } else {
+                            std::cout << std::format("[#{}, @{}]= ", i + 1, frameId) << o->ToString() << std::endl;                    
+                        }
+                        // std::cout << std::format("[#{}, @{}]= ", i + 1, frameId) << As<List>(n->value)->elements[i]->ToString() << std::endl;
+                    } else if (mode == InterpreterStartMode::Evaluation && !startAsShell) {
+                        auto o = As<List>(n.value)->elements[i];
+                        if (o->tag == TypeTag::String) {
+                            As<String>(o)->Representation(); 
+                        } else {
+                            std::cout << o->ToString() << std::endl;                    
+                        }
+                        // std::cout << As<List>(n->value)->elements[i]->ToString() << std::endl;
+                    }
+                }
+            }
+        }
+    }
+
+    unit->Release();
+}
+
+void CopyCommandLineArgs(int argc, char **argv, InterpreterStartMode mode, SymbolTable *dest) {
+    auto args = new List({});
+    assert(mode != InterpreterStartMode::Evaluation);
+    // if (debug) {
+    //     std::cout << "[DEBUG] Applying command line args to the global symbol table" << std::endl;
+    // }
+    for (int i = 1; i < argc; i++) {
+        args->elements.push_back(new String(std::string(argv[i])));
+    } 
+    dest->Set("args", args);
+}
+
+void Finalize() {
+    delete globalSymbolTable;
+
+    for (auto [builtinName, builtin] : allBuiltins) {
+        delete builtin;
+    }
+
+    for (auto [_, dylib] : dylibs) {
+        #ifdef __linux__
+            auto moduleFinalizer = dlsym(dylib, "Yan_OnDestroy");
+            if (moduleFinalizer != nullptr) {
+                ((void (*)()) moduleFinalizer)();
+            }
+            dlclose(dylib);
+        #elif defined(_WIN32)
+            auto moduleFinalizer = win32::GetProcAddress(dylib, "Yan_OnDestroy");
+            if (moduleFinalizer != nullptr) {
+                ((void (*)()) moduleFinalizer)();
+            }
+            win32::FreeLibrary(dylib);
+        #endif
+    }
+
+    for (auto [_, mod] : nativeModules) {
+        delete mod;
+    }
+
+    delete envVars;
+}
+
+void InterpreteFile(const std::string &filename) {
+    std::ifstream ifs;
+    std::ostringstream buf;
+    ifs.open(filename, std::ios::in);
+    if (!ifs.is_open()) {
+        std::cerr << std::format("Fatal: Couldn't open script: '{}'", filename) << std::endl;
+        return;
+    }
+    buf << ifs.rdbuf();
+    auto script = buf.str();
+
+    Interprete(filename, script, InterpreterStartMode::File);
+}
@@ -37,7 +37,7 @@ const int YANFS_INT32_MAX = std::numeric_limits<int>::max();
 
 
 static int YanFs_CheckFileObject_Internal(Object *arg) {
-    if (arg->typeName != std::string("String")) {
+    if (arg->tag != TypeTag::String) {
         return YANFS_BROKEN_FILE_OBJECT;
     }
 
@@ -72,26 +72,26 @@ static Error *YanFs_ThrowExc(int excId, Context *ctx, Object *arg) {
 }
 
 YAN_C_API_START builtins::YanObject YanFs_FileObject_Eof(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(FileObject.Read);
     auto self = ctx->symbols->Get("self");
     auto arg = self->GetAttr("name").first;
     
     int status = YanFs_CheckFileObject_Internal(arg);
     if (status) {
-        return result->Failure(YanFs_ThrowExc(status, ctx, arg));
+        return result.Failure(YanFs_ThrowExc(status, ctx, arg));
     }
 
     auto filename = As<String>(arg)->s;
     auto fileStream = openedFileStream.at(filename);
 
     bool isEof = fileStream->eof();
-    return result->Success(new Number((int) isEof));
+    return result.Success(new Number((int) isEof));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject YanFs_FileObject_Length(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(FileObject.Length);
     
     auto self = ctx->symbols->Get("self");
@@ -99,24 +99,24 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_Length(builtins::YanContext
     
     int status = YanFs_CheckFileObject_Internal(arg);
     if (status) {
-        return result->Failure(YanFs_ThrowExc(status, ctx, arg));
+        return result.Failure(YanFs_ThrowExc(status, ctx, arg));
     }
 
     auto filename = As<String>(arg)->s;
     auto fileStream = openedFileStream.at(filename);
-    return result->Success(new Number(YanFs_GetFileLength(*fileStream.get())));
+    return result.Success(new Number(YanFs_GetFileLength(*fileStream.get())));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject YanFs_FileObject_Read(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(FileObject.Read);
     auto self = ctx->symbols->Get("self");
     auto arg = self->GetAttr("name").first;
     
     int status = YanFs_CheckFileObject_Internal(arg);
     if (status) {
-        return result->Failure(YanFs_ThrowExc(status, ctx, arg));
+        return result.Failure(YanFs_ThrowExc(status, ctx, arg));
     }
 
     auto filename = As<String>(arg)->s;
@@ -125,25 +125,25 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_Read(builtins::YanContext c
     std::stringstream ss;
     ss << fileStream->rdbuf();
     content = ss.str();
-    return result->Success(new String(content));
+    return result.Success(new String(content));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject YanFs_FileObject_ReadBuf(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(FileObject.ReadBuf);
     auto self = ctx->symbols->Get("self");
     auto arg = self->GetAttr("name").first;
     auto _currentPos = self->GetAttr("pos");
     
     if (_currentPos.first == nullptr) {
-        return result->Failure(new RuntimeError(
+        return result.Failure(new RuntimeError(
             "Broken file object",
             self->startPos, self->endPos, ctx
         ), _currentPos.second);
     }
-    if (_currentPos.first->typeName != std::string("Number")) {
-        return result->Failure(new RuntimeError(
+    if (_currentPos.first->tag != TypeTag::Number) {
+        return result.Failure(new RuntimeError(
             "Broken file object",
             self->startPos, self->endPos, ctx
         ));
@@ -153,22 +153,22 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_ReadBuf(builtins::YanContex
 
     size_t s = 1;
     if (size != nullptr) {
-        if (size->typeName != std::string("Number")) {
-            return result->Failure(new TypeError(
+        if (size->tag != TypeTag::Number) {
+            return result.Failure(new TypeError(
                 "Buffer size should be a positive integer",
                 size->startPos, size->endPos, ctx
             ));
         }
         auto sn = As<Number>(size);
         if (!builtins::Math::HoldsInteger(sn)) {
-            return result->Failure(new TypeError(
+            return result.Failure(new TypeError(
                 "Buffer size should be a positive integer",
                 size->startPos, size->endPos, ctx
             ));
         }
         s = builtins::Math::GetInt(sn);
         if (s < 1) {
-            return result->Failure(new ValueError(
+            return result.Failure(new ValueError(
                 "Buffer size should be a positive integer",
                 size->startPos, size->endPos, ctx
             ));
@@ -177,7 +177,7 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_ReadBuf(builtins::YanContex
     
     int status = YanFs_CheckFileObject_Internal(arg);
     if (status) {
-        return result->Failure(YanFs_ThrowExc(status, ctx, arg));
+        return result.Failure(YanFs_ThrowExc(status, ctx, arg));
     }
 
     auto filename = As<String>(arg)->s;
@@ -185,7 +185,7 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_ReadBuf(builtins::YanContex
     auto fileLength = YanFs_GetFileLength(*fileStream.get());
 
     if (currentPos + s > fileLength) {
-        return result->Failure(new OSError(
+        return result.Failure(new OSError(
             std::format("EOF: {}", filename),
             size->startPos, size->endPos, ctx
         ));
@@ -200,14 +200,14 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_ReadBuf(builtins::YanContex
     delete buf;
 
     self->SetAttr("pos", new Number((int) (currentPos + s)));
-    return result->Success(new String(str));
+    return result.Success(new String(str));
 }
 
 YAN_C_API_END
 
 static inline bool YanFs_IsPositiveInteger(Object *o, bool zeroExcluded = true) {
     if (o != nullptr) {
-        if (o->typeName == std::string("Number")) {
+        if (o->tag == TypeTag::Number) {
             auto n = As<Number>(o);
             if (builtins::Math::HoldsInteger(n)) {
                 auto v = builtins::Math::GetInt(n);
@@ -221,20 +221,20 @@ static inline bool YanFs_IsPositiveInteger(Object *o, bool zeroExcluded = true)
 }
 
 YAN_C_API_START builtins::YanObject YanFs_FileObject_Reverse(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto self = ctx->symbols->Get("self");
 
     auto arg = self->GetAttr("name").first;
     auto _currentPos = self->GetAttr("pos");
 
     if (_currentPos.first == nullptr) {
-        return result->Failure(new RuntimeError(
+        return result.Failure(new RuntimeError(
             "Broken file object",
             self->startPos, self->endPos, ctx
         ), _currentPos.second);
     }
-    if (_currentPos.first->typeName != std::string("Number")) {
-        return result->Failure(new RuntimeError(
+    if (_currentPos.first->tag != TypeTag::Number) {
+        return result.Failure(new RuntimeError(
             "Broken file object",
             self->startPos, self->endPos, ctx
         ));
@@ -243,7 +243,7 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_Reverse(builtins::YanContex
 
     auto _reverseCount = ctx->symbols->Get("_num");
     if (!YanFs_IsPositiveInteger(_reverseCount)) {
-        return result->Failure(new ValueError(
+        return result.Failure(new ValueError(
             "Reverse count should be a positive integer",
             _reverseCount->startPos, _reverseCount->endPos, ctx
         ));
@@ -251,7 +251,7 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_Reverse(builtins::YanContex
 
     auto reverseCount = builtins::Math::GetInt(As<Number>(_reverseCount));
     if (currentPos - reverseCount < 0) {
-        return result->Failure(new OSError(
+        return result.Failure(new OSError(
             "Already reached start of file",
             self->startPos, self->endPos, ctx
         ));
@@ -259,7 +259,7 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_Reverse(builtins::YanContex
 
     int status = YanFs_CheckFileObject_Internal(arg);
     if (status) {
-        return result->Failure(YanFs_ThrowExc(status, ctx, arg));
+        return result.Failure(YanFs_ThrowExc(status, ctx, arg));
     }
 
     auto filename = As<String>(arg)->s;
@@ -267,19 +267,19 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_Reverse(builtins::YanContex
     fileStream->seekg(currentPos - reverseCount);
     fileStream->seekp(currentPos - reverseCount);
     self->SetAttr("pos", new Number((int) (currentPos - reverseCount)));
-    return result->Success(Number::null);
+    return result.Success(Number::null);
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject YanFs_FileObject_ReadLines(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(FileObject.Read);
     auto self = ctx->symbols->Get("self");
     auto arg = self->GetAttr("name").first;
     
     int status = YanFs_CheckFileObject_Internal(arg);
     if (status) {
-        return result->Failure(YanFs_ThrowExc(status, ctx, arg));
+        return result.Failure(YanFs_ThrowExc(status, ctx, arg));
     }
 
     auto filename = As<String>(arg)->s;
@@ -294,27 +294,27 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_ReadLines(builtins::YanCont
     for (const auto &line : lines) {
         r.emplace_back(new String(line));
     }
-    return result->Success(new List(r));
+    return result.Success(new List(r));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject YanFs_FileObject_Write(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(FileObject.Write);
     auto self = ctx->symbols->Get("self");
     auto arg = self->GetAttr("name").first;
    
     int status = YanFs_CheckFileObject_Internal(arg);
     if (status) {
-        return result->Failure(YanFs_ThrowExc(status, ctx, arg));
+        return result.Failure(YanFs_ThrowExc(status, ctx, arg));
     }
 
     auto filename = As<String>(arg)->s;
     auto fileStream = openedFileStream.at(filename);
 
     auto contentArg = ctx->symbols->Get("_str");
-    if (contentArg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (contentArg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "Only string could be push into file stream",
             contentArg->startPos, contentArg->endPos, ctx
         ));
@@ -322,7 +322,7 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_Write(builtins::YanContext
 
     auto content = As<String>(contentArg)->s;
     *fileStream.get() << content;
-    return result->Success(Number::null);
+    return result.Success(Number::null);
 }
 YAN_C_API_END
 
@@ -395,24 +395,24 @@ YAN_C_API_START builtins::YanObject YanFs_FileObject_Init(builtins::YanContext c
     auto self = ctx->symbols->Get("self");
     auto name = As<String>(ctx->symbols->Get("name"))->s;
     _FileObject_Init_Internal(self, name);
-    return (new RuntimeResult)->Success(Number::null);
+    return RuntimeResult().Success(Number::null);
 }
 YAN_C_API_END
 
 
 YAN_C_API_START builtins::YanObject YanFs_FileObject_New(const std::string &name, Position *st, Position *et, Context *ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto fileObject = FileObject->Instantiate({ new String(name) }, ctx, st, et);
-    if (result->ShouldReturn()) {
+    if (result.ShouldReturn()) {
         return result;
     }
-    return result->Success(fileObject);
+    return result.Success(fileObject);
 }
 YAN_C_API_END
 
 
 YAN_C_API_START builtins::YanObject Open(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg1 = ctx->symbols->Get("filename");
     auto arg2 = ctx->symbols->Get("__mode__");
     std::ios_base::openmode mode;
@@ -431,30 +431,30 @@ YAN_C_API_START builtins::YanObject Open(builtins::YanContext ctx) {
         } else if (modeString == "wr") {
             mode = std::ios::in | std::ios::out;
         } else if (modeString == "wb") {
-            return result->Failure(new RuntimeError(
+            return result.Failure(new RuntimeError(
                 "Binary IO not implemented yet",
                 arg2->startPos, arg2->endPos, ctx
             ));
         } else if (modeString == "rb") {
-            return result->Failure(new RuntimeError(
+            return result.Failure(new RuntimeError(
                 "Binary IO not implemented yet",
                 arg2->startPos, arg2->endPos, ctx
             ));
         } else if (modeString == "wba") {
-            return result->Failure(new RuntimeError(
+            return result.Failure(new RuntimeError(
                 "Binary IO not implemented yet",
                 arg2->startPos, arg2->endPos, ctx
             ));
         } else {
-            return result->Failure(new ValueError(
+            return result.Failure(new ValueError(
                 std::format("Invilid file open mode: '{}'", modeString),
                 arg2->startPos, arg2->endPos, ctx
             ));
         }
     }
 
-    if (arg1->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg1->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "Filename should be a string",
             arg1->startPos, arg1->endPos, ctx
         ));
@@ -466,45 +466,45 @@ YAN_C_API_START builtins::YanObject Open(builtins::YanContext ctx) {
     try {
         fs->open(filename, mode);
     } catch (std::system_error &err) {
-        return result->Failure(new OSError(
+        return result.Failure(new OSError(
             std::format("Unable to open file '{}': {}", filename, err.code().message()),
             arg1->startPos, arg1->endPos, ctx
         ));
     }
 
     openedFileStream.insert(std::make_pair(filename, fs));
-    auto fileOperationObject = YanFs_FileObject_New(filename, arg1->startPos, arg1->endPos, ctx)->value;
-    return result->Success(fileOperationObject);
+    auto fileOperationObject = YanFs_FileObject_New(filename, arg1->startPos, arg1->endPos, ctx).value;
+    return result.Success(fileOperationObject);
 }
 YAN_C_API_END
 
 
 YAN_C_API_START builtins::YanObject Close(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(Close);    
     auto self = ctx->symbols->Get("_fileObject");
-    if (self->typeName != std::string("ClassObject")) {
-        return result->Failure(new TypeError(
+    if (self->tag != TypeTag::ClassObject) {
+        return result.Failure(new TypeError(
             "Argument should be a `FileObject` created by fs.Open()",
             self->startPos, self->endPos, ctx
         ));
     }
     std::string clsName = As<ClassObject>(self)->className;
     if (clsName != "FileObject") {
-        return result->Failure(new TypeError(
+        return result.Failure(new TypeError(
             std::format("Argument should be a `FileObject` created by fs.Open() [got {} object]", clsName),
             self->startPos, self->endPos, ctx
         ));
     }
     auto [arg, err] = self->GetAttr("name");
     if (arg == nullptr) {
-        return result->Failure(new RuntimeError(
+        return result.Failure(new RuntimeError(
             "Broken file object",
             self->startPos, self->endPos, ctx
         ), err);
     }
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new RuntimeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new RuntimeError(
             "Broken file object",
             arg->startPos, arg->endPos, ctx
         ));
@@ -512,7 +512,7 @@ YAN_C_API_START builtins::YanObject Close(builtins::YanContext ctx) {
     
     auto filename = As<String>(arg)->s;
     if (openedFileStream.find(filename) == openedFileStream.end()) {
-        return result->Failure(new RuntimeError(
+        return result.Failure(new RuntimeError(
             std::format("Dangling file reference: '{}'", filename),
             arg->startPos, arg->endPos, ctx
         ));
@@ -520,16 +520,16 @@ YAN_C_API_START builtins::YanObject Close(builtins::YanContext ctx) {
 
     openedFileStream.at(filename)->close();
     openedFileStream.erase(filename);
-    return result->Success(Number::null);
+    return result.Success(Number::null);
 }
 YAN_C_API_END
 
 
 YAN_C_API_START builtins::YanObject GetFileType(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_path");
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "_path should be a string",
             arg->startPos, arg->endPos, ctx
         ));
@@ -559,15 +559,15 @@ YAN_C_API_START builtins::YanObject GetFileType(builtins::YanContext ctx) {
         type = YANFS_FILETYPE_ERR;
     }
 
-    return (new RuntimeResult)->Success(new Number(type));
+    return RuntimeResult().Success(new Number(type));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject GetFilePermissions(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_path");
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "_path should be a string",
             arg->startPos, arg->endPos, ctx
         ));
@@ -577,7 +577,7 @@ YAN_C_API_START builtins::YanObject GetFilePermissions(builtins::YanContext ctx)
         std::filesystem::path filePath = As<String>(arg)->s;
         auto stat = std::filesystem::status(filePath);  
         if (!std::filesystem::exists(stat)) {
-            return result->Failure(new OSError(
+            return result.Failure(new OSError(
             std::format("Path '{}' does not exists", filePath.string()),
             arg->startPos, arg->endPos, ctx
             ));
@@ -602,7 +602,7 @@ YAN_C_API_START builtins::YanObject GetFilePermissions(builtins::YanContext ctx)
         show('w', perms::others_write);
         show('x', perms::others_exec);
 
-        return result->Success(new String(permissionString));
+        return result.Success(new String(permissionString));
     } catch (std::filesystem::filesystem_error &e) {
         std::cerr << "Fatal: [yan::fs] " << e.what() << std::endl;
         assert(false);
@@ -611,10 +611,10 @@ YAN_C_API_START builtins::YanObject GetFilePermissions(builtins::YanContext ctx)
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject Exists(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_path");
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "_path should be a string",
             arg->startPos, arg->endPos, ctx
         ));
@@ -622,15 +622,15 @@ YAN_C_API_START builtins::YanObject Exists(builtins::YanContext ctx) {
 
     auto path = As<String>(arg);
     std::filesystem::path p = path->s;
-    return result->Success(new Number((int) std::filesystem::exists(p)));
+    return result.Success(new Number((int) std::filesystem::exists(p)));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject _GetFreeSpace(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_path");
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "_path should be a string",
             arg->startPos, arg->endPos, ctx
         ));
@@ -640,7 +640,7 @@ YAN_C_API_START builtins::YanObject _GetFreeSpace(builtins::YanContext ctx) {
     try {
         auto stat = std::filesystem::status(filePath);
         if (!std::filesystem::exists(stat)) {
-            return result->Failure(new OSError(
+            return result.Failure(new OSError(
                 std::format("Path '{}' does not exists", filePath.string()),
                 arg->startPos, arg->endPos, ctx
             ));
@@ -660,7 +660,7 @@ YAN_C_API_START builtins::YanObject _GetFreeSpace(builtins::YanContext ctx) {
         PushValue(spaceInfo.capacity);
         PushValue(spaceInfo.available);
         PushValue(spaceInfo.free);
-        return result->Success(new List(wrappedResult));
+        return result.Success(new List(wrappedResult));
     } catch (std::filesystem::filesystem_error &e) {
         std::cerr << "Fatal: [yan::fs] " << e.what() << std::endl;
         assert(false);
@@ -669,10 +669,10 @@ YAN_C_API_START builtins::YanObject _GetFreeSpace(builtins::YanContext ctx) {
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject GetFileSize(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_file");
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "_path should be a string",
             arg->startPos, arg->endPos, ctx
         ));
@@ -682,16 +682,16 @@ YAN_C_API_START builtins::YanObject GetFileSize(builtins::YanContext ctx) {
     try {
         std::filesystem::path p = filename;
         if (std::filesystem::is_directory(p)) {
-            return result->Failure(new OSError(
+            return result.Failure(new OSError(
                 std::format("Is a directory [{}]", filename),
                 arg->startPos, arg->endPos, ctx
             ));
         }
         auto size = std::filesystem::file_size(p);
         if (size > static_cast<std::uintmax_t>(YANFS_INT32_MAX)) {
-            return result->Success(new String(std::format("{}", size)));
+            return result.Success(new String(std::format("{}", size)));
         } else {
-            return result->Success(new Number(static_cast<int>(size)));
+            return result.Success(new Number(static_cast<int>(size)));
         }
     } catch (std::filesystem::filesystem_error &e) {
         std::cerr << "Fatal: [yan::fs] " << e.what() << std::endl;
@@ -701,12 +701,12 @@ YAN_C_API_START builtins::YanObject GetFileSize(builtins::YanContext ctx) {
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject FormatSize(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_num");
     std::stringstream ss;
 
-    if (arg->typeName != std::string("Number")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::Number) {
+        return result.Failure(new TypeError(
             "_num should be a integer",
             arg->startPos, arg->endPos, ctx
         ));
@@ -714,7 +714,7 @@ YAN_C_API_START builtins::YanObject FormatSize(builtins::YanContext ctx) {
 
     auto num_ = As<Number>(arg);
     if (!builtins::Math::HoldsInteger(num_)) {
-        return result->Failure(new TypeError(
+        return result.Failure(new TypeError(
             "_num should be a integer",
             arg->startPos, arg->endPos, ctx
         ));
@@ -727,19 +727,19 @@ YAN_C_API_START builtins::YanObject FormatSize(builtins::YanContext ctx) {
     ss << std::ceil(mantissa * 10.) / 10. << "BKMGTPE"[o];
     if (!o) {
         // return result->Success(new String("0"));
-        return result->Success(new String(ss.str()));    
+        return result.Success(new String(ss.str()));    
     } else {
         ss << "B (" << num << ')';
-        return result->Success(new String(ss.str()));
+        return result.Success(new String(ss.str()));
     }
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject ListDirectory(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_path");
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "_path should be a string",
             arg->startPos, arg->endPos, ctx
         ));
@@ -749,7 +749,7 @@ YAN_C_API_START builtins::YanObject ListDirectory(builtins::YanContext ctx) {
     try {
         std::filesystem::path p = directory;
         if (!std::filesystem::is_directory(p)) {
-            return result->Failure(new OSError(
+            return result.Failure(new OSError(
                 "_path should be a directory",
                 arg->startPos, arg->endPos, ctx
             ));
@@ -759,7 +759,7 @@ YAN_C_API_START builtins::YanObject ListDirectory(builtins::YanContext ctx) {
         for (auto v : std::filesystem::directory_iterator(p)) {
             fileList.emplace_back(new String(v.path().string()));
         }
-        return result->Success(new List(fileList));
+        return result.Success(new List(fileList));
     } catch (std::filesystem::filesystem_error &e) {
         std::cerr << "Fatal: [yan::fs] " << e.what() << std::endl;
         assert(false);
@@ -768,10 +768,10 @@ YAN_C_API_START builtins::YanObject ListDirectory(builtins::YanContext ctx) {
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject GetLastWriteTime(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_path");
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "_file should be a string",
             arg->startPos, arg->endPos, ctx
         ));
@@ -781,7 +781,7 @@ YAN_C_API_START builtins::YanObject GetLastWriteTime(builtins::YanContext ctx) {
     try {
         std::filesystem::path p = file;
         auto ftime = std::filesystem::last_write_time(p);
-        return result->Success(new String(std::format("{}", ftime)));
+        return result.Success(new String(std::format("{}", ftime)));
     } catch (std::filesystem::filesystem_error &e) {
         std::cerr << "Fatal: [yan::fs] " << e.what() << std::endl;
         assert(false);
@@ -790,10 +790,10 @@ YAN_C_API_START builtins::YanObject GetLastWriteTime(builtins::YanContext ctx) {
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject GetHardLinksCount(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_path");
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(new TypeError(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(new TypeError(
             "_path should be a string",
             arg->startPos, arg->endPos, ctx
         ));
@@ -804,9 +804,9 @@ YAN_C_API_START builtins::YanObject GetHardLinksCount(builtins::YanContext ctx)
         std::filesystem::path p = filename;
         auto count = std::filesystem::hard_link_count(p);
         if (count > static_cast<std::uintmax_t>(YANFS_INT32_MAX)) {
-            return result->Success(new String(std::format("{}", count)));
+            return result.Success(new String(std::format("{}", count)));
         } else {
-            return result->Success(new Number(static_cast<int>(count)));
+            return result.Success(new Number(static_cast<int>(count)));
         }
     } catch (std::filesystem::filesystem_error &e) {
         std::cerr << "Fatal: [yan::fs] " << e.what() << std::endl;
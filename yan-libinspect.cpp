@@ -15,7 +15,7 @@ YAN_C_API_END
 
 
 YAN_C_API_START builtins::YanObject GetNativeCallStackInfo(builtins::YanContext ctx) {
-    return (new RuntimeResult)->Success(new String(RuntimeError::GetNativeCallStackInfo()));
+    return RuntimeResult().Success(new String(RuntimeError::GetNativeCallStackInfo()));
 }
 YAN_C_API_END
 
@@ -26,7 +26,7 @@ YAN_C_API_START builtins::YanObject GetCallStackInfo(builtins::YanContext ctx) {
     int i = 0;
     while (callStack != nullptr) {
         if (p != nullptr) {
-            ss << std::format("#{}: {}{}{} [{}{}{}:{}:{}]\n", i, CYAN, callStack->ctxLabel, RESET, YELLOW, p->filename, RESET, p->line + 1, p->column + 1);
+            ss << std::format("#{}: {}{}{} [{}{}{}:{}:{}]\n", i, CYAN, callStack->ctxLabel, RESET, YELLOW, p->Filename(), RESET, p->line + 1, p->column + 1);
         } else {
             ss << std::format("#{} ?? (not avalible) [+{}{}{}]", i, GREEN, (void *) p, RESET) << std::endl;
         }
@@ -34,12 +34,12 @@ YAN_C_API_START builtins::YanObject GetCallStackInfo(builtins::YanContext ctx) {
         p = callStack->parentEntry;
         callStack = callStack->parent;
     }
-    return (new RuntimeResult)->Success(new String(ss.str()));
+    return RuntimeResult().Success(new String(ss.str()));
 }   
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject GetLocals(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
 
     if (ctx->parent == nullptr) {
         std::cerr << "Fatal: Invilid context" << std::endl;
@@ -48,16 +48,16 @@ YAN_C_API_START builtins::YanObject GetLocals(builtins::YanContext ctx) {
         assert(false);
     }
     auto pc = ctx->parent->symbols;
-    std::map<Object *, Object *> localsCache;
-    for (const auto &[symName, sym] : pc->symbols) {
-        localsCache.insert(std::make_pair(new String(symName), sym));
+    ObjectMap localsCache;
+    for (const auto &[symName, sym] : pc->Entries()) {
+        localsCache.Set(new String(symName), sym);
     }
-    return result->Success(new Dictionary(localsCache));
+    return result.Success(new Dictionary(std::move(localsCache)));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject PrintLocals(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
 
     if (ctx->parent == nullptr) {
         std::cerr << "Fatal: Invilid context" << std::endl;
@@ -68,7 +68,7 @@ YAN_C_API_START builtins::YanObject PrintLocals(builtins::YanContext ctx) {
     auto pc = ctx->parent->symbols;
 
     std::cout << pc->ToString() << std::endl;
-    return result->Success(Number::null);
+    return result.Success(Number::null);
 }
 YAN_C_API_END
 
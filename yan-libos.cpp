@@ -13,16 +13,16 @@ YAN_C_API_END
 
 
 YAN_C_API_START builtins::YanObject System(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_cmd");
 
-    if (arg->typeName != std::string("String")) {
-        return result->Failure(
+    if (arg->tag != TypeTag::String) {
+        return result.Failure(
             new TypeError("Expected a string command", arg->startPos, arg->endPos, arg->ctx)
         );
     }
     int ret = system(As<String>(arg)->s.c_str());
-    return result->Success(new Number(ret));
+    return result.Success(new Number(ret));
 }
 YAN_C_API_END
 
@@ -19,21 +19,21 @@ YAN_C_API_END
 YAN_C_API_START builtins::YanObject Random(builtins::YanContext ctx) {
     auto randNum = rand();
     if (randNum == 0) {
-        return (new RuntimeResult)->Success(new Number(0.0));
+        return RuntimeResult().Success(new Number(0.0));
     } else if (randNum == 1) {
-        return (new RuntimeResult)->Success(new Number(1.0));
+        return RuntimeResult().Success(new Number(1.0));
     }
-    return (new RuntimeResult)->Success(new Number(1.0 / randNum));
+    return RuntimeResult().Success(new Number(1.0 / randNum));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject RandInt(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(RandInt);
     auto arg1 = ctx->symbols->Get("a");
     auto arg2 = ctx->symbols->Get("b");
-    if (arg1->typeName != std::string("Number") || arg2->typeName != std::string("Number")) {
-        return result->Failure(new TypeError(
+    if (arg1->tag != TypeTag::Number || arg2->tag != TypeTag::Number) {
+        return result.Failure(new TypeError(
             "Interval endpoints should be numbers",
             arg1->startPos, arg2->endPos, ctx
         ));
@@ -42,7 +42,7 @@ YAN_C_API_START builtins::YanObject RandInt(builtins::YanContext ctx) {
     auto a = As<Number>(arg1);
     auto b = As<Number>(arg2);
     if (!builtins::Math::HoldsInteger(a) || !builtins::Math::HoldsInteger(b)) {
-        return result->Failure(new TypeError(
+        return result.Failure(new TypeError(
             "Interval endpoints should be integers",
             a->startPos, b->endPos, ctx
         ));
@@ -53,7 +53,7 @@ YAN_C_API_START builtins::YanObject RandInt(builtins::YanContext ctx) {
     auto va = builtins::Math::GetInt(a);
     auto vb = builtins::Math::GetInt(b);
     std::uniform_int_distribution<> dist(std::min(va, vb), std::max(va, vb));
-    return result->Success(new Number(dist(generator)));
+    return result.Success(new Number(dist(generator)));
 }
 YAN_C_API_END
 
@@ -14,8 +14,8 @@ using IntPtr = std::string;
 
 #define WRAP_PTR(p) (std::to_string((long) ((void *) p)))
 #define UNWRAP_PTR(T, p) ((T *) ((void *) (atol(p.c_str()))))
-#define ASSERT_TYPE_MATCH(o, tpStr) assert((o->typeName == std::string(#tpStr)) && ("Type mismatched: requires" #tpStr))
-#define ASSERT_INT(o) assert(o->typeName == std::string("Number") && As<Number>(o)->ntype == NumberType::Int && "Requires integer");
+#define ASSERT_TYPE_MATCH(o, tpStr) assert((o->tag == TypeTag::tpStr) && ("Type mismatched: requires" #tpStr))
+#define ASSERT_INT(o) assert(o->tag == TypeTag::Number && As<Number>(o)->ntype == NumberType::Int && "Requires integer");
 
 
 class SDLError : public RuntimeError {
@@ -47,7 +47,7 @@ YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject Init(builtins::YanContext ctx) {
     int ret = sdl2::SDL_Init(SDL_INIT_EVERYTHING);
-    return (new RuntimeResult)->Success(new Number(ret));
+    return RuntimeResult().Success(new Number(ret));
 }
 YAN_C_API_END
 
@@ -77,13 +77,13 @@ YAN_C_API_START builtins::YanObject CreateWindow(builtins::YanContext ctx) {
         w, h, flags
     );
     if (!window) {
-        return (new RuntimeResult)->Failure(new SDLError(
+        return RuntimeResult().Failure(new SDLError(
             std::format("Unable to create window: {}", sdl2::SDL_GetError()),
             arg1->startPos, arg3->startPos, ctx
         ));
     }
 
-    return (new RuntimeResult)->Success(new String(WRAP_PTR(window)));
+    return RuntimeResult().Success(new String(WRAP_PTR(window)));
 }
 YAN_C_API_END
 
@@ -92,7 +92,7 @@ YAN_C_API_START builtins::YanObject DestroyWindow(builtins::YanContext ctx) {
     ASSERT_TYPE_MATCH(arg, String);
     auto window = UNWRAP_PTR(sdl2::SDL_Window, As<String>(arg)->s);
     sdl2::SDL_DestroyWindow(window);
-    return (new RuntimeResult)->Success(Number::null);
+    return RuntimeResult().Success(Number::null);
 }
 YAN_C_API_END
 
@@ -106,7 +106,7 @@ YAN_C_API_START builtins::YanObject PollEvent(builtins::YanContext ctx) {
         eventStructInst->SetAttr("type", new Number((int) event.type));
         eventQueue.push_back(eventStructInst);
     }
-    return (new RuntimeResult)->Success(new List(eventQueue));
+    return RuntimeResult().Success(new List(eventQueue));
 }   
 YAN_C_API_END
 
@@ -115,7 +115,7 @@ YAN_C_API_START builtins::YanObject DestroyRenderer(builtins::YanContext ctx) {
     ASSERT_TYPE_MATCH(arg, String);
     auto renderer = UNWRAP_PTR(sdl2::SDL_Renderer, As<String>(arg)->s);
     sdl2::SDL_DestroyRenderer(renderer);
-    return (new RuntimeResult)->Success(Number::null);
+    return RuntimeResult().Success(Number::null);
 }
 YAN_C_API_END
 
@@ -138,19 +138,19 @@ YAN_C_API_START builtins::YanObject CreateRenderer(builtins::YanContext ctx) {
 
     auto renderer = sdl2::SDL_CreateRenderer(window, index, flags);
     if (!renderer) {
-        return (new RuntimeResult)->Failure(new SDLError(
+        return RuntimeResult().Failure(new SDLError(
             std::format("Unable to create renderer: {}", sdl2::SDL_GetError()),
             arg1->startPos, arg2->startPos, ctx
         ));
     }
 
-    return (new RuntimeResult)->Success(new String(WRAP_PTR(renderer)));
+    return RuntimeResult().Success(new String(WRAP_PTR(renderer)));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject Quit(builtins::YanContext ctx) {
     sdl2::SDL_Quit();
-    return (new RuntimeResult)->Success(Number::null);
+    return RuntimeResult().Success(Number::null);
 }
 YAN_C_API_END
 
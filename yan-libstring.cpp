@@ -29,14 +29,14 @@ YAN_C_API_END
 
 static bool CheckArg(Object *arg) {
     if (arg != nullptr) {
-        return arg->typeName == std::string("String");
+        return arg->tag == TypeTag::String;
     }
     return false;
 }
 
 static bool CheckIndex(Object *arg) {
     if (arg != nullptr) {
-        if (arg->typeName != std::string("Number")) {
+        if (arg->tag != TypeTag::Number) {
             return false;
         }
         auto v = As<Number>(arg);
@@ -93,15 +93,15 @@ static Error *YanString_ThrowExc(int excId, Object *associatedArg, Context *ctx)
 
 
 YAN_C_API_START builtins::YanObject _Split(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(_Split);
     auto arg = ctx->symbols->Get("_src");
     auto arg2 = ctx->symbols->Get("_splitter");
     if (!CheckArg(arg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
     }
     if (!CheckArg(arg2)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg2, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg2, ctx));
     }
     auto str = As<String>(arg)->s;
     auto splitter = As<String>(arg2)->s;
@@ -110,20 +110,20 @@ YAN_C_API_START builtins::YanObject _Split(builtins::YanContext ctx) {
     for (auto &&s : Split(str, splitter)) {
         l.emplace_back(new String(std::move(s)));
     }
-    return result->Success(new List(l));
+    return result.Success(new List(l));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject Format(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(Format);
     auto arg = ctx->symbols->Get("_fmt");
     auto args = ctx->symbols->Get("_args");
     if (!CheckArg(arg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
     }
-    if (args->typeName != std::string("List")) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_LIST, args, ctx));
+    if (args->tag != TypeTag::List) {
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_LIST, args, ctx));
     }
 
     bool startFmt = false;
@@ -147,22 +147,22 @@ YAN_C_API_START builtins::YanObject Format(builtins::YanContext ctx) {
                 continue;
             } else {
                 if (argIndex >= fmtArg.size()) {
-                    return result->Failure(new RuntimeError(
+                    return result.Failure(new RuntimeError(
                         "The amound of format args is less than the amount of placeholders in format string",
                         args->startPos, args->endPos, ctx
                     ));
                 }
                 switch (c) {
                 case L'd': {
-                    if (fmtArg[argIndex]->typeName != std::string("Number")) {
-                        return result->Failure(new ValueError(
+                    if (fmtArg[argIndex]->tag != TypeTag::Number) {
+                        return result.Failure(new ValueError(
                             std::format("Format placeholder '%d' requires an integer (pos {})", argIndex + 1),
                             args->startPos, args->endPos, ctx
                         ));
                     }
                     auto num = As<Number>(fmtArg[argIndex]);
                     if (!builtins::Math::HoldsInteger(num)) {
-                        return result->Failure(new ValueError(
+                        return result.Failure(new ValueError(
                             std::format("Format placeholder '%d' requires an integer (pos {})", argIndex + 1),
                             args->startPos, args->endPos, ctx
                         ));
@@ -171,15 +171,15 @@ YAN_C_API_START builtins::YanObject Format(builtins::YanContext ctx) {
                     break;
                 }                    
                 case L'f': {
-                    if (fmtArg[argIndex]->typeName != std::string("Number")) {
-                        return result->Failure(new ValueError(
+                    if (fmtArg[argIndex]->tag != TypeTag::Number) {
+                        return result.Failure(new ValueError(
                             std::format("Format placeholder '%f' requires an float number (pos {})", argIndex + 1),
                             args->startPos, args->endPos, ctx
                         ));
                     }
                     auto num = As<Number>(fmtArg[argIndex]);
                     if (builtins::Math::HoldsInteger(num)) {
-                        return result->Failure(new ValueError(
+                        return result.Failure(new ValueError(
                             std::format("Format placeholder '%f' requires an float number (pos {})", argIndex + 1),
                             args->startPos, args->endPos, ctx
                         ));
@@ -188,8 +188,8 @@ YAN_C_API_START builtins::YanObject Format(builtins::YanContext ctx) {
                     break;
                 }
                 case L'l': {
-                    if (fmtArg[argIndex]->typeName != std::string("List")) {
-                        return result->Failure(new ValueError(
+                    if (fmtArg[argIndex]->tag != TypeTag::List) {
+                        return result.Failure(new ValueError(
                             std::format("Format placeholder '%l' requires an list (pos {})", argIndex + 1),
                             args->startPos, args->endPos, ctx
                         ));
@@ -198,8 +198,8 @@ YAN_C_API_START builtins::YanObject Format(builtins::YanContext ctx) {
                     break;
                 }
                 case L'm': {
-                    if (fmtArg[argIndex]->typeName != std::string("Dictionary") && fmtArg[argIndex]->typeName != std::string("ClassObject")) {
-                        return result->Failure(new ValueError(
+                    if (fmtArg[argIndex]->tag != TypeTag::Dictionary && fmtArg[argIndex]->tag != TypeTag::ClassObject) {
+                        return result.Failure(new ValueError(
                             std::format("Format placeholder '%m' requires an mapping [ClassObject or Dictionary] (pos {})", argIndex + 1),
                             args->startPos, args->endPos, ctx
                         ));
@@ -208,8 +208,8 @@ YAN_C_API_START builtins::YanObject Format(builtins::YanContext ctx) {
                     break;
                 }
                 case L's': {
-                    if (fmtArg[argIndex]->typeName != std::string("String")) {
-                        return result->Failure(new ValueError(
+                    if (fmtArg[argIndex]->tag != TypeTag::String) {
+                        return result.Failure(new ValueError(
                             std::format("Format placeholder '%s' requires an string (pos {})", argIndex + 1),
                             args->startPos, args->endPos, ctx
                         ));
@@ -221,7 +221,7 @@ YAN_C_API_START builtins::YanObject Format(builtins::YanContext ctx) {
                     wss << std::format(L"{}", ToWideString(fmtArg[argIndex]->ToString()));                    
                     break;                    
                 default:
-                    return result->Failure(new ValueError(
+                    return result.Failure(new ValueError(
                         ToByteString(std::format(L"Invilid format placeholder: '%{}'", c)),
                         arg->startPos, arg->endPos, ctx
                     ));
@@ -238,23 +238,23 @@ YAN_C_API_START builtins::YanObject Format(builtins::YanContext ctx) {
     }
 
     if (fmtArgs < fmtArg.size()) {
-        return result->Failure(new ValueError(
+        return result.Failure(new ValueError(
             "Trailing format argument(s)",
             arg->startPos, arg->endPos, ctx
         ));
     }
 
-    return result->Success(new String(ToByteString(wss.str())));
+    return result.Success(new String(ToByteString(wss.str())));
 }
 YAN_C_API_END
 
 
 YAN_C_API_START builtins::YanObject ToCharArray(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(Format);
     auto arg = ctx->symbols->Get("_src");
     if (!CheckArg(arg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
     }
     
     auto wstr = ToWideString(As<String>(arg)->s);
@@ -262,23 +262,23 @@ YAN_C_API_START builtins::YanObject ToCharArray(builtins::YanContext ctx) {
     for (auto c : wstr) {
         r.emplace_back(new String(ToByteString(std::wstring(1, c))));
     }
-    return result->Success(new List(r));
+    return result.Success(new List(r));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject Sub(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(Sub);
     auto arg = ctx->symbols->Get("_src");
     auto startArg = ctx->symbols->Get("_st");
     auto endArg = ctx->symbols->Get("_et");
 
     if (!CheckArg(arg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
     } else if (!CheckIndex(startArg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_INVILID_VALUE, startArg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_INVILID_VALUE, startArg, ctx));
     } else if (!CheckIndex(endArg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_INVILID_VALUE, endArg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_INVILID_VALUE, endArg, ctx));
     }
 
     auto src = ToWideString(As<String>(arg)->s);
@@ -286,29 +286,29 @@ YAN_C_API_START builtins::YanObject Sub(builtins::YanContext ctx) {
     auto end = builtins::Math::GetInt(As<Number>(endArg));
 
     if (start > src.size() || end > src.size()) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_INDEX_OUT_OF_BOUNDS, startArg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_INDEX_OUT_OF_BOUNDS, startArg, ctx));
     } else if (start > end) {
-        return result->Failure(new RuntimeError(
+        return result.Failure(new RuntimeError(
             "Start index should be less than end index",
             startArg->startPos, startArg->endPos, ctx
         ));
     }
-    return result->Success(new String(ToByteString(src.substr(start, end - start))));
+    return result.Success(new String(ToByteString(src.substr(start, end - start))));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject Replace(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     YAN_CONTEXT_DECORATION(Replace);
     auto arg = ctx->symbols->Get("_src");
     auto subArg = ctx->symbols->Get("_sub");
     auto newArg = ctx->symbols->Get("_new");
     if (!CheckArg(arg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
     } else if (!CheckArg(subArg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, subArg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, subArg, ctx));
     } else if (!CheckArg(newArg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, newArg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, newArg, ctx));
     }
 
     std::wstring src = ToWideString(As<String>(arg)->s);
@@ -331,24 +331,24 @@ YAN_C_API_START builtins::YanObject Replace(builtins::YanContext ctx) {
     if (src != L"") {
         dest += src;
     }
-    return result->Success(new String(ToByteString(dest)));
+    return result.Success(new String(ToByteString(dest)));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject Substitute(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto args = YanString_PollArgs(ctx, { "_src", "_st", "_len", "_new" });
     if (!CheckArg(args[0])) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, args[0], ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, args[0], ctx));
     }
     if (!CheckIndex(args[1])) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_INVILID_VALUE, args[1], ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_INVILID_VALUE, args[1], ctx));
     }
     if (!CheckIndex(args[2])) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_INVILID_VALUE, args[2], ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_INVILID_VALUE, args[2], ctx));
     }
     if (!CheckArg(args[3])) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, args[3], ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, args[3], ctx));
     }
 
     auto src = ToWideString(As<String>(args[0])->s);
@@ -358,7 +358,7 @@ YAN_C_API_START builtins::YanObject Substitute(builtins::YanContext ctx) {
 
     std::wstringstream wss;
     if (st >= src.length()) {
-        return result->Failure(new RuntimeError("String index out of range", args[1]->startPos, args[1]->endPos, ctx));
+        return result.Failure(new RuntimeError("String index out of range", args[1]->startPos, args[1]->endPos, ctx));
     }
 
     std::size_t index = 0;
@@ -371,20 +371,20 @@ YAN_C_API_START builtins::YanObject Substitute(builtins::YanContext ctx) {
         wss << c;
         index++;
     }
-    return result->Success(new String(ToByteString(wss.str())));
+    return result.Success(new String(ToByteString(wss.str())));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject Repeat(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_src");
     auto arg2 = ctx->symbols->Get("_count");
 
     if (!CheckArg(arg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
     }
     if (!CheckIndex(arg2)) {
-        return result->Failure(new TypeError(
+        return result.Failure(new TypeError(
             "Repeat count should be a positive (or 0) integer",
             arg2->startPos, arg2->endPos, ctx
         ));
@@ -397,7 +397,7 @@ YAN_C_API_START builtins::YanObject Repeat(builtins::YanContext ctx) {
     for (int i = 0; i < count; i++) {
         ss << src;
     }
-    return result->Success(new String(ss.str()));
+    return result.Success(new String(ss.str()));
 }
 YAN_C_API_END
 
@@ -406,40 +406,40 @@ YAN_C_API_START builtins::YanObject Find(builtins::YanContext ctx) {
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject StartsWith(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_str1");
     auto arg2 = ctx->symbols->Get("_str2");
 
     if (!CheckArg(arg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
     }
     if (!CheckArg(arg2)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg2, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg2, ctx));
     }
 
     auto src = As<String>(arg)->s;
     auto match = As<String>(arg2)->s;
     bool val = src.starts_with(match);    
-    return result->Success(new Number((int) val));
+    return result.Success(new Number((int) val));
 }
 YAN_C_API_END
 
 YAN_C_API_START builtins::YanObject EndsWith(builtins::YanContext ctx) {
-    auto result = new RuntimeResult;
+    RuntimeResult result;
     auto arg = ctx->symbols->Get("_str1");
     auto arg2 = ctx->symbols->Get("_str2");
 
     if (!CheckArg(arg)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg, ctx));
     }
     if (!CheckArg(arg2)) {
-        return result->Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg2, ctx));
+        return result.Failure(YanString_ThrowExc(YAN_STRING_NOT_A_STRING, arg2, ctx));
     }
 
     auto src = As<String>(arg)->s;
     auto match = As<String>(arg2)->s;
     bool val = src.ends_with(match);
-    return result->Success(new Number((int) val));
+    return result.Success(new Number((int) val));
 }
 YAN_C_API_END
 
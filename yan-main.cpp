@@ -5,6 +5,24 @@ int main(int argc, char **argv) {
     globalSymbolTable = new SymbolTable;
 
     Initialize();
+
+    // Interpreter options precede the script: yan [--engine=ast|vm] [script [args ...]]
+    int optionCount = 0;
+    while (optionCount + 1 < argc && std::string(argv[optionCount + 1]).starts_with("--")) {
+        std::string option = argv[optionCount + 1];
+        if (option == "--engine=vm") {
+            executionEngine = ExecutionEngine::VM;
+        } else if (option == "--engine=ast") {
+            executionEngine = ExecutionEngine::TreeWalker;
+        } else {
+            std::cerr << std::format("Fatal: Invilid option: \"{}\"", option) << std::endl;
+            return EXIT_FAILURE;
+        }
+        optionCount++;
+    }
+    argc -= optionCount;
+    argv += optionCount;
+
     std::vector<std::string> args;
     for (int i = 0; i < argc; i++) {
         args.push_back(std::string(argv[i]));
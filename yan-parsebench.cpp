@@ -0,0 +1,109 @@
+#include "yan-lang.hpp"
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+// Parser throughput benchmark
+//   g++ -std=c++20 -O2 yan-parsebench.cpp -o yan-parsebench
+//   ./yan-parsebench                 generated inputs of 12.5k, 25k, 50k and 100k lines
+//   ./yan-parsebench <file.yan> ...  the given scripts
+// Lexing and parsing are timed separately (median of several runs); `ns/line` should stay flat as the input grows
+
+
+constexpr int RUNS = 5;
+
+// Emits `lines` lines of valid Yan covering operators, calls, subscription / attribution chains and blocks
+std::string GenerateSource(std::size_t lines) {
+    std::ostringstream oss;
+    std::size_t n = 0, i = 0;
+    while (n < lines) {
+        oss << std::format("var a{} = {} + {} * (3 - {} / 7) ^ 2 - -1\n", i, i, i + 1, i);
+        oss << std::format("function f{}(x, y)\n", i);
+        oss << std::format("    var z = x * y + f{}(x - 1, y) / 2\n", i);
+        oss << "    if z > 10 and not x == y then\n";
+        oss << std::format("        return [z, x, {{'k{}': y, 'n': 0.5}}]\n", i);
+        oss << "    elif z <= 0 or x != y then\n";
+        oss << "        return obj.attr.call(z, 'text')[0]\n";
+        oss << "    end\n";
+        oss << "    for i = 0 to 10 step 2 then var z = table[i][x](y)\n";
+        oss << "    while z < 3 then var z = z + 1\n";
+        oss << "    return z\n";
+        oss << "end\n";
+        oss << std::format("println(f{}(a{}, 'value {}'))\n", i, i, i);
+        n += 13;
+        i++;
+    }
+    return oss.str();
+}
+
+struct Sample {
+    double lexSeconds, parseSeconds;
+    std::size_t tokens;
+};
+
+Sample Measure(const std::string &name, const std::string &code) {
+    std::vector<double> lexTimes, parseTimes;
+    std::size_t tokenCount = 0;
+    for (int run = 0; run < RUNS; run++) {
+        auto unit = new CompilationUnit(name);
+
+        auto t0 = std::chrono::steady_clock::now();
+        Lexer lexer(name, code);
+        auto [tokens, err] = lexer.MakeTokens();
+        auto t1 = std::chrono::steady_clock::now();
+        if (err != nullptr) {
+            std::cerr << err->ToString() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        unit->tokens = tokens;
+        tokenCount = tokens->Size();
+
+        Parser parser(unit);
+        auto parseResult = parser.Parse();
+        auto t2 = std::chrono::steady_clock::now();
+        if (parseResult->err != nullptr) {
+            std::cerr << parseResult->err->ToString() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        lexTimes.push_back(std::chrono::duration<double>(t1 - t0).count());
+        parseTimes.push_back(std::chrono::duration<double>(t2 - t1).count());
+        unit->Release();
+    }
+    std::sort(lexTimes.begin(), lexTimes.end());
+    std::sort(parseTimes.begin(), parseTimes.end());
+    return { lexTimes[RUNS / 2], parseTimes[RUNS / 2], tokenCount };
+}
+
+void Report(const std::string &name, const std::string &code) {
+    auto lines = std::count(code.begin(), code.end(), '\n') + 1;
+    auto sample = Measure(name, code);
+    std::cout << std::format(
+        "{:<24} {:>8} {:>9} {:>10.2f} {:>10.2f} {:>10.1f} {:>12.0f}\n",
+        name, lines, sample.tokens, sample.lexSeconds * 1e3, sample.parseSeconds * 1e3,
+        sample.parseSeconds * 1e9 / lines, sample.tokens / sample.parseSeconds
+    );
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << std::format("{:<24} {:>8} {:>9} {:>10} {:>10} {:>10} {:>12}\n", "input", "lines", "tokens", "lex ms", "parse ms", "ns/line", "tokens/s");
+
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) {
+            std::ifstream ifs(argv[i]);
+            if (!ifs.is_open()) {
+                std::cerr << "Fatal: cannot open file " << argv[i] << std::endl;
+                return EXIT_FAILURE;
+            }
+            std::ostringstream oss;
+            oss << ifs.rdbuf();
+            Report(argv[i], oss.str());
+        }
+        return EXIT_SUCCESS;
+    }
+
+    for (std::size_t lines : { 12500, 25000, 50000, 100000 }) {
+        Report(std::format("<generated {}k>", lines / 1000.0), GenerateSource(lines));
+    }
+    return EXIT_SUCCESS;
+}
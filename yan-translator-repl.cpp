@@ -9,21 +9,15 @@ int main(int argc, char *argv[]) {
         if (input.empty()) {
             continue;
         }
-        auto lexer = Lexer("<stdin>", ToWideString(input));
-        auto tokens = lexer.MakeTokens();
-        if (tokens.second) {
-            std::cerr << tokens.second->ToString() << std::endl;
-            continue;
-        }
-        auto parser = Parser(tokens.first);
-        auto ast = parser.Parse();
-        if (ast->err) {
-            std::cerr << ast->err->ToString() << std::endl;
+        auto [unit, err] = CompilationUnit::Compile("<stdin>", input);
+        if (err) {
+            std::cerr << err->ToString() << std::endl;
             continue;
         }
 
-        Translator translator(ast->ast);
+        Translator translator(unit->ast);
         std::cout << translator.ToPython() << std::endl;
+        unit->Release();
     }
     while (input != "exit");
 }
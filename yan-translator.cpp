@@ -36,19 +36,13 @@ int main(int argc, char *argv[]) {
     }
     code = Join(lines, "\n");
 
-    auto lexer = Lexer(file, ToWideString(code));
-    auto tokens = lexer.MakeTokens();
-    if (tokens.second) {
-        std::cerr << tokens.second->ToString() << std::endl;
+    auto [unit, err] = CompilationUnit::Compile(file, code);
+    if (err) {
+        std::cerr << err->ToString() << std::endl;
+        return 1;
     }
 
-    auto parser = Parser(tokens.first);
-    auto ast = parser.Parse();
-    if (ast->err) {
-        std::cerr << ast->err->ToString() << std::endl;
-    }
-
-    auto codeGenreator = Translator(ast->ast);
+    auto codeGenreator = Translator(unit->ast);
     std::stringstream ss;
     ss << "from builtins_py.common import *\n\n\n";
     ss << codeGenreator.ToPython();
@@ -58,4 +52,5 @@ int main(int argc, char *argv[]) {
     std::ofstream ofs(file.substr(0, file.find(".")) + ".py");
     ofs << ss.str();
     ofs.close();
+    unit->Release();
 }
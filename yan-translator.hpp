@@ -58,74 +58,70 @@ public:
     }
 
     std::string VisitExpression(NodeBase *node) {
-        auto exprNode = dynamic_cast<BinaryOperationNode *>(node);
+        auto exprNode = NodeCast<BinaryOperationNode>(node);
         std::string opValue {};
-        switch (exprNode->binaryOperator.type) {
-        case TokenType::OP_Plus:
+        switch (exprNode->op) {
+        case OperatorKind::Add:
             opValue = "+";
             break;
-        case TokenType::OP_Minus:
+        case OperatorKind::Subtract:
             opValue = "-";
             break;
-        case TokenType::OP_Mul:
+        case OperatorKind::Multiply:
             opValue = "*";
             break;
-        case TokenType::OP_Div:
+        case OperatorKind::Divide:
             opValue = "/";
             break;
-        case TokenType::OP_Pow:
+        case OperatorKind::Power:
             opValue = "**";
             break;
-        case TokenType::OP_Equal:
+        case OperatorKind::Equal:
             opValue = "==";
             break;
-        case TokenType::OP_Nequal:
+        case OperatorKind::NotEqual:
             opValue = "!=";
             break;
-        case TokenType::OP_Gt:
+        case OperatorKind::Greater:
             opValue = ">";
             break;
-        case TokenType::OP_Lt:
+        case OperatorKind::Less:
             opValue = "<";
             break;
-        case TokenType::OP_Gte: 
+        case OperatorKind::GreaterEqual: 
             opValue = ">="; 
             break;
-        case TokenType::OP_Lte:
+        case OperatorKind::LessEqual:
             opValue = "<=";
             break;  
-        case TokenType::Keyword:
-            if (exprNode->binaryOperator.Matches<std::string>(TokenType::Keyword, std::string("and"))) {
-                opValue = "and";
-            } else if (exprNode->binaryOperator.Matches<std::string>(TokenType::Keyword, std::string("or"))) {
-                opValue = "or";
-            } else {
-                std::cerr << "Unsupported binary operator: " << *(std::string *) exprNode->binaryOperator.value << std::endl;
-                assert(false);
-            }
+        case OperatorKind::And:
+            opValue = "and";
+            break;
+        case OperatorKind::Or:
+            opValue = "or";
             break;
         default:
-            std::cerr << "Unsupported binary operator: " << static_cast<int>(exprNode->binaryOperator.type) << std::endl;
+            std::cerr << "Unsupported binary operator: " << exprNode->binaryOperator.ToString() << std::endl;
             assert(false);
         }
         return std::format("{} {} {}", Visit(exprNode->left), opValue, Visit(exprNode->right));
     }
 
     std::string VisitSingleExpression(NodeBase *node) {
-        auto uNode = dynamic_cast<UnaryOperationNode *>(node);
+        auto uNode = NodeCast<UnaryOperationNode>(node);
         std::string opValue {};
-        switch (uNode->unaryOperator.type) {
-        case TokenType::OP_Plus:
+        switch (uNode->op) {
+        case OperatorKind::Add:
             opValue = "+";
             break;
-        case TokenType::OP_Minus:
+        case OperatorKind::Subtract:
             opValue = "-";
             break;
-        case TokenType::Keyword:
+        case OperatorKind::Not:
             opValue = "not ";
             break;
         default:
-            std::cerr << "Unsupported unary operator: " << uNode->unaryOperator.value << std::endl;
+            std::cerr << "Unsupported unary operator: " << uNode->unaryOperator.ToString() << std::endl;
             assert(false);
         }
 
@@ -133,11 +129,11 @@ public:
     }
 
     std::string VisitVarAccessNode(NodeBase *node) {
-        return *(std::string *) dynamic_cast<VariableAccessNode *>(node)->variableNameToken.value;
+        return *(std::string *) NodeCast<VariableAccessNode>(node)->variableNameToken.value;
     }
 
     std::string VisitVarAssignNode(NodeBase *node) {
-        auto varAssignNode = dynamic_cast<VariableAssignNode *>(node);
+        auto varAssignNode = NodeCast<VariableAssignNode>(node);
         return std::format("{} = {}", *(std::string *) varAssignNode->variableNameToken.value, Visit(varAssignNode->valueNode));
     }
 
@@ -150,7 +146,7 @@ public:
     }
 
     std::string VisitNumber(NodeBase *node) {
-        auto numNode = dynamic_cast<NumberNode *>(node);
+        auto numNode = NodeCast<NumberNode>(node);
         if (numNode->numberToken.type == TokenType::Int) {
             return std::format("{}", *(int *) numNode->numberToken.value);
         } else {
@@ -159,7 +155,7 @@ public:
     }
 
     std::string VisitIfExpressionNode(NodeBase *node) {
-        auto ifNode = dynamic_cast<IfExpressionNode *>(node);
+        auto ifNode = NodeCast<IfExpressionNode>(node);
         std::string result {};
         indent++;
 
@@ -182,10 +178,10 @@ public:
     }
     
     std::string VisitForExpression(NodeBase *node) {
-        auto forExpressionNode = dynamic_cast<ForExpressionNode *>(node);
+        auto forExpressionNode = NodeCast<ForExpressionNode>(node);
         std::string result {};
 
-        if (forExpressionNode->body->nodeType == NodeType::List && dynamic_cast<ListNode *>(forExpressionNode->body)->isStatements) {
+        if (forExpressionNode->body->nodeType == NodeType::List && NodeCast<ListNode>(forExpressionNode->body)->isStatements) {
             indent++;
             if (forExpressionNode->rangeBasedLoop) {
                 result += "for " + *((std::string *) forExpressionNode->var.value) + " in " + Visit(forExpressionNode->range) + ":\n";
@@ -201,13 +197,13 @@ public:
             return result;
         } else {
             if (forExpressionNode->body->nodeType == NodeType::VarAssign) {
-                auto varName = *(std::string *) dynamic_cast<VariableAssignNode *>(forExpressionNode->body)->variableNameToken.value;
-                auto val = Visit(dynamic_cast<VariableAssignNode *>(forExpressionNode->body)->valueNode);
+                auto varName = *(std::string *) NodeCast<VariableAssignNode>(forExpressionNode->body)->variableNameToken.value;
+                auto val = Visit(NodeCast<VariableAssignNode>(forExpressionNode->body)->valueNode);
                 result += "[yan_impl_inline_assign('" +  varName + "\', " + val + ")";
             } else if (forExpressionNode->body->nodeType == NodeType::AdvancedVarAccess) {
                 bool useInline = false;
-                for (auto node: dynamic_cast<AdvancedVarAccessNode *>(forExpressionNode->body)->advancedAccess) {
-                    if (node->nodeType == NodeType::Attribution && dynamic_cast<AttributionNode *>(node)->assignment) {
+                for (auto node: NodeCast<AdvancedVarAccessNode>(forExpressionNode->body)->advancedAccess) {
+                    if (node->nodeType == NodeType::Attribution && NodeCast<AttributionNode>(node)->assignment) {
                         useInline = true;
                     }
                 }
@@ -234,7 +230,7 @@ normal_parse:
     }
     
     std::string VisitWhileExpression(NodeBase *node) {
-        auto whileNode = dynamic_cast<WhileExpressionNode *>(node);
+        auto whileNode = NodeCast<WhileExpressionNode>(node);
         std::string result {};
         indent++;
 
@@ -245,11 +241,11 @@ normal_parse:
     }
     
     std::string VisitFunctionCall(NodeBase *node) {
-        auto funcCallNode = dynamic_cast<FunctionCallNode *>(node);
+        auto funcCallNode = NodeCast<FunctionCallNode>(node);
         std::string result {};
         auto t = Visit(funcCallNode->target);
 
-        if (Lexer::Contains(builtinNames, t)) {
+        if (Contains(builtinNames, t)) {
             result += "yan_builtin_impl_";
         }
 
@@ -269,7 +265,7 @@ normal_parse:
     }
 
     std::string VisitFunctionDefinition(NodeBase *node) {
-        auto funcDefNode = dynamic_cast<FunctionDefinitionNode *>(node);
+        auto funcDefNode = NodeCast<FunctionDefinitionNode>(node);
         std::string result {};
         std::string funcName {};
         if (!funcDefNode->fun.value) {
@@ -278,7 +274,7 @@ normal_parse:
             funcName = *(std::string *) funcDefNode->fun.value;
         }
 
-        if (funcDefNode->body->nodeType == NodeType::List && dynamic_cast<ListNode *>(funcDefNode->body)->isStatements) {
+        if (funcDefNode->body->nodeType == NodeType::List && NodeCast<ListNode>(funcDefNode->body)->isStatements) {
             result += "def " + funcName + "(";
 
             indent++;
@@ -318,8 +314,8 @@ normal_parse:
                 if (funcDefNode->body->nodeType == NodeType::AdvancedVarAccess) {
                     bool useInline = false;
                     
-                    for (auto node : dynamic_cast<AdvancedVarAccessNode *>(funcDefNode->body)->advancedAccess) {
-                        if (node->nodeType == NodeType::Attribution && dynamic_cast<AttributionNode *>(node)->assignment) {
+                    for (auto node : NodeCast<AdvancedVarAccessNode>(funcDefNode->body)->advancedAccess) {
+                        if (node->nodeType == NodeType::Attribution && NodeCast<AttributionNode>(node)->assignment) {
                             useInline = true;
                         }
                     }
@@ -329,8 +325,8 @@ normal_parse:
                         return result;
                     }
                 } else if (funcDefNode->body->nodeType == NodeType::VarAssign) {
-                    auto value = dynamic_cast<VariableAssignNode *>(funcDefNode->body)->valueNode;
-                    auto varName = *(std::string *) dynamic_cast<VariableAssignNode *>(funcDefNode->body)->variableNameToken.value;
+                    auto value = NodeCast<VariableAssignNode>(funcDefNode->body)->valueNode;
+                    auto varName = *(std::string *) NodeCast<VariableAssignNode>(funcDefNode->body)->variableNameToken.value;
                     result += ": " + std::format("yan_impl_inline_assign('{}', {})", varName, Visit(value));
                     return result;
                 }
@@ -359,7 +355,7 @@ normal_parse:
     }
     
     std::string VisitString(NodeBase *node) {
-        auto stringNode = dynamic_cast<StringNode *>(node);
+        auto stringNode = NodeCast<StringNode>(node);
         std::stringstream ss;
         (new String(*(std::string *) stringNode->stringToken.value))->Representation(ss);
         return ss.str();
@@ -367,15 +363,15 @@ normal_parse:
 
     std::string VisitList(NodeBase *node) {
         std::string result {};
-        auto listNode = dynamic_cast<ListNode *>(node);
+        auto listNode = NodeCast<ListNode>(node);
         if (!listNode->isStatements) {
-            if (dynamic_cast<ListNode *>(node)->elements.empty()) {
+            if (NodeCast<ListNode>(node)->elements.empty()) {
                 return "[]";
             }
 
             int index = 0;
-            int len = dynamic_cast<ListNode *>(node)->elements.size();
-            for (auto item : dynamic_cast<ListNode *>(node)->elements) {
+            int len = NodeCast<ListNode>(node)->elements.size();
+            for (auto item : NodeCast<ListNode>(node)->elements) {
                 result += Visit(item);
                 if (index != len - 1) {
                     result += ", ";
@@ -384,7 +380,7 @@ normal_parse:
             }
             return "[" +  result + "]";
         } else {
-            for (auto item : dynamic_cast<ListNode *>(node)->elements) {
+            for (auto item : NodeCast<ListNode>(node)->elements) {
                 result += GetIndent(indent) + Visit(item) + "\n";
             }
             return result;
@@ -392,7 +388,7 @@ normal_parse:
     }
 
     std::string VisitReturn(NodeBase *node) {
-        auto returnNode = dynamic_cast<ReturnStatementNode *>(node);
+        auto returnNode = NodeCast<ReturnStatementNode>(node);
         if (returnNode->nodeToReturn) {
             return std::format("return {}", Visit(returnNode->nodeToReturn));
         } else {
@@ -409,7 +405,7 @@ normal_parse:
     }
 
     std::string VisitSubscription(NodeBase *node) {
-        auto subscriptionNode = dynamic_cast<SubscriptionNode *>(node);
+        auto subscriptionNode = NodeCast<SubscriptionNode>(node);
         std::string result {};
         result += Visit(subscriptionNode->target) + "[" + Visit(subscriptionNode->index) + "]";
         if (subscriptionNode->calls.find(0) != subscriptionNode->calls.end()) {
@@ -449,14 +445,14 @@ normal_parse:
     }
 
     std::string VisitDictionary(NodeBase *node) {
-        auto dictNode = dynamic_cast<DictionaryNode *>(node);
+        auto dictNode = NodeCast<DictionaryNode>(node);
         std::string result = "yan_dict_impl({ ";
 
         int count = 1;
         for (const auto &[k, v] : dictNode->elements) {
             if (v->nodeType == NodeType::FunctionDefinition) {
                 std::string inlineFunc = "lambda ";
-                for (auto arg : dynamic_cast<FunctionDefinitionNode *>(v)->parameters) {
+                for (auto arg : NodeCast<FunctionDefinitionNode>(v)->parameters) {
                     auto argName = *(std::string *) arg.value;
                     if (argName.starts_with("_") && argName.ends_with("_")) {
                         inlineFunc += '*' + argName.substr(1, argName.size() - 2);
@@ -464,7 +460,7 @@ normal_parse:
                         inlineFunc += argName;
                     }
                 }   
-                inlineFunc += ": " + Visit(dynamic_cast<FunctionDefinitionNode *>(v)->body);
+                inlineFunc += ": " + Visit(NodeCast<FunctionDefinitionNode>(v)->body);
                 result += Visit(k) + ": " + inlineFunc;
             } else {
                 result += Visit(k) + ": " + Visit(v);
@@ -481,7 +477,7 @@ normal_parse:
     }
 
     std::string VisitAttribution(NodeBase *node) {
-        auto attributionNode = dynamic_cast<AttributionNode *>(node);
+        auto attributionNode = NodeCast<AttributionNode>(node);
         std::string result {};
         if (attributionNode->calls.find(0) != attributionNode->calls.end()) {
             result += Visit(attributionNode->target) + "." + Visit(attributionNode->calls[0]);
@@ -506,7 +502,7 @@ normal_parse:
     }
 
     std::string VisitAdvancedVarAccess(NodeBase *node) {
-        auto advancedVarAccessNode = dynamic_cast<AdvancedVarAccessNode *>(node);
+        auto advancedVarAccessNode = NodeCast<AdvancedVarAccessNode>(node);
         std::string result {};
         for (auto item : advancedVarAccessNode->advancedAccess) {
             result += Visit(item);
@@ -515,27 +511,27 @@ normal_parse:
     }
     
     std::string VisitNewExpression(NodeBase *node) {
-        auto newNode = dynamic_cast<NewExprNode *>(node);
+        auto newNode = NodeCast<NewExprNode>(node);
         if (newNode->newExpr->nodeType == NodeType::FunctionCall) {
-            return std::format("{}", Visit(dynamic_cast<NewExprNode *>(node)->newExpr));
+            return std::format("{}", Visit(NodeCast<NewExprNode>(node)->newExpr));
         } else {
-            return std::format("{}()", Visit(dynamic_cast<NewExprNode *>(node)->newExpr));
+            return std::format("{}()", Visit(NodeCast<NewExprNode>(node)->newExpr));
         }
     }
 
     std::string VisitAttributionCall(NodeBase *node) {
-        auto attributionCallNode = dynamic_cast<AttributionCallNode *>(node);
+        auto attributionCallNode = NodeCast<AttributionCallNode>(node);
         std::string result {};
         result += Visit(attributionCallNode->call);
         return result;
     }
 
     std::string VisitNonlocal(NodeBase *node) {
-        return std::format("nonlocal {}", *(std::string *) dynamic_cast<NonlocalStatementNode *>(node)->freeVar.value);
+        return std::format("nonlocal {}", *(std::string *) NodeCast<NonlocalStatementNode>(node)->freeVar.value);
     }
 
     std::string VisitDefer(NodeBase *node) {
-        return std::format("__yan_keyword_impl_defer('{}')", Visit(dynamic_cast<DeferNode *>(node)->deferExpr));
+        return std::format("__yan_keyword_impl_defer('{}')", Visit(NodeCast<DeferNode>(node)->deferExpr));
     }
 
     std::string ToPython() {